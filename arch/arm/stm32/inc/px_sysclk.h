@@ -42,6 +42,12 @@
  *  'px_sysclk_cfg.h' with PX_SYSCLK_TIMEOUT_PERIOD_TICKS and the function to 
  *  call with.
  *  
+ *  If PX_SYSCLK_CFG_TICKLESS = 1 in 'px_sysclk_cfg.h', px_sysclk_sleep() stops
+ *  the SysTick interrupt and enters STOP mode with LPTIM1 (clocked by the LSE)
+ *  as wake-up timer. On wake-up the ticks that have elapsed are added to the
+ *  clock tick counter. See @ref PX_SCHED. Tickless sleep is only implemented
+ *  for STM32L0.
+ *  
  *  @tip_s
  *  See @ref PX_SYSTMR which builds on @ref STM32_SYSCLK to provide multiple
  *  software timers. Example:
@@ -64,10 +70,17 @@
 #error "One or more options not defined in 'px_sysclk_cfg.h'"
 #endif
 
+#ifndef PX_SYSCLK_CFG_TICKLESS
+/// Tickless sleep support with px_sysclk_sleep() (1) or not (0)
+#define PX_SYSCLK_CFG_TICKLESS 0
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 /* _____DEFINITIONS__________________________________________________________ */
+/// Maximum number of ticks that px_sysclk_sleep() can sleep (16-bit LPTIM counter at 1024 Hz)
+#define PX_SYSCLK_SLEEP_TICKS_MAX   (60ul * PX_SYSCLK_CFG_TICKS_PER_SEC)
 
 /* _____TYPE DEFINITIONS_____________________________________________________ */
 /// Size definition of the tick counter
@@ -97,6 +110,24 @@ px_sysclk_ticks_t px_sysclk_get_tick_count(void);
  */
 void px_sysclk_reset_tick_count(void);
 
+#if PX_SYSCLK_CFG_TICKLESS
+/**
+ *  Suppress SysTick interrupt and sleep in STOP mode.
+ *  
+ *  LPTIM1 wakes the core after the specified number of ticks, but any other
+ *  enabled interrupt will also wake the core up earlier. The ticks that have
+ *  elapsed are added to the clock tick counter. Must be called with interrupts
+ *  disabled, so that the interrupt that woke the core is serviced after this
+ *  function returns and interrupts are enabled.
+ *  
+ *  @param ticks                Number of ticks to sleep
+ *                              (PX_SYSCLK_SLEEP_TICKS_MAX or less)
+ *  
+ *  @return px_sysclk_ticks_t   Number of ticks that have elapsed
+ */
+px_sysclk_ticks_t px_sysclk_sleep(px_sysclk_ticks_t ticks);
+#endif
+
 /* _____MACROS_______________________________________________________________ */
 
 #ifdef __cplusplus
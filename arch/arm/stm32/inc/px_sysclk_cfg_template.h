@@ -31,6 +31,9 @@
 /// Enable (1) or disable (0) support for STM32Cube HAL 1 ms SysTick timer functionality
 #define PX_SYSCLK_CFG_STMCUBE_HAL_TMR 1
 
+/// Enable (1) or disable (0) tickless sleep with px_sysclk_sleep() (uses LPTIM1 and LSE; STM32L0 only)
+#define PX_SYSCLK_CFG_TICKLESS 0
+
 /// Specify periodic timeout (in sysclk ticks)
 //#define PX_SYSCLK_CFG_TIMEOUT_PERIOD_TICKS     PX_SYSCLK_CFG_TICKS_PER_SEC
 
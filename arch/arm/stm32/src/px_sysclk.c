@@ -28,6 +28,13 @@
 #endif
 
 /* _____LOCAL DEFINITIONS____________________________________________________ */
+#if PX_SYSCLK_CFG_TICKLESS
+#if !defined(STM32L0)
+#error "PX_SYSCLK_CFG_TICKLESS = 1 is only supported on STM32L0 (LPTIM1 clock source and EXTI line 29)"
+#endif
+/// LPTIM1 clock frequency (LSE / 32)
+#define PX_SYSCLK_LPTIM_HZ  1024ul
+#endif
 
 /* _____MACROS_______________________________________________________________ */
 
@@ -40,6 +47,11 @@ static volatile px_sysclk_ticks_t px_sysclk_tick_counter;
 static volatile px_sysclk_ticks_t px_sysclk_timeout_counter;
 #endif
 
+#if PX_SYSCLK_CFG_TICKLESS
+/// Fraction of a tick (in LPTIM counts * ticks per sec) carried over to the next sleep
+static uint32_t px_sysclk_sleep_remainder;
+#endif
+
 /* _____LOCAL FUNCTION DECLARATIONS__________________________________________ */
 
 /* _____LOCAL FUNCTIONS______________________________________________________ */
@@ -75,6 +87,17 @@ void SysTick_Handler(void)
 #endif
 }
 
+#if PX_SYSCLK_CFG_TICKLESS
+/// LPTIM1 interrupt handler (wake-up from STOP mode).
+void LPTIM1_IRQHandler(void)
+{
+    // Clear compare match flag
+    LL_LPTIM_ClearFlag_CMPM(LPTIM1);
+    // Clear EXTI line 29 pending flag
+    LL_EXTI_ClearFlag_0_31(LL_EXTI_LINE_29);
+}
+#endif
+
 /* _____GLOBAL FUNCTIONS_____________________________________________________ */
 void px_sysclk_init(void)
 {
@@ -92,6 +115,19 @@ void px_sysclk_init(void)
     // Reset timeout counter
     px_sysclk_timeout_counter = PX_SYSCLK_CFG_TIMEOUT_PERIOD_TICKS;
 #endif
+
+#if PX_SYSCLK_CFG_TICKLESS
+    // Clock LPTIM1 from LSE (must already be enabled)
+    LL_RCC_SetLPTIMClockSource(LL_RCC_LPTIM1_CLKSOURCE_LSE);
+    LL_APB1_GRP1_EnableClock(LL_APB1_GRP1_PERIPH_LPTIM1);
+    // 32768 Hz / 32 = 1024 Hz
+    LL_LPTIM_SetPrescaler(LPTIM1, LL_LPTIM_PRESCALER_DIV32);
+    // Enable LPTIM1 compare match wake-up interrupt (EXTI line 29)
+    LL_EXTI_EnableIT_0_31(LL_EXTI_LINE_29);
+    LL_EXTI_EnableRisingTrig_0_31(LL_EXTI_LINE_29);
+    NVIC_EnableIRQ(LPTIM1_IRQn);
+    px_sysclk_sleep_remainder = 0;
+#endif
 }
 
 px_sysclk_ticks_t px_sysclk_get_tick_count(void)
@@ -103,3 +139,58 @@ void px_sysclk_reset_tick_count(void)
 {
     px_sysclk_tick_counter = 0;
 }
+
+#if PX_SYSCLK_CFG_TICKLESS
+px_sysclk_ticks_t px_sysclk_sleep(px_sysclk_ticks_t ticks)
+{
+    uint32_t counts;
+    uint32_t counts_prev;
+
+    // Limit sleep period
+    if(ticks > PX_SYSCLK_SLEEP_TICKS_MAX)
+    {
+        ticks = PX_SYSCLK_SLEEP_TICKS_MAX;
+    }
+    // Calculate number of LPTIM counts (rounded down so that deadline is not missed)
+    counts = (ticks * PX_SYSCLK_LPTIM_HZ) / PX_SYSCLK_CFG_TICKS_PER_SEC;
+    if(counts == 0)
+    {
+        counts = 1;
+    }
+
+    // Start LPTIM1 (compare and auto reload can only be written when enabled)
+    LL_LPTIM_Enable(LPTIM1);
+    LL_LPTIM_ClearFlag_CMPM(LPTIM1);
+    LL_LPTIM_EnableIT_CMPM(LPTIM1);
+    LL_LPTIM_SetAutoReload(LPTIM1, 0xffff);
+    LL_LPTIM_SetCompare(LPTIM1, counts);
+    LL_LPTIM_StartCounter(LPTIM1, LL_LPTIM_OPERATING_MODE_CONTINUOUS);
+
+    // Suppress SysTick interrupt
+    LL_SYSTICK_DisableIT();
+    // Sleep until LPTIM1 compare match (or other interrupt)
+    px_board_stop_mode();
+
+    // Read counter until two consecutive reads match (asynchronous clock)
+    counts = LL_LPTIM_GetCounter(LPTIM1);
+    do
+    {
+        counts_prev = counts;
+        counts      = LL_LPTIM_GetCounter(LPTIM1);
+    }
+    while(counts != counts_prev);
+    // Stop LPTIM1
+    CLEAR_BIT(LPTIM1->CR, LPTIM_CR_ENABLE);
+
+    // Convert counts to ticks and carry fraction over to next sleep
+    counts = counts * PX_SYSCLK_CFG_TICKS_PER_SEC + px_sysclk_sleep_remainder;
+    ticks  = counts / PX_SYSCLK_LPTIM_HZ;
+    px_sysclk_sleep_remainder = counts % PX_SYSCLK_LPTIM_HZ;
+
+    // Compensate tick counter and resume SysTick interrupt
+    px_sysclk_tick_counter += ticks;
+    LL_SYSTICK_EnableIT();
+
+    return ticks;
+}
+#endif
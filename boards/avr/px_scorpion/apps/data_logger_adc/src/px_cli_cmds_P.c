@@ -146,6 +146,8 @@ static const char * px_cli_cmd_log_start_fn(uint8_t argc, char * argv[])
         }
     }
     PX_LED_ON();
+    // Write cached records (if any)
+    px_log_fs_flush(&px_log_fs_handle);
 
     px_adc_stop();
     return NULL;
@@ -120,14 +120,16 @@ static const char * px_cli_cmd_log_start_fn(uint8_t argc, char * argv[])
                 // Has a SPACE been pressed?
                 if(data == ' ')
                 {
-                    // Stop logging
+                    // Stop logging (write cached records, if any)
+                    px_log_fs_flush(&px_log_fs_handle);
                     return NULL;
                 }
             }
             // Button pressed?
             if(PX_PB_IS_PRESSED())
             {
-                // Stop logging
+                // Stop logging (write cached records, if any)
+                px_log_fs_flush(&px_log_fs_handle);
                 return NULL;
             }
         }
@@ -139,6 +141,8 @@ static const char * px_cli_cmd_log_start_fn(uint8_t argc, char * argv[])
         // Perform temperature and pressure measurement
         if(!px_bmp280_rd(&record_data.bmp280_temp, &record_data.bmp280_press))
         {
+            // Stop logging (write cached records, if any)
+            px_log_fs_flush(&px_log_fs_handle);
             return PX_PGM_STR("Error! BMP280 read failed");
         }
         // Display TAB separated data
@@ -136,6 +136,30 @@
     #define PX_ATTR_WEAK
 #endif
 
+/*
+ *  Memory barriers for lock-free data shared between an interrupt handler (or
+ *  another thread) and the main loop, e.g. px_ring_buf:
+ *  - PX_MEM_BARRIER_ACQUIRE() : memory accesses after the barrier are not
+ *    performed before memory reads preceding the barrier.
+ *  - PX_MEM_BARRIER_RELEASE() : memory accesses before the barrier are
+ *    completed before memory writes following the barrier.
+ *
+ *  Both also stop the compiler from reordering memory accesses.
+ */
+#ifndef PX_MEM_BARRIER_ACQUIRE
+#if defined(PX_COMPILER_GCC_AVR)
+    // Single core 8-bit CPU that does not reorder memory accesses
+    #define PX_MEM_BARRIER_ACQUIRE()        __asm__ __volatile__("" ::: "memory")
+    #define PX_MEM_BARRIER_RELEASE()        __asm__ __volatile__("" ::: "memory")
+#elif defined(PX_COMPILER_GCC)
+    #define PX_MEM_BARRIER_ACQUIRE()        __atomic_thread_fence(__ATOMIC_ACQUIRE)
+    #define PX_MEM_BARRIER_RELEASE()        __atomic_thread_fence(__ATOMIC_RELEASE)
+#else
+    #define PX_MEM_BARRIER_ACQUIRE()
+    #define PX_MEM_BARRIER_RELEASE()
+#endif
+#endif
+
 
 /* _____TYPE DEFINITIONS_____________________________________________________ */
 
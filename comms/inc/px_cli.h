@@ -123,6 +123,42 @@
  *  - CMD_LIST_ITEM_LED[1] points to the CMD_LED_OFF cmd structure ("handler" == &led_off_fn)
  *  - CMD_LIST_ITEM_LED[2] marks the end of the array
  *
+ *  ## 3.5 Command index ##
+ *
+ *  By default each list of the command tree is searched item by item with a
+ *  string compare of each name when a command is executed or autocompleted
+ *  with TAB. With many commands this takes time on every ENTER and TAB.
+ *
+ *  If PX_CLI_CFG_INDEX_SIZE is not zero, px_cli_init() builds an index in RAM:
+ *  for each list the items are sorted by name and a jump table records where
+ *  the names with each first character start. A command word is then found
+ *  by looking up its first character and comparing only the names that start
+ *  with it (usually one or two string compares per list). All names that
+ *  start with the typed characters are adjacent in the index, so that TAB
+ *  cycles through them directly (in alphabetical order instead of declaration
+ *  order). A list with N items and D different first characters uses
+ *  2 + 2 * N + 2 * D index entries (uint16_t), at most 2 + 4 * N. If the index
+ *  is too small an error is logged and the CLI falls back to searching each
+ *  list.
+ *
+ *  The index is only supported by 'px_cli.c' (not 'px_cli_P.c').
+ *
+ *  ## 3.6 Output buffer ##
+ *
+ *  By default the CLI writes its output (echo, autocomplete, history recall,
+ *  prompt and help) character by character with putchar() and printf(). Over
+ *  USB CDC this can result in many small packets per key press.
+ *
+ *  If PX_CLI_CFG_WR_BUF_SIZE is not zero, the output of the CLI and of
+ *  @ref PX_VT100 functions is collected in a @ref PX_WR_BUF buffer and written
+ *  with PX_CLI_CFG_WR_BUF_FLUSH() once per received character (or when the
+ *  buffer is full). The buffer is also written before a command handler is
+ *  executed, so that output written by the handler with printf() stays in
+ *  order. The number of bytes and flushes can be read with
+ *  px_cli_get_wr_buf_stats().
+ *
+ *  The output buffer is only supported by 'px_cli.c' (not 'px_cli_P.c').
+ *
  *  @{
  */
 
@@ -148,6 +184,21 @@
      || !defined(PX_CLI_CFG_CHAR_ENTER        )  )
 #error "One or more options not defined in 'px_cli_cfg.h'"
 #endif
+#ifndef PX_CLI_CFG_INDEX_SIZE
+/// Number of command index entries (uint16_t) to sort command names for fast lookup; 0 = disabled
+#define PX_CLI_CFG_INDEX_SIZE 0
+#endif
+#ifndef PX_CLI_CFG_WR_BUF_SIZE
+/// Size of output buffer; 0 = output written directly with putchar() and printf()
+#define PX_CLI_CFG_WR_BUF_SIZE 0
+#endif
+#ifndef PX_CLI_CFG_WR_BUF_FLUSH
+/// Write buffered output
+#define PX_CLI_CFG_WR_BUF_FLUSH(data, nr_of_bytes) fwrite(data, 1, nr_of_bytes, stdout)
+#endif
+#if (PX_CLI_CFG_WR_BUF_SIZE == 1)
+#error "PX_CLI_CFG_WR_BUF_SIZE must be 0 or at least 2"
+#endif
 #if (PX_CLI_CFG_LINE_LENGTH_MAX > 255)
 #error "PX_CLI_CFG_LINE_LENGTH_MAX must be less than 256"
 #endif
@@ -167,6 +218,10 @@
 #error "PX_CLI_CFG_NAME_STR_MAX_SIZE must also be specifed to reduce code size"
 #endif
 
+#if PX_CLI_CFG_WR_BUF_SIZE
+#include "px_wr_buf.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -179,7 +234,8 @@ extern "C" {
  *  @param argc          Number of argument strings
  *  @param argv          Array of pointers to zero terminated argument strings
  *
- *  @return const char * Response string to display; return NULL to display nothing
+ *  @return const char * Response string to display as is (it is not a format
+ *                       string); return NULL to display nothing
  */
 typedef const char * (*px_cli_handler_t)(uint8_t argc, char * argv[]);
 
@@ -253,7 +309,8 @@ extern px_cli_argv_val_t    px_cli_argv_val;
  *  Initialise command line module.
  *
  *  @param cli_cmd_list  Pointer to list of commands created with PX_CLI_CMD_LIST_CREATE() macro
- *  @param startup_str   Startup string to display
+ *  @param startup_str   Startup string to display as is (it is not a format
+ *                       string)
  *
  */
 extern void px_cli_init(const px_cli_cmd_list_item_t * cli_cmd_list, const char * startup_str);
@@ -268,6 +325,20 @@ extern void px_cli_init(const px_cli_cmd_list_item_t * cli_cmd_list, const char
  */
 extern void px_cli_on_rx_char(char data);
 
+#if PX_CLI_CFG_WR_BUF_SIZE
+/**
+ *  Return output buffer statistics (number of bytes and flushes).
+ *
+ *  @return const px_wr_buf_stats_t *   Pointer to statistics
+ */
+extern const px_wr_buf_stats_t * px_cli_get_wr_buf_stats(void);
+
+/**
+ *  Reset output buffer statistics, e.g. before a command is received.
+ */
+extern void px_cli_reset_wr_buf_stats(void);
+#endif
+
 /**
  *  Handler function to call when "help" command is invoked.
  *
@@ -68,5 +68,25 @@
 #define PX_CLI_CFG_CHAR_ENTER          PX_VT100_CHAR_CR
 //#define PX_CLI_CFG_CHAR_ENTER          PX_VT100_CHAR_LF
 
+/**
+ *  Specify number of command index entries to sort command names for fast
+ *  lookup (0 to disable).
+ *
+ *  Each list of N items (commands and groups) uses at most 2 + 4 * N entries.
+ *  Only supported by 'px_cli.c'.
+ */
+#define PX_CLI_CFG_INDEX_SIZE          0
+
+/**
+ *  Specify size of output buffer to write output once per received character
+ *  (0 to write output directly with putchar() and printf()).
+ *
+ *  Only supported by 'px_cli.c'.
+ */
+#define PX_CLI_CFG_WR_BUF_SIZE         0
+
+/// Specify function to write buffered output (if PX_CLI_CFG_WR_BUF_SIZE is not zero)
+#define PX_CLI_CFG_WR_BUF_FLUSH(data, nr_of_bytes) fwrite(data, 1, nr_of_bytes, stdout)
+
 /// @}
 #endif
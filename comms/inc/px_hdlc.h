@@ -67,6 +67,20 @@
  *  function handler if it is known at compile time. This means that 
  *  px_hdlc.c must be modifed to avoid a small processing overhead.
  *  
+ *  Each HDLC link has its own instance (px_hdlc_handle_t) with its own
+ *  receive buffer of #PX_HDLC_MRU bytes, so that more than one link can be
+ *  used at the same time. The instance is passed to the send and receive
+ *  functions, so that one function can serve more than one link. Received
+ *  data can be fed one byte at a time with px_hdlc_on_rx_u8() or in blocks
+ *  with px_hdlc_on_rx_data().
+ *  
+ *  The FCS is calculated with px_crc16_update_data() over the whole frame in
+ *  one call: before the frame is sent and when the closing flag of a received
+ *  frame arrives. The speed of the CRC calculation can thus be traded for
+ *  flash with the table and slice options in 'px_crc16_cfg.h'. Note that
+ *  px_hdlc_on_rx_u8() takes longer on the closing flag, which should be
+ *  considered if it is called from an interrupt handler.
+ *  
  *  Reference:
  *  - [RFC 1662 "PPP in HDLC-like Framing"](http://tools.ietf.org/html/rfc1662)
  *  
@@ -82,59 +96,160 @@
 
 /* _____PROJECT INCLUDES_____________________________________________________ */
 #include "px_defs.h"
+#include "px_ring_buf.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 /* _____DEFINITIONS__________________________________________________________ */
 #ifndef PX_HDLC_MRU
-/// Receive Packet size (Maximum Receive Unit)
+/// Receive Packet size (Maximum Receive Unit) in bytes, including 16-bit FCS
 #define PX_HDLC_MRU    64
 #endif
 
+/// Worst case size of an encoded frame (every byte escaped) including markers
+#define PX_HDLC_TX_BUF_SIZE(nr_of_bytes) (2 * ((nr_of_bytes) + 2) + 2)
+
+#if (PX_HDLC_MRU > 65535)
+#error "PX_HDLC_MRU must be 65535 or less"
+#endif
+
 /* _____TYPE DEFINITIONS_____________________________________________________ */
-/// Definition for a pointer to a function that will be called to send a byte
-typedef void (*px_hdlc_tx_u8_fn_t)(uint8_t data);
+struct px_hdlc_handle_s;
+
+/**
+ *  Definition for a pointer to a function that will be called to send a byte.
+ *
+ *  @param handle   Pointer to HDLC instance that sends the byte
+ *  @param data     Byte to send
+ */
+typedef void (*px_hdlc_tx_u8_fn_t)(struct px_hdlc_handle_s * handle, uint8_t data);
 
 /**
  *  Definition for a pointer to a function that will be called once a frame has
  *  been received.
+ *
+ *  @param handle       Pointer to HDLC instance that received the frame
+ *  @param data         Received frame data (without FCS)
+ *  @param nr_of_bytes  Number of bytes in frame
  */
-typedef void (*px_hdlc_on_rx_frame_fn_t)(const uint8_t * data, size_t nr_of_bytes);
+typedef void (*px_hdlc_on_rx_frame_fn_t)(struct px_hdlc_handle_s * handle,
+                                         const uint8_t *           data,
+                                         size_t                    nr_of_bytes);
+
+/// HDLC instance
+typedef struct px_hdlc_handle_s
+{
+    px_hdlc_tx_u8_fn_t       tx_u8_fn;          ///< Function that will be called to send a byte
+    px_hdlc_on_rx_frame_fn_t on_rx_frame_fn;    ///< Function that will be called when a valid frame is received
+    uint16_t                 rx_frame_index;    ///< Index of next position in receive buffer
+    bool                     rx_overflow_flag;  ///< Receive buffer overflowed; frame will be rejected
+    bool                     rx_esc_flag;       ///< Control escape byte received; next byte must be restored
+    uint8_t                  rx_frame[PX_HDLC_MRU]; ///< Receive buffer (frame including FCS)
+} px_hdlc_handle_t;
 
 /* _____GLOBAL VARIABLES_____________________________________________________ */
 
 /* _____GLOBAL FUNCTION DECLARATIONS_________________________________________ */
 /**
- *  Initialise HDLC encapsulation layer.
+ *  Initialise HDLC encapsulation layer instance.
  *  
+ * @param[in] handle            Pointer to HDLC instance
  * @param[in] tx_u8_fn          Pointer to a function that will be called to 
  *                              send a byte.
  * @param[in] on_rx_frame_fn    Pointer to function that is called when a
  *                              correct frame is received.
  */
-void px_hdlc_init(px_hdlc_tx_u8_fn_t       tx_u8_fn,
+void px_hdlc_init(px_hdlc_handle_t *       handle,
+                  px_hdlc_tx_u8_fn_t       tx_u8_fn,
                   px_hdlc_on_rx_frame_fn_t on_rx_frame_fn);
 
 /**
  *  Function handler that is fed all raw received data.
  *  
+ *  @param[in] handle   Pointer to HDLC instance
  *  @param[in] data     received 8-bit data
  *  
  *  @retval true        Valid HDLC frame has been received
  *  @retval false       Valid HDLC frame has not been received yet
  *  
  */
-bool px_hdlc_on_rx_u8(uint8_t data);
+bool px_hdlc_on_rx_u8(px_hdlc_handle_t * handle, uint8_t data);
+
+/**
+ *  Function handler that is fed a block of raw received data.
+ *  
+ *  Gives the same result as calling px_hdlc_on_rx_u8() for each byte, but
+ *  runs of bytes without flag or control escape bytes are copied into the
+ *  receive buffer in bulk. The received data can thus be processed straight
+ *  from a UART DMA buffer or a ring buffer chunk.
+ *  
+ *  @param[in] handle       Pointer to HDLC instance
+ *  @param[in] data         Buffer containing received data
+ *  @param[in] nr_of_bytes  Number of bytes in buffer
+ *  
+ *  @return size_t          Number of valid HDLC frames received
+ */
+size_t px_hdlc_on_rx_data(px_hdlc_handle_t * handle,
+                          const uint8_t *    data,
+                          size_t             nr_of_bytes);
 
 /**
  *  Encapsulate and send an HDLC frame.
  *  
+ *  @param[in] handle       Pointer to HDLC instance
+ *  @param[in] data         Buffer containing data for transmission
+ *  @param[in] nr_of_bytes  Number of bytes in buffer to be transmitted
+ *  
+ */
+void px_hdlc_tx_frame(px_hdlc_handle_t * handle, const uint8_t * data, size_t nr_of_bytes);
+
+/**
+ *  Encapsulate an HDLC frame into a buffer.
+ *  
+ *  The complete frame (start marker, escaped data, escaped FCS and end marker)
+ *  is written to the buffer so that it can be sent in one go, e.g. with DMA or
+ *  px_uart_wr(). Runs of data that need not be escaped are copied in bulk.
+ *  
+ *  A buffer of PX_HDLC_TX_BUF_SIZE(nr_of_bytes) is always large enough.
+ *  
+ *  No instance is needed, because encoding does not depend on the send
+ *  function or receive state of a link. The encoded frame is valid for any
+ *  link.
+ *  
+ *  @param[in]  data        Buffer containing data for transmission
+ *  @param[in]  nr_of_bytes Number of bytes in buffer to be transmitted
+ *  @param[out] buf         Buffer to store encoded frame in
+ *  @param[in]  buf_size    Size of buffer
+ *  
+ *  @return size_t          Size of encoded frame or 0 if buffer is too small
+ */
+size_t px_hdlc_tx_frame_to_buf(const uint8_t * data,
+                               size_t          nr_of_bytes,
+                               uint8_t *       buf,
+                               size_t          buf_size);
+
+/**
+ *  Encapsulate an HDLC frame into a ring buffer.
+ *  
+ *  The frame is only written if the ring buffer has enough free space for the
+ *  complete encoded frame. Runs of data that need not be escaped are written
+ *  in bulk.
+ *  
+ *  No instance is needed, because the encoded frame is written to the ring
+ *  buffer instead of the send function of a link (see
+ *  px_hdlc_tx_frame_to_buf()).
+ *  
  *  @param[in] data         Buffer containing data for transmission
  *  @param[in] nr_of_bytes  Number of bytes in buffer to be transmitted
+ *  @param[in] ring_buf     Pointer to ring buffer to write encoded frame to
  *  
+ *  @return size_t          Size of encoded frame or 0 if there is not enough
+ *                          space in the ring buffer
  */
-void px_hdlc_tx_frame(const uint8_t * data, size_t nr_of_bytes);
+size_t px_hdlc_tx_frame_to_ring_buf(const uint8_t * data,
+                                    size_t          nr_of_bytes,
+                                    px_ring_buf_t * ring_buf);
 
 /* _____MACROS_______________________________________________________________ */
 
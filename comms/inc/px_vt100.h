@@ -28,6 +28,13 @@
  *  - comms/inc/px_vt100.h
  *  - comms/src/px_vt100.c
  *  
+ *  Output is written with putchar(), unless another function is specified with
+ *  px_vt100_set_putchar() (e.g. to collect it in a @ref PX_WR_BUF buffer).
+ *  Output that is written with printf() at the same time is not collected, so
+ *  the buffer must be flushed and putchar() restored first to keep the order.
+ *  @ref PX_CLI with PX_CLI_CFG_WR_BUF_SIZE does this while a command handler
+ *  runs, so that a handler can mix printf() with px_vt100 functions.
+ *  
  *  @see
  *  - http://en.wikipedia.org/wiki/ANSI_escape_code
  *  - http://www.termsys.demon.co.uk/vtansi.htm
@@ -114,6 +121,9 @@ extern "C" {
 /// @}
 
 /* _____TYPE DEFINITIONS_____________________________________________________ */
+/// Output function used instead of putchar()
+typedef void (*px_vt100_putchar_fn_t)(char data);
+
 /// VT100 Terminal receive state
 typedef enum
 {
@@ -134,6 +144,16 @@ typedef enum
  */
 extern void px_vt100_init(void);
 
+/** 
+ *  Specify function that writes output characters.
+ *  
+ *  Output written with printf() or putchar() does not pass through this
+ *  function and may be written before buffered px_vt100 output.
+ *  
+ *  @param putchar_fn   Output function; NULL to use putchar()
+ */
+extern void px_vt100_set_putchar(px_vt100_putchar_fn_t putchar_fn);
+
 /**
  *  Process a received character byte. 
  *  
@@ -32,7 +32,23 @@
 /* _____LOCAL DEFINITIONS____________________________________________________ */
 PX_LOG_NAME("px_cli");
 
+#if PX_CLI_CFG_INDEX_SIZE
+/// Index position that indicates that no item has been found
+#define PX_CLI_INDEX_NONE 0xffff
+#endif
+
 /* _____MACROS_______________________________________________________________ */
+#if PX_CLI_CFG_WR_BUF_SIZE
+#define PX_CLI_PUTCHAR(data)    px_wr_buf_putchar(&px_cli_wr_buf, data)
+#define PX_CLI_PRINT(str)       px_wr_buf_print(&px_cli_wr_buf, str)
+#define PX_CLI_PUTS(str)        px_wr_buf_puts(&px_cli_wr_buf, str)
+#define PX_CLI_FLUSH()          px_wr_buf_flush(&px_cli_wr_buf)
+#else
+#define PX_CLI_PUTCHAR(data)    putchar(data)
+#define PX_CLI_PRINT(str)       fputs(str, stdout)
+#define PX_CLI_PUTS(str)        puts(str)
+#define PX_CLI_FLUSH()          do { ; } while(0)
+#endif
 
 /* _____GLOBAL VARIABLES_____________________________________________________ */
 /// Converted argument value using px_cli_util_argv_to_...() conversion function
@@ -104,6 +120,45 @@ static const px_cli_cmd_list_item_t * px_cli_tree_path[PX_CLI_CFG_TREE_DEPTH_MAX
 // Tree path depth of current command list item
 static uint8_t px_cli_tree_path_depth;
 
+#if PX_CLI_CFG_INDEX_SIZE
+/**
+ *  Command index.
+ *
+ *  Each list in the command tree has a block in the index:
+ *  - [0]       Number of items (N) in list
+ *  - [1..N]    Array index of each item in list, sorted by name
+ *  - [N+1..2N] Index offset of child list block of each (group) item, in the
+ *              same order
+ *  - [2N+1]    Number of different first characters (D) of names in list
+ *  - [2N+2..]  D pairs of first character and sorted position of first name
+ *              that starts with it (jump table)
+ *
+ *  The block of the root list starts at offset 0.
+ */
+static uint16_t px_cli_index[PX_CLI_CFG_INDEX_SIZE];
+
+/// Number of index entries used
+static uint16_t px_cli_index_used;
+
+/// Index has been built successfully
+static bool     px_cli_index_valid;
+
+/// Index block of current autocomplete list
+static uint16_t px_cli_autocomplete_block;
+
+/// List of current autocomplete list
+static const px_cli_cmd_list_item_t * px_cli_autocomplete_list;
+
+/// Index position of next autocomplete candidate (PX_CLI_INDEX_NONE to start at first match)
+static uint16_t px_cli_autocomplete_pos;
+#endif
+
+#if PX_CLI_CFG_WR_BUF_SIZE
+/// Output buffer
+static px_wr_buf_t px_cli_wr_buf;
+static char        px_cli_wr_buf_data[PX_CLI_CFG_WR_BUF_SIZE];
+#endif
+
 /* _____LOCAL FUNCTION DECLARATIONS__________________________________________ */
 static bool    px_cli_cmd_get_item       (const px_cli_cmd_list_item_t * item);
 static bool    px_cli_cmd_item_get_root  (void);
@@ -123,8 +178,24 @@ static void    px_cli_hist_load_older_cmd(void);
 static void    px_cli_hist_load_newer_cmd(void);
 #endif
 
+#if PX_CLI_CFG_INDEX_SIZE
+static uint16_t px_cli_index_build       (const px_cli_cmd_list_item_t * list);
+static int      px_cli_index_cmp         (const char * name, const char * word, uint8_t len, bool prefix);
+static uint16_t px_cli_index_search      (uint16_t block, const px_cli_cmd_list_item_t * list,
+                                          const char * word, uint8_t len, bool prefix);
+static bool     px_cli_index_cmd_find    (uint8_t argc);
+static bool     px_cli_index_autocomplete(void);
+#endif
+
 static void    px_cli_autocomplete_reset (void);
+static void    px_cli_rx_char_process    (char data);
+
+#if PX_CLI_CFG_WR_BUF_SIZE
+static void    px_cli_wr_buf_flush       (const char * data, size_t nr_of_bytes);
+static void    px_cli_wr_buf_putchar     (char data);
+#endif
 static bool    px_cli_autocomplete       (void);
+static bool    px_cli_cmd_find           (uint8_t argc);
 static void    px_cli_cmd_exe            (void);
 
 /* _____LOCAL FUNCTIONS______________________________________________________ */
@@ -355,7 +426,7 @@ static void px_cli_hist_copy(void)
             break;
         }
         // Send character to terminal
-        putchar(data);
+        PX_CLI_PUTCHAR(data);
         // Copy character to cmd line buffer
         px_cli_line_buf[i++] = data;
         // Next index
@@ -491,6 +562,292 @@ static void px_cli_hist_load_newer_cmd(void)
 }
 #endif
 
+#if PX_CLI_CFG_INDEX_SIZE
+static uint16_t px_cli_index_build(const px_cli_cmd_list_item_t * list)
+{
+    uint16_t     block;
+    uint16_t     n;
+    uint16_t     d;
+    uint16_t     i;
+    uint16_t     j;
+    uint16_t     item_index;
+    uint16_t     child;
+    const char * name;
+    char         first_char;
+
+    // Count number of items in list
+    n = 0;
+    while(list[n].cmd != NULL)
+    {
+        n++;
+    }
+    // Enough space in index?
+    if((px_cli_index_used + 2 + 2 * (uint32_t)n) > PX_CLI_CFG_INDEX_SIZE)
+    {
+        return PX_CLI_INDEX_NONE;
+    }
+    // Reserve block
+    block                 = px_cli_index_used;
+    px_cli_index_used    += 2 + 2 * n;
+    px_cli_index[block]   = n;
+
+    // Insertion sort of items by name
+    for(i = 0; i < n; i++)
+    {
+        name = list[i].cmd->name;
+        j    = i;
+        while((j > 0) && (strcmp(list[px_cli_index[block + j]].cmd->name, name) > 0))
+        {
+            px_cli_index[block + 1 + j] = px_cli_index[block + j];
+            j--;
+        }
+        px_cli_index[block + 1 + j] = i;
+    }
+
+    // Add jump table entry for each different first character
+    d = 0;
+    for(i = 0; i < n; i++)
+    {
+        first_char = list[px_cli_index[block + 1 + i]].cmd->name[0];
+        if((d != 0) && (px_cli_index[px_cli_index_used - 2] == (uint8_t)first_char))
+        {
+            continue;
+        }
+        if((px_cli_index_used + 2) > PX_CLI_CFG_INDEX_SIZE)
+        {
+            return PX_CLI_INDEX_NONE;
+        }
+        px_cli_index[px_cli_index_used++] = (uint8_t)first_char;
+        px_cli_index[px_cli_index_used++] = i;
+        d++;
+    }
+    px_cli_index[block + 1 + 2 * n] = d;
+
+    // Build block of each child list
+    for(i = 0; i < n; i++)
+    {
+        item_index = px_cli_index[block + 1 + i];
+        child      = 0;
+        // Group item?
+        if(list[item_index].handler == NULL)
+        {
+            child = px_cli_index_build(list[item_index].group->list);
+            if(child == PX_CLI_INDEX_NONE)
+            {
+                return PX_CLI_INDEX_NONE;
+            }
+        }
+        px_cli_index[block + 1 + n + i] = child;
+    }
+
+    return block;
+}
+
+static int px_cli_index_cmp(const char * name, const char * word, uint8_t len, bool prefix)
+{
+    int result = 0;
+
+    if(len != 0)
+    {
+        // Compare first character without a string compare
+        result = (int)(uint8_t)name[0] - (int)(uint8_t)word[0];
+        // Compare rest of word
+        if((result == 0) && (len > 1))
+        {
+            result = strncmp(name + 1, word + 1, len - 1);
+        }
+    }
+    // Name longer than word (and not a prefix match)?
+    if((result == 0) && (!prefix) && (name[len] != '\0'))
+    {
+        // Name is after word
+        result = 1;
+    }
+    return result;
+}
+
+static uint16_t px_cli_index_search(uint16_t                       block,
+                                    const px_cli_cmd_list_item_t * list,
+                                    const char *                   word,
+                                    uint8_t                        len,
+                                    bool                           prefix)
+{
+    uint16_t         n    = px_cli_index[block];
+    const uint16_t * jump = &px_cli_index[block + 1 + 2 * n];
+    uint16_t         d    = jump[0];
+    uint16_t         k;
+    uint16_t         pos;
+    uint16_t         end;
+    int              result;
+
+    // Empty word?
+    if(len == 0)
+    {
+        // Only a prefix of the first name
+        return (prefix && (n != 0)) ? 0 : PX_CLI_INDEX_NONE;
+    }
+    // Find first character of word in jump table (sorted)
+    for(k = 0; k < d; k++)
+    {
+        if(jump[1 + 2 * k] >= (uint8_t)word[0])
+        {
+            break;
+        }
+    }
+    if((k == d) || (jump[1 + 2 * k] != (uint8_t)word[0]))
+    {
+        return PX_CLI_INDEX_NONE;
+    }
+    // Range of sorted names that start with the same character
+    pos = jump[2 + 2 * k];
+    end = (k + 1 < d) ? jump[2 + 2 * (k + 1)] : n;
+    // Find first name that is equal or after word
+    while(pos < end)
+    {
+        result = px_cli_index_cmp(list[px_cli_index[block + 1 + pos]].cmd->name, word, len, prefix);
+        if(result == 0)
+        {
+            return pos;
+        }
+        if(result > 0)
+        {
+            break;
+        }
+        pos++;
+    }
+
+    return PX_CLI_INDEX_NONE;
+}
+
+static bool px_cli_index_cmd_find(uint8_t argc)
+{
+    uint16_t                       block = 0;
+    uint16_t                       pos;
+    const px_cli_cmd_list_item_t * list;
+    const char *                   word;
+
+    px_cli_cmd_item_get_root();
+    while(true)
+    {
+        // Not enough arguments?
+        if(px_cli_tree_path_depth >= argc)
+        {
+            return false;
+        }
+        // Find argument in sorted list
+        list = px_cli_tree_path[px_cli_tree_path_depth];
+        word = px_cli_argv[px_cli_tree_path_depth];
+        pos  = px_cli_index_search(block, list, word, strlen(word), false);
+        if(pos == PX_CLI_INDEX_NONE)
+        {
+            return false;
+        }
+        // Select item
+        px_cli_tree_path[px_cli_tree_path_depth] = &list[px_cli_index[block + 1 + pos]];
+        px_cli_cmd_get_item(px_cli_tree_path[px_cli_tree_path_depth]);
+        // Is this a command item?
+        if(px_cli_cmd_list_item->handler != NULL)
+        {
+            // Command match
+            return true;
+        }
+        // Group item match... proceed to child list
+        if(!px_cli_cmd_item_get_child())
+        {
+            return false;
+        }
+        block = px_cli_index[block + 1 + px_cli_index[block] + pos];
+    }
+}
+
+static bool px_cli_index_autocomplete(void)
+{
+    uint8_t                        i;
+    uint8_t                        j;
+    uint16_t                       n;
+    uint16_t                       pos;
+    const px_cli_cmd_list_item_t * item;
+    const char *                   name;
+
+    // Descend into group(s) for each complete word (followed by a space)
+    i = px_cli_autocomplete_start_index;
+    while(true)
+    {
+        // Find end of word
+        j = i;
+        while((j < px_cli_autocomplete_end_index) && (px_cli_line_buf[j] != ' '))
+        {
+            j++;
+        }
+        // Last (partial) word?
+        if(j >= px_cli_autocomplete_end_index)
+        {
+            break;
+        }
+        // Find group with exact name
+        pos = px_cli_index_search(px_cli_autocomplete_block, px_cli_autocomplete_list,
+                                  &px_cli_line_buf[i], j - i, false);
+        if(pos == PX_CLI_INDEX_NONE)
+        {
+            return false;
+        }
+        n    = px_cli_index[px_cli_autocomplete_block];
+        item = &px_cli_autocomplete_list[px_cli_index[px_cli_autocomplete_block + 1 + pos]];
+        if(item->handler != NULL)
+        {
+            // This is a command item... no match
+            return false;
+        }
+        // Proceed to child list
+        px_cli_autocomplete_list        = item->group->list;
+        px_cli_autocomplete_block       = px_cli_index[px_cli_autocomplete_block + 1 + n + pos];
+        px_cli_autocomplete_pos         = PX_CLI_INDEX_NONE;
+        // Set start index to start of child command
+        i                               = j + 1;
+        px_cli_autocomplete_start_index = i;
+    }
+
+    // Next candidate that starts with the partial word
+    n   = px_cli_index[px_cli_autocomplete_block];
+    pos = px_cli_autocomplete_pos;
+    if(  (pos >= n)
+       ||(px_cli_index_cmp(px_cli_autocomplete_list[px_cli_index[px_cli_autocomplete_block + 1 + pos]].cmd->name,
+                           &px_cli_line_buf[i], j - i, true) != 0)  )
+    {
+        // Start at first candidate
+        pos = px_cli_index_search(px_cli_autocomplete_block, px_cli_autocomplete_list,
+                                  &px_cli_line_buf[i], j - i, true);
+        if(pos == PX_CLI_INDEX_NONE)
+        {
+            return false;
+        }
+    }
+    px_cli_autocomplete_pos = pos + 1;
+
+    // Autocomplete rest of name
+    name = px_cli_autocomplete_list[px_cli_index[px_cli_autocomplete_block + 1 + pos]].cmd->name + (j - i);
+    px_vt100_del_chars(px_cli_line_buf_index - px_cli_autocomplete_end_index);
+    i = j;
+    while(true)
+    {
+        char name_char = *name++;
+        if(name_char == '\0')
+        {
+            break;
+        }
+        if(i >= (PX_CLI_CFG_LINE_LENGTH_MAX - 1))
+        {
+            break;
+        }
+        px_cli_line_buf[i++] = name_char;
+        PX_CLI_PUTCHAR(name_char);
+    }
+    px_cli_line_buf_index = i;
+
+    return true;
+}
+#endif
+
 static void px_cli_autocomplete_reset(void)
 {
     // Reset autocomplete to last typed character
@@ -499,6 +856,12 @@ static void px_cli_autocomplete_reset(void)
 
     // Start at first item in root list
     px_cli_cmd_item_get_root();
+
+#if PX_CLI_CFG_INDEX_SIZE
+    px_cli_autocomplete_block = 0;
+    px_cli_autocomplete_list  = px_cli_cmd_list;
+    px_cli_autocomplete_pos   = PX_CLI_INDEX_NONE;
+#endif
 }
 
 static bool px_cli_autocomplete(void)
@@ -507,6 +870,14 @@ static bool px_cli_autocomplete(void)
     const char *                   name;
     const px_cli_cmd_list_item_t * cmd_start = px_cli_tree_path[px_cli_tree_path_depth];
 
+#if PX_CLI_CFG_INDEX_SIZE
+    // Use index?
+    if(px_cli_index_valid)
+    {
+        return px_cli_index_autocomplete();
+    }
+#endif
+
     i = px_cli_autocomplete_start_index;
     while(true)
     {
@@ -587,7 +958,7 @@ static bool px_cli_autocomplete(void)
             break;
         }
         px_cli_line_buf[i++] = name_char;
-        putchar(name_char);
+        PX_CLI_PUTCHAR(name_char);
     }
     px_cli_line_buf_index = i;
 
@@ -601,29 +972,15 @@ static bool px_cli_autocomplete(void)
     return true;
 }
 
-static void px_cli_cmd_exe(void)
+static bool px_cli_cmd_find(uint8_t argc)
 {
-    uint8_t      argc;
-    char **      argv;
-    const char * report_str;
-
-    /*
-       Break command line string up into separate words:
-       Array of pointers to zero terminated strings
-     */
-    argc = px_cli_cmd_line_to_args();
-
-    // Ignore empty command
-    if(argc == 0)
-    {
-        return;
-    }
-
-    // Ignore command starting with a hash (#) as it is regarded as a comment
-    if(px_cli_argv[0][0] == '#')
+#if PX_CLI_CFG_INDEX_SIZE
+    // Use index?
+    if(px_cli_index_valid)
     {
-        return;
+        return px_cli_index_cmd_find(argc);
     }
+#endif
 
     // Find command in command list
     px_cli_cmd_item_get_root();
@@ -634,8 +991,7 @@ static void px_cli_cmd_exe(void)
            ||(px_cli_tree_path_depth    >= argc)  )
         {
             // Command not found in list
-            puts("Error! Command not found");
-            return;
+            return false;
         }
 
         // Does the argument match the command string?
@@ -645,7 +1001,7 @@ static void px_cli_cmd_exe(void)
             if(px_cli_cmd_list_item->handler != NULL)
             {
                 // Command match
-                break;
+                return true;
             }
             else
             {
@@ -659,6 +1015,39 @@ static void px_cli_cmd_exe(void)
             px_cli_cmd_item_get_next();
         }
     }
+}
+
+static void px_cli_cmd_exe(void)
+{
+    uint8_t      argc;
+    char **      argv;
+    const char * report_str;
+
+    /*
+       Break command line string up into separate words:
+       Array of pointers to zero terminated strings
+     */
+    argc = px_cli_cmd_line_to_args();
+
+    // Ignore empty command
+    if(argc == 0)
+    {
+        return;
+    }
+
+    // Ignore command starting with a hash (#) as it is regarded as a comment
+    if(px_cli_argv[0][0] == '#')
+    {
+        return;
+    }
+
+    // Find command in command list
+    if(!px_cli_cmd_find(argc))
+    {
+        // Command not found in list
+        PX_CLI_PUTS("Error! Command not found");
+        return;
+    }
 
     // Remove command argument(s)
     argc -= (px_cli_tree_path_depth + 1);
@@ -668,89 +1057,41 @@ static void px_cli_cmd_exe(void)
     if(  (argc < px_cli_cmd_list_item->cmd->argc_min)
        ||(argc > px_cli_cmd_list_item->cmd->argc_max)  )
     {
-        puts("Error! Number of parameters wrong");
+        PX_CLI_PUTS("Error! Number of parameters wrong");
         return;
     }
 
 #if PX_CLI_CFG_COLOR
     // Set font color to green
-    printf(PX_VT100_FG_GREEN);
+    PX_CLI_PRINT(PX_VT100_FG_GREEN);
+#endif
+
+    // Write buffered output before command writes its own output
+    PX_CLI_FLUSH();
+#if PX_CLI_CFG_WR_BUF_SIZE
+    // Command output with px_vt100 functions must stay in order with printf()
+    px_vt100_set_putchar(NULL);
 #endif
 
     // Execute command with parameters
     report_str = (*(px_cli_cmd_list_item->handler))(argc, argv);
 
+#if PX_CLI_CFG_WR_BUF_SIZE
+    // Buffer output of px_vt100 functions again
+    px_vt100_set_putchar(px_cli_wr_buf_putchar);
+#endif
+
     // Did handler report a string to display?
     if(report_str != NULL)
     {
         // Display string
-        printf(report_str);
+        PX_CLI_PRINT(report_str);
         // Append newline character
-        putchar('\n');
+        PX_CLI_PUTCHAR('\n');
     }
 }
 
-/* _____GLOBAL FUNCTIONS_____________________________________________________ */
-void px_cli_init(const px_cli_cmd_list_item_t * cli_cmd_list, const char * startup_str)
-{
-#if PX_CLI_CFG_HISTORY_SIZE
-    px_cli_hist_size_t i;
-
-    // Clear history buffer
-    for(i = 0; i < PX_CLI_CFG_HISTORY_SIZE; i++)
-    {
-        px_cli_hist_circ_buf[i] = '\0';
-    }
-    px_cli_hist_index_last = 0;
-    px_cli_hist_index_now  = 0;
-#endif
-
-    // Save pointer to root of command list
-    PX_LOG_ASSERT(cli_cmd_list != NULL);
-    px_cli_cmd_list = cli_cmd_list;
-
-    // Reset
-    px_cli_line_buf_index = 0;
-    px_cli_autocomplete_reset();
-
-    // Reset Terminal
-    px_vt100_init();
-
-    // Display startup string
-    if(startup_str != NULL)
-    {
-        printf(startup_str);
-    }
-
-#if PX_CLI_CFG_COLOR
-    // Set font color to green
-    printf(PX_VT100_FG_GREEN);
-#endif
-
-    // Display start up help advice
-#if PX_CLI_CFG_DISP_HELP_STR
-    printf("Type 'help' to get list of cmds with help descriptions\n\n"
-#else
-    printf("Type 'help' to get list of cmds\n\n"
-#endif
-           "TAB   to cycle/autocomplete cmd(s)\n"
-#if PX_CLI_CFG_HISTORY_SIZE
-           "UP/DN to recall old cmds in history\n"
-#endif
-           "ENTER to execute cmd\n"
-           "<...> are required parameters\n"
-           "[...] are optional parameters\n\n");
-
-#if PX_CLI_CFG_COLOR
-    // Restore font color
-    printf(PX_VT100_ATTR_RST);
-#endif
-
-    // Display prompt
-    putchar('>');
-}
-
-void px_cli_on_rx_char(char data)
+static void px_cli_rx_char_process(char data)
 {
     // Process received character to detect ANSI Escape Sequences
     switch(px_vt100_on_rx_char(data))
@@ -761,7 +1102,7 @@ void px_cli_on_rx_char(char data)
         // ENTER has been pressed
         case PX_CLI_CFG_CHAR_ENTER:
             // Terminate line
-            putchar('\n');
+            PX_CLI_PUTCHAR('\n');
 #if PX_CLI_CFG_HISTORY_SIZE
             // Save command
             px_cli_hist_save_cmd();
@@ -774,10 +1115,10 @@ void px_cli_on_rx_char(char data)
             px_cli_autocomplete_reset();
 #if PX_CLI_CFG_COLOR
             // Restore font color
-            printf(PX_VT100_ATTR_RST);
+            PX_CLI_PRINT(PX_VT100_ATTR_RST);
 #endif
             // Display prompt
-            putchar('>');
+            PX_CLI_PUTCHAR('>');
             return;
 
         // BACK SPACE has been pressed
@@ -795,7 +1136,7 @@ void px_cli_on_rx_char(char data)
             else
             {
                 // No characters to delete
-                putchar(PX_VT100_CHAR_BEL);
+                PX_CLI_PUTCHAR(PX_VT100_CHAR_BEL);
             }
             return;
 
@@ -804,7 +1145,7 @@ void px_cli_on_rx_char(char data)
             if(!px_cli_autocomplete())
             {
                 // Autocomplete failed
-                putchar(PX_VT100_CHAR_BEL);
+                PX_CLI_PUTCHAR(PX_VT100_CHAR_BEL);
             }
             return;
 
@@ -826,13 +1167,13 @@ void px_cli_on_rx_char(char data)
             px_cli_autocomplete_reset();
 #if PX_CLI_CFG_ECHO_CHARS
             // Echo character
-            putchar(data);
+            PX_CLI_PUTCHAR(data);
 #endif
         }
         else
         {
             // Buffer full
-            putchar(PX_VT100_CHAR_BEL);
+            PX_CLI_PUTCHAR(PX_VT100_CHAR_BEL);
         }
         return;
 
@@ -859,6 +1200,123 @@ void px_cli_on_rx_char(char data)
     }
 }
 
+#if PX_CLI_CFG_WR_BUF_SIZE
+static void px_cli_wr_buf_flush(const char * data, size_t nr_of_bytes)
+{
+    PX_CLI_CFG_WR_BUF_FLUSH(data, nr_of_bytes);
+}
+
+static void px_cli_wr_buf_putchar(char data)
+{
+    px_wr_buf_putchar(&px_cli_wr_buf, data);
+}
+#endif
+
+/* _____GLOBAL FUNCTIONS_____________________________________________________ */
+void px_cli_init(const px_cli_cmd_list_item_t * cli_cmd_list, const char * startup_str)
+{
+#if PX_CLI_CFG_HISTORY_SIZE
+    px_cli_hist_size_t i;
+
+    // Clear history buffer
+    for(i = 0; i < PX_CLI_CFG_HISTORY_SIZE; i++)
+    {
+        px_cli_hist_circ_buf[i] = '\0';
+    }
+    px_cli_hist_index_last = 0;
+    px_cli_hist_index_now  = 0;
+#endif
+
+    // Save pointer to root of command list
+    PX_LOG_ASSERT(cli_cmd_list != NULL);
+    px_cli_cmd_list = cli_cmd_list;
+
+#if PX_CLI_CFG_INDEX_SIZE
+    // Build command index
+    px_cli_index_used  = 0;
+    px_cli_index_valid = (px_cli_index_build(cli_cmd_list) != PX_CLI_INDEX_NONE);
+    if(!px_cli_index_valid)
+    {
+        PX_LOG_E("PX_CLI_CFG_INDEX_SIZE too small");
+    }
+    PX_LOG_D("Index entries used = %u", px_cli_index_used);
+#endif
+
+    // Reset
+    px_cli_line_buf_index = 0;
+    px_cli_autocomplete_reset();
+
+#if PX_CLI_CFG_WR_BUF_SIZE
+    // Reset Terminal directly (it waits for terminal to reset)
+    px_vt100_set_putchar(NULL);
+#endif
+    // Reset Terminal
+    px_vt100_init();
+
+#if PX_CLI_CFG_WR_BUF_SIZE
+    // Buffer output (also output of px_vt100 functions)
+    px_wr_buf_init(&px_cli_wr_buf,
+                   px_cli_wr_buf_data,
+                   PX_CLI_CFG_WR_BUF_SIZE,
+                   px_cli_wr_buf_flush);
+    px_vt100_set_putchar(px_cli_wr_buf_putchar);
+#endif
+
+    // Display startup string
+    if(startup_str != NULL)
+    {
+        PX_CLI_PRINT(startup_str);
+    }
+
+#if PX_CLI_CFG_COLOR
+    // Set font color to green
+    PX_CLI_PRINT(PX_VT100_FG_GREEN);
+#endif
+
+    // Display start up help advice
+#if PX_CLI_CFG_DISP_HELP_STR
+    PX_CLI_PRINT("Type 'help' to get list of cmds with help descriptions\n\n"
+#else
+    PX_CLI_PRINT("Type 'help' to get list of cmds\n\n"
+#endif
+           "TAB   to cycle/autocomplete cmd(s)\n"
+#if PX_CLI_CFG_HISTORY_SIZE
+           "UP/DN to recall old cmds in history\n"
+#endif
+           "ENTER to execute cmd\n"
+           "<...> are required parameters\n"
+           "[...] are optional parameters\n\n");
+
+#if PX_CLI_CFG_COLOR
+    // Restore font color
+    PX_CLI_PRINT(PX_VT100_ATTR_RST);
+#endif
+
+    // Display prompt
+    PX_CLI_PUTCHAR('>');
+    PX_CLI_FLUSH();
+}
+
+void px_cli_on_rx_char(char data)
+{
+    // Process received character
+    px_cli_rx_char_process(data);
+    // Write output of received character in one block
+    PX_CLI_FLUSH();
+}
+
+#if PX_CLI_CFG_WR_BUF_SIZE
+const px_wr_buf_stats_t * px_cli_get_wr_buf_stats(void)
+{
+    return px_wr_buf_get_stats(&px_cli_wr_buf);
+}
+
+void px_cli_reset_wr_buf_stats(void)
+{
+    px_wr_buf_reset_stats(&px_cli_wr_buf);
+}
+#endif
+
 const char * px_cli_cmd_help_fn(uint8_t argc, char * argv[])
 {
     uint8_t i;
@@ -966,7 +1424,7 @@ const char * px_cli_cmd_help_fn(uint8_t argc, char * argv[])
                 if(  (argc == 0) && (line_break)  )
                 {
                     line_break = false;
-                    putchar('\n');
+                    PX_CLI_PUTCHAR('\n');
                 }
 
                 // Display all command strings
@@ -975,32 +1433,36 @@ const char * px_cli_cmd_help_fn(uint8_t argc, char * argv[])
                 {
                     // Display name
                     px_cli_cmd_get_item(px_cli_tree_path[i]);
-                    printf(px_cli_cmd_list_item->cmd->name);
-                    putchar(' ');
+                    PX_CLI_PRINT(px_cli_cmd_list_item->cmd->name);
+                    PX_CLI_PUTCHAR(' ');
                     len += strlen(px_cli_cmd_list_item->cmd->name) + 1;
                 }
 
                 // Adjust column
                 for(i = len; i < name_char_cnt; i++)
                 {
-                    putchar(' ');
+                    PX_CLI_PUTCHAR(' ');
                 }
 
                 // Display param
-                printf(px_cli_cmd_list_item->cmd->param);
+                PX_CLI_PRINT(px_cli_cmd_list_item->cmd->param);
 #if PX_CLI_CFG_DISP_HELP_STR
                 // Adjust column
                 len = strlen(px_cli_cmd_list_item->cmd->param);
                 for(i = len; i < param_char_cnt; i++)
                 {
-                    putchar(' ');
+                    PX_CLI_PUTCHAR(' ');
                 }
 
+#if PX_CLI_CFG_WR_BUF_SIZE
+                PX_CLI_PRINT(" : ");
+#else
                 PX_PRINTF_P(" : ");
+#endif
                 // Display help string
-                printf(px_cli_cmd_list_item->cmd->help);
+                PX_CLI_PRINT(px_cli_cmd_list_item->cmd->help);
 #endif
-                putchar('\n');
+                PX_CLI_PUTCHAR('\n');
             }
 
             // Next item in list
@@ -1014,6 +1476,8 @@ const char * px_cli_cmd_help_fn(uint8_t argc, char * argv[])
             line_break = true;
         }
     }
+    // Write buffered output in case handler is called by another command
+    PX_CLI_FLUSH();
 
     return NULL;
 }
@@ -29,6 +29,13 @@
 /* _____LOCAL DEFINITIONS____________________________________________________ */
 PX_LOG_NAME("px_cli_P");
 
+#if PX_CLI_CFG_INDEX_SIZE
+#warning "PX_CLI_CFG_INDEX_SIZE ignored. Command index is only supported by 'px_cli.c'"
+#endif
+#if PX_CLI_CFG_WR_BUF_SIZE
+#warning "PX_CLI_CFG_WR_BUF_SIZE ignored. Output buffer is only supported by 'px_cli.c'"
+#endif
+
 /* _____MACROS_______________________________________________________________ */
 
 /* _____GLOBAL VARIABLES_____________________________________________________ */
@@ -16,6 +16,9 @@
 
 ============================================================================= */
 
+/* _____STANDARD INCLUDES____________________________________________________ */
+#include <string.h>
+
 /* _____PROJECT INCLUDES_____________________________________________________ */
 #include "px_hdlc.h"
 #include "px_crc16.h"
@@ -29,139 +32,347 @@ PX_LOG_NAME("px_hdlc");
 #define PX_HDLC_CONTROL_ESCAPE 0x7d   // Asynchronous Control Escape
 #define PX_HDLC_ESCAPE_BIT     0x20   // Asynchronous transparency modifier
 
+/// 32-bit word with each byte set to the specified value
+#define PX_HDLC_U32_BYTES(data) ((uint32_t)(data) * 0x01010101ul)
+
 /* _____MACROS_______________________________________________________________ */
 
 /* _____LOCAL VARIABLES______________________________________________________ */
-static uint8_t  px_hdlc_rx_frame[PX_HDLC_MRU];
-static uint8_t  px_hdlc_rx_frame_index;
-static uint16_t px_hdlc_rx_frame_fcs;
-static bool     px_hdlc_rx_esc_flag;
-
-/// Pointer to the function that will be called to send a character
-static px_hdlc_tx_u8_fn_t px_hdlc_tx_u8_fn;
-
-/// Pointer to the function that will be called to process a received HDLC frame
-static px_hdlc_on_rx_frame_fn_t px_hdlc_on_rx_frame_fn;
 
 /* _____LOCAL FUNCTION DECLARATIONS__________________________________________ */
 
 /* _____LOCAL FUNCTIONS______________________________________________________ */
 /// Function to send a byte
-static void px_hdlc_tx_u8(uint8_t data)
+static void px_hdlc_tx_u8(px_hdlc_handle_t * handle, uint8_t data)
 {
     // Call provided function
-    (*px_hdlc_tx_u8_fn)(data);
+    (*handle->tx_u8_fn)(handle, data);
 }
 
 /// Function to send an escaped byte
-static void px_hdlc_esc_tx_u8(uint8_t data)
+static void px_hdlc_esc_tx_u8(px_hdlc_handle_t * handle, uint8_t data)
 {
     // See if data should be escaped
     if((data == PX_HDLC_CONTROL_ESCAPE) || (data == PX_HDLC_FLAG_SEQUENCE))
     {
         // Send control escape byte
-        px_hdlc_tx_u8(PX_HDLC_CONTROL_ESCAPE);
+        px_hdlc_tx_u8(handle, PX_HDLC_CONTROL_ESCAPE);
         // Toggle escape bit
         data ^= PX_HDLC_ESCAPE_BIT;
     }
     // Send data
-    px_hdlc_tx_u8(data);
+    px_hdlc_tx_u8(handle, data);
+}
+
+/// Test if a byte must be escaped (0x7D or 0x7E) with a single compare
+static inline bool px_hdlc_is_esc_u8(uint8_t data)
+{
+    return ((uint8_t)(data - PX_HDLC_CONTROL_ESCAPE) <= (PX_HDLC_FLAG_SEQUENCE - PX_HDLC_CONTROL_ESCAPE));
+}
+
+/// Test if any byte in a 32-bit word must be escaped (0x7D or 0x7E)
+static inline bool px_hdlc_is_esc_u32(uint32_t data)
+{
+    // Bytes that match are zero after XOR
+    uint32_t esc  = data ^ PX_HDLC_U32_BYTES(PX_HDLC_CONTROL_ESCAPE);
+    uint32_t flag = data ^ PX_HDLC_U32_BYTES(PX_HDLC_FLAG_SEQUENCE);
+
+    // Is there a zero byte in either word?
+    return (  (  ((esc  - PX_HDLC_U32_BYTES(0x01)) & ~esc )
+               | ((flag - PX_HDLC_U32_BYTES(0x01)) & ~flag)  )
+            & PX_HDLC_U32_BYTES(0x80)                           ) != 0;
+}
+
+/// Return number of bytes at the start of the data that need not be escaped
+static size_t px_hdlc_unesc_run_len(const uint8_t * data, size_t nr_of_bytes)
+{
+    const uint8_t * data_start = data;
+    uint32_t        data_u32;
+
+    // Skip a word at a time until a word contains a byte that must be escaped
+    while(nr_of_bytes >= sizeof(data_u32))
+    {
+        // Unaligned load
+        memcpy(&data_u32, data, sizeof(data_u32));
+        if(px_hdlc_is_esc_u32(data_u32))
+        {
+            break;
+        }
+        data        += sizeof(data_u32);
+        nr_of_bytes -= sizeof(data_u32);
+    }
+    // Find byte that must be escaped in rest of data
+    while((nr_of_bytes != 0) && !px_hdlc_is_esc_u8(*data))
+    {
+        data++;
+        nr_of_bytes--;
+    }
+    return (size_t)(data - data_start);
+}
+
+/// Return number of bytes after data has been escaped
+static size_t px_hdlc_esc_len(const uint8_t * data, size_t nr_of_bytes)
+{
+    size_t len = nr_of_bytes;
+    size_t run_len;
+
+    while(nr_of_bytes != 0)
+    {
+        // Skip run of bytes that need not be escaped
+        run_len      = px_hdlc_unesc_run_len(data, nr_of_bytes);
+        data        += run_len;
+        nr_of_bytes -= run_len;
+        if(nr_of_bytes == 0)
+        {
+            break;
+        }
+        // Escaped byte is sent as two bytes
+        len++;
+        data++;
+        nr_of_bytes--;
+    }
+    return len;
+}
+
+/**
+ *  Copy escaped data to buffer; unescaped runs are copied in bulk.
+ *
+ *  @return uint8_t *   Pointer to next position in buffer or NULL if the
+ *                      buffer is too small
+ */
+static uint8_t * px_hdlc_esc_wr_buf(uint8_t *       buf,
+                                    const uint8_t * buf_end,
+                                    const uint8_t * data,
+                                    size_t          nr_of_bytes)
+{
+    size_t run_len;
+
+    while(nr_of_bytes != 0)
+    {
+        // Copy run of bytes that need not be escaped
+        run_len = px_hdlc_unesc_run_len(data, nr_of_bytes);
+        if(run_len > (size_t)(buf_end - buf))
+        {
+            return NULL;
+        }
+        memcpy(buf, data, run_len);
+        buf         += run_len;
+        data        += run_len;
+        nr_of_bytes -= run_len;
+        if(nr_of_bytes == 0)
+        {
+            break;
+        }
+        // Escape byte
+        if((buf_end - buf) < 2)
+        {
+            return NULL;
+        }
+        *buf++ = PX_HDLC_CONTROL_ESCAPE;
+        *buf++ = *data++ ^ PX_HDLC_ESCAPE_BIT;
+        nr_of_bytes--;
+    }
+    return buf;
+}
+
+/// Write escaped data to ring buffer (caller checks that there is enough space)
+static void px_hdlc_esc_wr_ring_buf(px_ring_buf_t * ring_buf,
+                                    const uint8_t * data,
+                                    size_t          nr_of_bytes)
+{
+    size_t  run_len;
+    uint8_t esc_data[2];
+
+    while(nr_of_bytes != 0)
+    {
+        // Write run of bytes that need not be escaped
+        run_len = px_hdlc_unesc_run_len(data, nr_of_bytes);
+        px_ring_buf_wr(ring_buf, data, run_len);
+        data        += run_len;
+        nr_of_bytes -= run_len;
+        if(nr_of_bytes == 0)
+        {
+            break;
+        }
+        // Escape byte
+        esc_data[0] = PX_HDLC_CONTROL_ESCAPE;
+        esc_data[1] = *data++ ^ PX_HDLC_ESCAPE_BIT;
+        px_ring_buf_wr(ring_buf, esc_data, 2);
+        nr_of_bytes--;
+    }
+}
+
+/// Calculate inverted FCS over frame data and store it in transmit order
+static void px_hdlc_fcs_calc(uint8_t fcs_data[2], const uint8_t * data, size_t nr_of_bytes)
+{
+    uint16_t fcs;
+
+    fcs         = px_crc16_update_data(PX_CRC16_INIT_VAL, data, nr_of_bytes);
+    fcs        ^= 0xffff;
+    fcs_data[0] = PX_U16_LO8(fcs);
+    fcs_data[1] = PX_U16_HI8(fcs);
+}
+
+/// Store run of received data that need not be unescaped
+static void px_hdlc_rx_store(px_hdlc_handle_t * handle,
+                             const uint8_t *    data,
+                             size_t             nr_of_bytes)
+{
+    size_t len;
+
+    while(nr_of_bytes != 0)
+    {
+        // Copy as much as fits in the remainder of the buffer
+        len = PX_HDLC_MRU - handle->rx_frame_index;
+        if(len > nr_of_bytes)
+        {
+            len = nr_of_bytes;
+        }
+        memcpy(&handle->rx_frame[handle->rx_frame_index], data, len);
+        handle->rx_frame_index += len;
+        data                   += len;
+        nr_of_bytes            -= len;
+
+        // Check for buffer overflow
+        if(handle->rx_frame_index >= PX_HDLC_MRU)
+        {
+            // Wrap index
+            handle->rx_frame_index   = 0;
+            // Set flag so that packet will be rejected
+            handle->rx_overflow_flag = true;
+        }
+    }
 }
 
 /* _____GLOBAL FUNCTIONS_____________________________________________________ */
-void px_hdlc_init(px_hdlc_tx_u8_fn_t       tx_u8_fn,
+void px_hdlc_init(px_hdlc_handle_t *       handle,
+                  px_hdlc_tx_u8_fn_t       tx_u8_fn,
                   px_hdlc_on_rx_frame_fn_t on_rx_frame_fn)
 {
-    px_hdlc_rx_frame_index = 0;
-    px_hdlc_rx_frame_fcs   = PX_CRC16_INIT_VAL;
-    px_hdlc_rx_esc_flag    = false;
-    px_hdlc_tx_u8_fn       = tx_u8_fn;
-    px_hdlc_on_rx_frame_fn = on_rx_frame_fn;
+    handle->rx_frame_index   = 0;
+    handle->rx_overflow_flag = false;
+    handle->rx_esc_flag      = false;
+    handle->tx_u8_fn         = tx_u8_fn;
+    handle->on_rx_frame_fn   = on_rx_frame_fn;
 
     px_crc16_init();
 }
 
-bool px_hdlc_on_rx_u8(uint8_t data)
+bool px_hdlc_on_rx_u8(px_hdlc_handle_t * handle, uint8_t data)
 {
     // Start/End sequence?
     if(data == PX_HDLC_FLAG_SEQUENCE)
     {
         // If Escape sequence + End sequence is received then this packet must 
         // be silently discarded.
-        if(px_hdlc_rx_esc_flag == true)
+        if(handle->rx_esc_flag == true)
         {
             // Reset flag
-            px_hdlc_rx_esc_flag = false;
+            handle->rx_esc_flag = false;
         }
-        // Minimum requirement for a valid frame is reception of good FCS
-        else if(  (px_hdlc_rx_frame_index >= sizeof(px_hdlc_rx_frame_fcs)) 
-                &&(px_hdlc_rx_frame_fcs   == PX_CRC16_MAGIC_VAL          )  )
+        // Minimum requirement for a valid frame is reception of good FCS.
+        // FCS is calculated over the whole buffered frame in one call.
+        else if(  (handle->rx_frame_index   >= sizeof(uint16_t))
+                &&(handle->rx_overflow_flag == false           )
+                &&(   px_crc16_update_data(PX_CRC16_INIT_VAL, handle->rx_frame, handle->rx_frame_index)
+                   == PX_CRC16_MAGIC_VAL                                                              )  )
         {
             // Pass on frame with FCS field removed
-            (*px_hdlc_on_rx_frame_fn)(px_hdlc_rx_frame, px_hdlc_rx_frame_index - sizeof(px_hdlc_rx_frame_fcs));
+            (*handle->on_rx_frame_fn)(handle, handle->rx_frame, handle->rx_frame_index - sizeof(uint16_t));
             // Reset for next packet
-            px_hdlc_rx_frame_index = 0;
-            px_hdlc_rx_frame_fcs   = PX_CRC16_INIT_VAL;
+            handle->rx_frame_index = 0;
             return true;
         }
         // Reset for next packet
-        px_hdlc_rx_frame_index = 0;
-        px_hdlc_rx_frame_fcs   = PX_CRC16_INIT_VAL;
+        handle->rx_frame_index   = 0;
+        handle->rx_overflow_flag = false;
         return false;
     }
 
     // Escape sequence processing?
-    if(px_hdlc_rx_esc_flag)
+    if(handle->rx_esc_flag)
     {
         // Reset flag
-        px_hdlc_rx_esc_flag  = false;
+        handle->rx_esc_flag = false;
         // Toggle escape bit to restore data to correct state
         data ^= PX_HDLC_ESCAPE_BIT;
     }
     else if(data == PX_HDLC_CONTROL_ESCAPE)
     {
         // Set flag to indicate that the next byte's escape bit must be toggled
-        px_hdlc_rx_esc_flag = true;
+        handle->rx_esc_flag = true;
         // Discard control escape byte (do not buffer it)
         return false;
     }
 
     // Store received data
-    px_hdlc_rx_frame[px_hdlc_rx_frame_index] = data;
-    // Update checksum
-    px_hdlc_rx_frame_fcs = px_crc16_update_u8(px_hdlc_rx_frame_fcs, data);
+    handle->rx_frame[handle->rx_frame_index] = data;
     // Advance to next position in buffer
-    px_hdlc_rx_frame_index++;
+    handle->rx_frame_index++;
 
     // Check for buffer overflow
-    if(px_hdlc_rx_frame_index >= PX_HDLC_MRU)
+    if(handle->rx_frame_index >= PX_HDLC_MRU)
     {
         // Wrap index
-        px_hdlc_rx_frame_index  = 0;
-        // Invalidate FCS so that packet will be rejected
-        px_hdlc_rx_frame_fcs  ^= 0xFFFF;
+        handle->rx_frame_index   = 0;
+        // Set flag so that packet will be rejected
+        handle->rx_overflow_flag = true;
     }
 
     return false;
 }
 
-void px_hdlc_tx_frame(const uint8_t * data, size_t nr_of_bytes)
+size_t px_hdlc_on_rx_data(px_hdlc_handle_t * handle,
+                          const uint8_t *    data,
+                          size_t             nr_of_bytes)
+{
+    size_t nr_of_frames = 0;
+    size_t run_len;
+
+    while(nr_of_bytes != 0)
+    {
+        // Not busy with escape sequence?
+        if(!handle->rx_esc_flag)
+        {
+            // Store run of bytes that need not be unescaped in bulk
+            run_len = px_hdlc_unesc_run_len(data, nr_of_bytes);
+            px_hdlc_rx_store(handle, data, run_len);
+            data        += run_len;
+            nr_of_bytes -= run_len;
+            if(nr_of_bytes == 0)
+            {
+                break;
+            }
+        }
+        // Process flag, control escape or escaped byte
+        if(px_hdlc_on_rx_u8(handle, *data++))
+        {
+            nr_of_frames++;
+        }
+        nr_of_bytes--;
+    }
+
+    return nr_of_frames;
+}
+
+void px_hdlc_tx_frame(px_hdlc_handle_t * handle, const uint8_t * data, size_t nr_of_bytes)
 {
     uint8_t  data_u8;
-    uint16_t fcs = PX_CRC16_INIT_VAL;    
+    uint16_t fcs;
+
+    // Calculate checksum over whole frame in one call
+    fcs = px_crc16_update_data(PX_CRC16_INIT_VAL, data, nr_of_bytes);
 
     // Send start marker
-    px_hdlc_tx_u8(PX_HDLC_FLAG_SEQUENCE);
+    px_hdlc_tx_u8(handle, PX_HDLC_FLAG_SEQUENCE);
 
     // Send escaped data
     while(nr_of_bytes)
     {
         // Get next byte
         data_u8 = *data++;
-        // Update checksum
-        fcs = px_crc16_update_u8(fcs, data_u8);
         // ESC send data
-        px_hdlc_esc_tx_u8(data_u8);
+        px_hdlc_esc_tx_u8(handle, data_u8);
         // decrement counter
         nr_of_bytes--;
     }
@@ -171,12 +382,74 @@ void px_hdlc_tx_frame(const uint8_t * data, size_t nr_of_bytes)
     // Low byte of inverted FCS
     data_u8 = PX_U16_LO8(fcs);
     // ESC send data
-    px_hdlc_esc_tx_u8(data_u8);
+    px_hdlc_esc_tx_u8(handle, data_u8);
     // High byte of inverted FCS
     data_u8 = PX_U16_HI8(fcs);
     // ESC send data
-    px_hdlc_esc_tx_u8(data_u8);
+    px_hdlc_esc_tx_u8(handle, data_u8);
     // Send end marker
-    px_hdlc_tx_u8(PX_HDLC_FLAG_SEQUENCE);    
+    px_hdlc_tx_u8(handle, PX_HDLC_FLAG_SEQUENCE);    
+}
+
+size_t px_hdlc_tx_frame_to_buf(const uint8_t * data,
+                               size_t          nr_of_bytes,
+                               uint8_t *       buf,
+                               size_t          buf_size)
+{
+    uint8_t *       buf_wr  = buf;
+    const uint8_t * buf_end = buf + buf_size;
+    uint8_t         fcs_data[2];
+
+    // Room for start and end marker?
+    if(buf_size < 2)
+    {
+        return 0;
+    }
+    // Calculate checksum
+    px_hdlc_fcs_calc(fcs_data, data, nr_of_bytes);
+    // Start marker
+    *buf_wr++ = PX_HDLC_FLAG_SEQUENCE;
+    // Escaped data and FCS (leave room for end marker)
+    buf_wr = px_hdlc_esc_wr_buf(buf_wr, buf_end - 1, data, nr_of_bytes);
+    if(buf_wr == NULL)
+    {
+        return 0;
+    }
+    buf_wr = px_hdlc_esc_wr_buf(buf_wr, buf_end - 1, fcs_data, sizeof(fcs_data));
+    if(buf_wr == NULL)
+    {
+        return 0;
+    }
+    // End marker
+    *buf_wr++ = PX_HDLC_FLAG_SEQUENCE;
+
+    return (size_t)(buf_wr - buf);
 }
 
+size_t px_hdlc_tx_frame_to_ring_buf(const uint8_t * data,
+                                    size_t          nr_of_bytes,
+                                    px_ring_buf_t * ring_buf)
+{
+    uint8_t flag = PX_HDLC_FLAG_SEQUENCE;
+    uint8_t fcs_data[2];
+    size_t  len;
+
+    // Calculate checksum
+    px_hdlc_fcs_calc(fcs_data, data, nr_of_bytes);
+    // Calculate encoded frame size
+    len =   2
+          + px_hdlc_esc_len(data, nr_of_bytes)
+          + px_hdlc_esc_len(fcs_data, sizeof(fcs_data));
+    // Enough space for whole frame?
+    if(len > px_ring_buf_count_free(ring_buf))
+    {
+        return 0;
+    }
+    // Start marker, escaped data and FCS, end marker
+    px_ring_buf_wr(ring_buf, &flag, 1);
+    px_hdlc_esc_wr_ring_buf(ring_buf, data, nr_of_bytes);
+    px_hdlc_esc_wr_ring_buf(ring_buf, fcs_data, sizeof(fcs_data));
+    px_ring_buf_wr(ring_buf, &flag, 1);
+
+    return len;
+}
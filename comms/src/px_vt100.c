@@ -33,11 +33,25 @@ PX_LOG_NAME("px_vt100");
 /* _____LOCAL VARIABLES______________________________________________________ */
 static uint8_t px_vt100_state;
 
+/// Output function (NULL = putchar)
+static px_vt100_putchar_fn_t px_vt100_putchar_fn;
+
 /* _____LOCAL FUNCTION PROTOTYPES____________________________________________ */
 
 /* _____MACROS_______________________________________________________________ */
 
 /* _____LOCAL FUNCTIONS______________________________________________________ */
+static void px_vt100_putchar(char data)
+{
+    if(px_vt100_putchar_fn == NULL)
+    {
+        putchar(data);
+    }
+    else
+    {
+        (*px_vt100_putchar_fn)(data);
+    }
+}
 
 /* _____GLOBAL FUNCTIONS_____________________________________________________ */
 void px_vt100_init()
@@ -45,15 +59,20 @@ void px_vt100_init()
     // Reset state
     px_vt100_state = 0;
     // Move cursor to upper left corner
-    putchar(PX_VT100_CHAR_ESC);
-    putchar('[');
-    putchar('H');
+    px_vt100_putchar(PX_VT100_CHAR_ESC);
+    px_vt100_putchar('[');
+    px_vt100_putchar('H');
     // Clear display
     px_vt100_clr_display();
     // Wait until Terminal has reset
     px_board_delay_ms(100);
 }
 
+void px_vt100_set_putchar(px_vt100_putchar_fn_t putchar_fn)
+{
+    px_vt100_putchar_fn = putchar_fn;
+}
+
 px_vt100_state_t px_vt100_on_rx_char(char data)
 {
     switch(px_vt100_state)
@@ -110,27 +129,27 @@ px_vt100_state_t px_vt100_on_rx_char(char data)
 
 void px_vt100_clr_display(void)
 {
-    putchar(PX_VT100_CHAR_ESC);
-    putchar('[');
-    putchar('2');
-    putchar('J');
+    px_vt100_putchar(PX_VT100_CHAR_ESC);
+    px_vt100_putchar('[');
+    px_vt100_putchar('2');
+    px_vt100_putchar('J');
 }
 
 void px_vt100_erase_line(void)
 {
-    putchar(PX_VT100_CHAR_ESC);
-    putchar('[');
-    putchar('2');
-    putchar('K');
+    px_vt100_putchar(PX_VT100_CHAR_ESC);
+    px_vt100_putchar('[');
+    px_vt100_putchar('2');
+    px_vt100_putchar('K');
 }
 
 void px_vt100_del_chars(uint8_t nr_of_chars)
 {
     while(nr_of_chars != 0)
     {
-        putchar(PX_VT100_CHAR_BS);
-        putchar(' ');
-        putchar(PX_VT100_CHAR_BS);
+        px_vt100_putchar(PX_VT100_CHAR_BS);
+        px_vt100_putchar(' ');
+        px_vt100_putchar(PX_VT100_CHAR_BS);
         nr_of_chars--;
     }
 }
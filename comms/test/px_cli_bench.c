@@ -0,0 +1,614 @@
+/*
+ *  Host key replay test and benchmark for px_cli. Build and run with:
+ *
+ *      make -C tools/px_host_test run
+ *
+ *  A command tree of BENCH_NR_OF_GROUPS groups with BENCH_NR_OF_GROUP_CMDS
+ *  commands each plus BENCH_NR_OF_ROOT_CMDS root commands (150 commands) is
+ *  built at run time. Scripted key sequences are fed through
+ *  px_cli_on_rx_char() with terminal output discarded. Each command has its own
+ *  handler so that dispatch can be verified. tools/px_host_test/Makefile builds
+ *  one executable without options, one with the command index
+ *  (PX_CLI_CFG_INDEX_SIZE) and one with the output buffer
+ *  (PX_CLI_CFG_WR_BUF_SIZE).
+ *
+ *  1. Each command is typed with arguments and executed; the expected handler
+ *     must be called. Unknown commands, partial names and group names must not
+ *     call a handler.
+ *  2. For each prefix of each group and command name, TAB is pressed 1 to N
+ *     times (N = number of names with that prefix) followed by ENTER. The
+ *     commands that are executed must be exactly the set of names with that
+ *     prefix (order is not checked; the index cycles in alphabetical order).
+ *  3. Time (and CPU cycles if supported) per executed command (typing and
+ *     ENTER), per ENTER only (command lookup and dispatch) and per TAB. Time
+ *     on the host is dominated by terminal output, so the number of string
+ *     compares (strcmp() and strncmp() are wrapped by the linker) is also
+ *     reported, which is what dominates on a microcontroller with names in
+ *     flash.
+ *  4. Terminal output per command and per TAB: number of bytes and number of
+ *     writes to an unbuffered stdout stream (each write is a packet to a USB
+ *     CDC driver). With the output buffer there may be at most 2 writes per
+ *     key (one before the command handler is called) and the writes must match
+ *     the flush statistics of the CLI.
+ */
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "px_cli.h"
+#include "px_vt100.h"
+#include "px_host_bench.h"
+
+/// Number of groups
+#define BENCH_NR_OF_GROUPS      10
+/// Number of commands in each group
+#define BENCH_NR_OF_GROUP_CMDS  14
+/// Number of commands in root list (first one is "help")
+#define BENCH_NR_OF_ROOT_CMDS   10
+/// Total number of commands
+#define BENCH_NR_OF_CMDS        (BENCH_NR_OF_GROUPS * BENCH_NR_OF_GROUP_CMDS + BENCH_NR_OF_ROOT_CMDS)
+/// Number of times that the command script is replayed for timing
+#define BENCH_REPEAT            200
+/// Handler ID if no handler was called
+#define BENCH_ID_NONE           0xffff
+
+static const char * const bench_group_names[BENCH_NR_OF_GROUPS] =
+{
+    "rtc", "i2c", "adc", "gpio", "sf", "i2s", "log", "dac", "lcd", "pwm",
+};
+
+static const char * const bench_cmd_names[BENCH_NR_OF_GROUP_CMDS] =
+{
+    "wr_reg", "rd", "status", "init", "wr", "cfg", "rd_reg",
+    "info", "erase", "clr", "set", "reset", "get", "dump",
+};
+
+static const char * const bench_root_cmd_names[BENCH_NR_OF_ROOT_CMDS] =
+{
+    "help", "reboot", "ver", "time", "date", "echo", "exit", "history", "id", "uptime",
+};
+
+static px_cli_cmd_t           bench_cmds[BENCH_NR_OF_CMDS];
+static px_cli_group_t         bench_groups[BENCH_NR_OF_GROUPS];
+static px_cli_cmd_list_item_t bench_group_lists[BENCH_NR_OF_GROUPS][BENCH_NR_OF_GROUP_CMDS + 1];
+static px_cli_cmd_list_item_t bench_root_list[BENCH_NR_OF_GROUPS + BENCH_NR_OF_ROOT_CMDS + 1];
+
+static unsigned long bench_nr_of_str_cmps;
+static uint16_t bench_called_id;
+static uint8_t  bench_called_argc;
+static FILE *   bench_stdout;
+static FILE *   bench_stdout_null;
+static unsigned long bench_nr_of_writes;
+static unsigned long bench_nr_of_bytes;
+static bool     bench_handler_output;
+static char     bench_capture[256];
+static size_t   bench_capture_len;
+
+static void bench_handler_called(uint16_t id, uint8_t argc)
+{
+    bench_called_id   = id;
+    bench_called_argc = argc;
+    if(bench_handler_output)
+    {
+        // Mix printf() with px_vt100 output
+        printf("<");
+        px_vt100_erase_line();
+        printf(">");
+    }
+}
+
+/// Count string compares (linked with -Wl,--wrap=strcmp,--wrap=strncmp)
+int __real_strcmp(const char * s1, const char * s2);
+int __real_strncmp(const char * s1, const char * s2, size_t n);
+
+int __wrap_strcmp(const char * s1, const char * s2)
+{
+    bench_nr_of_str_cmps++;
+    return __real_strcmp(s1, s2);
+}
+
+int __wrap_strncmp(const char * s1, const char * s2, size_t n)
+{
+    bench_nr_of_str_cmps++;
+    return __real_strncmp(s1, s2, n);
+}
+
+/// Create a handler for each command that reports its ID
+#define BENCH_H(n) \
+    static const char * bench_h ## n(uint8_t argc, char * argv[]) \
+    { \
+        bench_handler_called(n, argc); \
+        return NULL; \
+    }
+#define BENCH_H10(d) \
+    BENCH_H(d ## 0) BENCH_H(d ## 1) BENCH_H(d ## 2) BENCH_H(d ## 3) BENCH_H(d ## 4) \
+    BENCH_H(d ## 5) BENCH_H(d ## 6) BENCH_H(d ## 7) BENCH_H(d ## 8) BENCH_H(d ## 9)
+#define BENCH_HT10(d) \
+    bench_h ## d ## 0, bench_h ## d ## 1, bench_h ## d ## 2, bench_h ## d ## 3, bench_h ## d ## 4, \
+    bench_h ## d ## 5, bench_h ## d ## 6, bench_h ## d ## 7, bench_h ## d ## 8, bench_h ## d ## 9,
+
+BENCH_H10() BENCH_H10(1) BENCH_H10(2) BENCH_H10(3) BENCH_H10(4) BENCH_H10(5) BENCH_H10(6)
+BENCH_H10(7) BENCH_H10(8) BENCH_H10(9) BENCH_H10(10) BENCH_H10(11) BENCH_H10(12) BENCH_H10(13)
+BENCH_H10(14)
+
+static const px_cli_handler_t bench_handlers[BENCH_NR_OF_CMDS] =
+{
+    BENCH_HT10() BENCH_HT10(1) BENCH_HT10(2) BENCH_HT10(3) BENCH_HT10(4) BENCH_HT10(5) BENCH_HT10(6)
+    BENCH_HT10(7) BENCH_HT10(8) BENCH_HT10(9) BENCH_HT10(10) BENCH_HT10(11) BENCH_HT10(12) BENCH_HT10(13)
+    BENCH_HT10(14)
+};
+
+/// ID of group command
+static uint16_t bench_id_group_cmd(int group, int cmd)
+{
+    return (uint16_t)(group * BENCH_NR_OF_GROUP_CMDS + cmd);
+}
+
+/// ID of root command
+static uint16_t bench_id_root_cmd(int cmd)
+{
+    return (uint16_t)(BENCH_NR_OF_GROUPS * BENCH_NR_OF_GROUP_CMDS + cmd);
+}
+
+static void bench_cmd_init(uint16_t id, const char * name)
+{
+    bench_cmds[id].name     = name;
+    bench_cmds[id].argc_min = 0;
+    bench_cmds[id].argc_max = 2;
+    bench_cmds[id].param    = "[arg1] [arg2]";
+#if PX_CLI_CFG_DISP_HELP_STR
+    bench_cmds[id].help     = "Benchmark command";
+#endif
+}
+
+/// Build command tree: groups and root commands interleaved in root list
+static void bench_tree_build(void)
+{
+    int      g;
+    int      c;
+    int      r = 0;
+    uint16_t id;
+
+    for(g = 0; g < BENCH_NR_OF_GROUPS; g++)
+    {
+        for(c = 0; c < BENCH_NR_OF_GROUP_CMDS; c++)
+        {
+            id = bench_id_group_cmd(g, c);
+            bench_cmd_init(id, bench_cmd_names[c]);
+            bench_group_lists[g][c].handler = bench_handlers[id];
+            bench_group_lists[g][c].cmd     = &bench_cmds[id];
+        }
+        bench_group_lists[g][c].handler = NULL;
+        bench_group_lists[g][c].cmd     = NULL;
+        bench_groups[g].name = bench_group_names[g];
+        bench_groups[g].list = bench_group_lists[g];
+
+        bench_root_list[r].handler = NULL;
+        bench_root_list[r].group   = &bench_groups[g];
+        r++;
+        id = bench_id_root_cmd(g);
+        bench_cmd_init(id, bench_root_cmd_names[g]);
+        bench_root_list[r].handler = (g == 0) ? px_cli_cmd_help_fn : bench_handlers[id];
+        bench_root_list[r].cmd     = &bench_cmds[id];
+        r++;
+    }
+    bench_root_list[r].handler = NULL;
+    bench_root_list[r].cmd     = NULL;
+}
+
+/// Count and discard terminal output
+static ssize_t bench_stdout_null_wr(void * cookie, const char * buf, size_t size)
+{
+    size_t i;
+
+    bench_nr_of_writes++;
+    bench_nr_of_bytes += size;
+    for(i = 0; (i < size) && (bench_capture_len < sizeof(bench_capture)); i++)
+    {
+        bench_capture[bench_capture_len++] = buf[i];
+    }
+    return (ssize_t)size;
+}
+
+/// Discard (true) or restore (false) terminal output
+static void bench_stdout_discard(bool discard)
+{
+    static const cookie_io_functions_t null_io = {NULL, bench_stdout_null_wr, NULL, NULL};
+
+    if(bench_stdout_null == NULL)
+    {
+        // Unbuffered stream: each putchar(), puts(), printf() or fwrite() is a write
+        bench_stdout      = stdout;
+        bench_stdout_null = fopencookie(NULL, "w", null_io);
+        setvbuf(bench_stdout_null, NULL, _IONBF, 0);
+    }
+    fflush(stdout);
+    stdout = discard ? bench_stdout_null : bench_stdout;
+}
+
+static void bench_keys(const char * str)
+{
+    while(*str != '\0')
+    {
+        px_cli_on_rx_char(*str++);
+    }
+}
+
+static void bench_key_tab(int n)
+{
+    while(n-- > 0)
+    {
+        px_cli_on_rx_char(PX_VT100_CHAR_TAB);
+    }
+}
+
+/// Press ENTER and return ID of handler that was called
+static uint16_t bench_key_enter(void)
+{
+    bench_called_id = BENCH_ID_NONE;
+    px_cli_on_rx_char(PX_CLI_CFG_CHAR_ENTER);
+    return bench_called_id;
+}
+
+static void bench_dispatch_check(void)
+{
+    char line[PX_CLI_CFG_LINE_LENGTH_MAX];
+    int  g;
+    int  c;
+
+    for(g = 0; g < BENCH_NR_OF_GROUPS; g++)
+    {
+        for(c = 0; c < BENCH_NR_OF_GROUP_CMDS; c++)
+        {
+            sprintf(line, "%s %s 1 2", bench_group_names[g], bench_cmd_names[c]);
+            bench_keys(line);
+            PX_HOST_CHECK(bench_key_enter() == bench_id_group_cmd(g, c));
+            PX_HOST_CHECK(bench_called_argc == 2);
+        }
+        // Group without command
+        bench_keys(bench_group_names[g]);
+        PX_HOST_CHECK(bench_key_enter() == BENCH_ID_NONE);
+        // Partial and unknown command names
+        sprintf(line, "%s rd_", bench_group_names[g]);
+        bench_keys(line);
+        PX_HOST_CHECK(bench_key_enter() == BENCH_ID_NONE);
+        sprintf(line, "%s wr_regs", bench_group_names[g]);
+        bench_keys(line);
+        PX_HOST_CHECK(bench_key_enter() == BENCH_ID_NONE);
+    }
+    for(c = 1; c < BENCH_NR_OF_ROOT_CMDS; c++)
+    {
+        bench_keys(bench_root_cmd_names[c]);
+        PX_HOST_CHECK(bench_key_enter() == bench_id_root_cmd(c));
+        PX_HOST_CHECK(bench_called_argc == 0);
+    }
+    // Command as group and unknown command
+    bench_keys("ver rd");
+    PX_HOST_CHECK(bench_key_enter() == bench_id_root_cmd(2));
+    bench_keys("nope");
+    PX_HOST_CHECK(bench_key_enter() == BENCH_ID_NONE);
+    bench_keys("help");
+    PX_HOST_CHECK(bench_key_enter() == BENCH_ID_NONE);
+}
+
+/// Output of handler must be written in the same order as it was generated
+static void bench_handler_output_check(void)
+{
+    const char * start;
+    const char * esc;
+    const char * end;
+
+    bench_handler_output = true;
+    bench_keys("ver");
+    bench_capture_len = 0;
+    PX_HOST_CHECK(bench_key_enter() == bench_id_root_cmd(2));
+    bench_handler_output = false;
+
+    start = memchr(bench_capture, '<', bench_capture_len);
+    end   = memchr(bench_capture, '>', bench_capture_len);
+    PX_HOST_CHECK((start != NULL) && (end != NULL));
+    esc = memchr(start, PX_VT100_CHAR_ESC, end - start);
+    PX_HOST_CHECK(esc != NULL);
+}
+
+/**
+ *  Type line, press TAB 1 to N times, type suffix and ENTER for each. The set
+ *  of IDs called must match expected set.
+ */
+static void bench_autocomplete_check(const char * line, const char * suffix,
+                                     const bool * expected, int nr_expected)
+{
+    static bool called[BENCH_NR_OF_CMDS];
+    uint16_t    id;
+    int         k;
+
+    memset(called, 0, sizeof(called));
+    for(k = 1; k <= nr_expected; k++)
+    {
+        bench_keys(line);
+        bench_key_tab(k);
+        bench_keys(suffix);
+        id = bench_key_enter();
+        PX_HOST_CHECK(id != BENCH_ID_NONE);
+        PX_HOST_CHECK(expected[id]);
+        PX_HOST_CHECK(!called[id]);
+        called[id] = true;
+    }
+    // Cycle wraps around (the linear search rings the bell once at the end of the list)
+    bench_keys(line);
+    bench_key_tab(nr_expected + 2);
+    bench_keys(suffix);
+    id = bench_key_enter();
+    PX_HOST_CHECK((id != BENCH_ID_NONE) && expected[id]);
+}
+
+static void bench_autocomplete_checks(void)
+{
+    static bool  expected[BENCH_NR_OF_CMDS];
+    char         line[PX_CLI_CFG_LINE_LENGTH_MAX];
+    const char * name;
+    int          nr_expected;
+    int          g;
+    int          c;
+    int          i;
+    size_t       len;
+
+    // Group commands
+    for(g = 0; g < BENCH_NR_OF_GROUPS; g++)
+    {
+        for(c = 0; c < BENCH_NR_OF_GROUP_CMDS; c++)
+        {
+            name = bench_cmd_names[c];
+            for(len = 0; len <= strlen(name); len++)
+            {
+                memset(expected, 0, sizeof(expected));
+                nr_expected = 0;
+                for(i = 0; i < BENCH_NR_OF_GROUP_CMDS; i++)
+                {
+                    if(strncmp(bench_cmd_names[i], name, len) == 0)
+                    {
+                        expected[bench_id_group_cmd(g, i)] = true;
+                        nr_expected++;
+                    }
+                }
+                sprintf(line, "%s %.*s", bench_group_names[g], (int)len, name);
+                bench_autocomplete_check(line, "", expected, nr_expected);
+            }
+        }
+    }
+    // Root list: groups (followed by " info") and root commands (with argument "info")
+    for(g = 0; g < BENCH_NR_OF_GROUPS; g++)
+    {
+        for(i = 0; i < 2; i++)
+        {
+            name = (i == 0) ? bench_group_names[g] : bench_root_cmd_names[g];
+            if(strcmp(name, "help") == 0)
+            {
+                continue;
+            }
+            for(len = 1; len <= strlen(name); len++)
+            {
+                memset(expected, 0, sizeof(expected));
+                nr_expected = 0;
+                for(c = 0; c < BENCH_NR_OF_GROUPS; c++)
+                {
+                    if(strncmp(bench_group_names[c], name, len) == 0)
+                    {
+                        expected[bench_id_group_cmd(c, 7)] = true;
+                        nr_expected++;
+                    }
+                    if(strncmp(bench_root_cmd_names[c], name, len) == 0)
+                    {
+                        // "help" does not report an ID; skip prefixes that match it
+                        if(c == 0)
+                        {
+                            nr_expected = -1;
+                            break;
+                        }
+                        expected[bench_id_root_cmd(c)] = true;
+                        nr_expected++;
+                    }
+                }
+                if(nr_expected < 0)
+                {
+                    continue;
+                }
+                sprintf(line, "%.*s", (int)len, name);
+                bench_autocomplete_check(line, " info", expected, nr_expected);
+            }
+        }
+    }
+    // No match
+    bench_keys("rtc x");
+    bench_key_tab(1);
+    PX_HOST_CHECK(bench_key_enter() == BENCH_ID_NONE);
+}
+
+static void bench_timing(void)
+{
+    static char script[BENCH_NR_OF_GROUPS * BENCH_NR_OF_GROUP_CMDS][PX_CLI_CFG_LINE_LENGTH_MAX];
+    uint64_t    start_us;
+    uint64_t    start_cycles;
+    uint64_t    cmd_us;
+    uint64_t    cmd_cycles;
+    uint64_t    enter_start_ns;
+    uint64_t    enter_start_cycles;
+    uint64_t    enter_ns     = 0;
+    uint64_t    enter_cycles = 0;
+    unsigned long enter_cmps = 0;
+    unsigned long tab_cmps;
+    uint64_t    tab_us;
+    uint64_t    tab_cycles;
+    unsigned    nr_of_cmds = 0;
+    unsigned    nr_of_tabs = 0;
+    int         g;
+    int         c;
+    int         r;
+
+    for(g = 0; g < BENCH_NR_OF_GROUPS; g++)
+    {
+        for(c = 0; c < BENCH_NR_OF_GROUP_CMDS; c++)
+        {
+            sprintf(script[bench_id_group_cmd(g, c)], "%s %s 1", bench_group_names[g], bench_cmd_names[c]);
+        }
+    }
+
+    // Type and execute each command
+    start_us     = px_host_bench_time_us();
+    start_cycles = px_host_bench_cycles();
+    for(r = 0; r < BENCH_REPEAT; r++)
+    {
+        for(c = 0; c < BENCH_NR_OF_GROUPS * BENCH_NR_OF_GROUP_CMDS; c++)
+        {
+            bench_keys(script[c]);
+            enter_start_ns     = px_host_bench_time_ns();
+            enter_start_cycles = px_host_bench_cycles();
+            bench_nr_of_str_cmps = 0;
+            px_cli_on_rx_char(PX_CLI_CFG_CHAR_ENTER);
+            enter_cmps        += bench_nr_of_str_cmps;
+            enter_cycles      += px_host_bench_cycles() - enter_start_cycles;
+            enter_ns          += px_host_bench_time_ns() - enter_start_ns;
+            nr_of_cmds++;
+        }
+    }
+    cmd_cycles = px_host_bench_cycles() - start_cycles;
+    cmd_us     = px_host_bench_time_us() - start_us;
+
+    // Cycle through all commands of a group with TAB
+    start_us     = px_host_bench_time_us();
+    start_cycles = px_host_bench_cycles();
+    bench_nr_of_str_cmps = 0;
+    for(r = 0; r < BENCH_REPEAT; r++)
+    {
+        for(g = 0; g < BENCH_NR_OF_GROUPS; g++)
+        {
+            bench_keys(bench_group_names[g]);
+            px_cli_on_rx_char(' ');
+            bench_key_tab(BENCH_NR_OF_GROUP_CMDS);
+            nr_of_tabs += BENCH_NR_OF_GROUP_CMDS;
+            px_cli_on_rx_char(PX_CLI_CFG_CHAR_ENTER);
+        }
+    }
+    tab_cycles = px_host_bench_cycles() - start_cycles;
+    tab_cmps   = bench_nr_of_str_cmps;
+    tab_us     = px_host_bench_time_us() - start_us;
+
+    bench_stdout_discard(false);
+    printf("%-34s %12s %12s %12s\n", "", "ns", "cycles", "str cmps");
+    printf("%-34s %12.1f %12.0f %12s\n", "Type and execute command",
+           1000.0 * cmd_us / nr_of_cmds, (double)cmd_cycles / nr_of_cmds, "");
+    printf("%-34s %12.1f %12.0f %12.1f\n", "ENTER (lookup and dispatch)",
+           (double)enter_ns / nr_of_cmds, (double)enter_cycles / nr_of_cmds,
+           (double)enter_cmps / nr_of_cmds);
+    printf("%-34s %12.1f %12.0f %12.1f\n", "TAB (cycle through group)",
+           1000.0 * tab_us / nr_of_tabs, (double)tab_cycles / nr_of_tabs,
+           (double)tab_cmps / nr_of_tabs);
+    if(!PX_HOST_BENCH_HAS_CYCLES)
+    {
+        printf("(CPU cycle counter not supported on this host)\n");
+    }
+    bench_stdout_discard(true);
+}
+
+static void bench_output(void)
+{
+    char          line[PX_CLI_CFG_LINE_LENGTH_MAX];
+    unsigned long cmd_writes = 0;
+    unsigned long cmd_bytes  = 0;
+    unsigned long key_writes_max = 0;
+    unsigned long tab_writes = 0;
+    unsigned long tab_bytes  = 0;
+    unsigned long writes;
+    unsigned long bytes;
+    unsigned      nr_of_cmds = 0;
+    const char *  str;
+    int           g;
+    int           c;
+
+#if PX_CLI_CFG_WR_BUF_SIZE
+    px_cli_reset_wr_buf_stats();
+#endif
+    bench_nr_of_writes = 0;
+    bench_nr_of_bytes  = 0;
+    for(g = 0; g < BENCH_NR_OF_GROUPS; g++)
+    {
+        for(c = 0; c < BENCH_NR_OF_GROUP_CMDS; c++)
+        {
+            sprintf(line, "%s %s 1", bench_group_names[g], bench_cmd_names[c]);
+            str = line;
+            while(true)
+            {
+                writes = bench_nr_of_writes;
+                px_cli_on_rx_char((*str != '\0') ? *str : PX_CLI_CFG_CHAR_ENTER);
+                writes = bench_nr_of_writes - writes;
+                if(key_writes_max < writes)
+                {
+                    key_writes_max = writes;
+                }
+                if(*str++ == '\0')
+                {
+                    break;
+                }
+            }
+            nr_of_cmds++;
+        }
+    }
+    cmd_writes = bench_nr_of_writes;
+    cmd_bytes  = bench_nr_of_bytes;
+#if PX_CLI_CFG_WR_BUF_SIZE
+    PX_HOST_CHECK(key_writes_max <= 2);
+    PX_HOST_CHECK(px_cli_get_wr_buf_stats()->nr_of_flushes == cmd_writes);
+    PX_HOST_CHECK(px_cli_get_wr_buf_stats()->nr_of_bytes == cmd_bytes);
+#endif
+
+    for(g = 0; g < BENCH_NR_OF_GROUPS; g++)
+    {
+        bench_keys(bench_group_names[g]);
+        px_cli_on_rx_char(' ');
+        writes = bench_nr_of_writes;
+        bytes  = bench_nr_of_bytes;
+        bench_key_tab(BENCH_NR_OF_GROUP_CMDS);
+        tab_writes += bench_nr_of_writes - writes;
+        tab_bytes  += bench_nr_of_bytes - bytes;
+        px_cli_on_rx_char(PX_CLI_CFG_CHAR_ENTER);
+    }
+
+    bench_stdout_discard(false);
+    printf("%-34s %12s %12s %12s\n", "Output", "bytes", "writes", "max/key");
+    printf("%-34s %12.1f %12.1f %12lu\n", "Type and execute command",
+           (double)cmd_bytes / nr_of_cmds, (double)cmd_writes / nr_of_cmds, key_writes_max);
+    printf("%-34s %12.1f %12.1f %12s\n\n", "TAB (cycle through group)",
+           (double)tab_bytes / (BENCH_NR_OF_GROUPS * BENCH_NR_OF_GROUP_CMDS),
+           (double)tab_writes / (BENCH_NR_OF_GROUPS * BENCH_NR_OF_GROUP_CMDS), "");
+    bench_stdout_discard(true);
+}
+
+int main(void)
+{
+    printf("px_cli host test: %d commands in %d groups + %d root commands\n",
+           BENCH_NR_OF_CMDS, BENCH_NR_OF_GROUPS, BENCH_NR_OF_ROOT_CMDS);
+    printf("Index %s (%d entries), output buffer %s (%d bytes)\n\n",
+           PX_CLI_CFG_INDEX_SIZE ? "enabled" : "disabled", PX_CLI_CFG_INDEX_SIZE,
+           PX_CLI_CFG_WR_BUF_SIZE ? "enabled" : "disabled", PX_CLI_CFG_WR_BUF_SIZE);
+
+    bench_tree_build();
+    bench_stdout_discard(true);
+    px_cli_init(bench_root_list, NULL);
+
+    bench_dispatch_check();
+    bench_handler_output_check();
+    bench_stdout_discard(false);
+    printf("Dispatch check: OK\n");
+    bench_stdout_discard(true);
+
+    bench_autocomplete_checks();
+    bench_stdout_discard(false);
+    printf("Autocomplete check: OK\n\n");
+    bench_stdout_discard(true);
+
+    bench_output();
+    bench_timing();
+    bench_stdout_discard(false);
+
+    return 0;
+}
@@ -0,0 +1,455 @@
+/*
+ *  Host benchmark for px_hdlc and the px_crc16 options used for the frame
+ *  check sequence (FCS). The CRC implementation is selected at compile time
+ *  (see px_crc16_cfg.h), so tools/px_host_test/Makefile builds one executable
+ *  per option:
+ *
+ *      make -C tools/px_host_test run
+ *
+ *  Frames are encoded into a loopback buffer and fed back into the decoder.
+ *  Encode throughput is reported for px_hdlc_tx_frame() (one callback per
+ *  byte), px_hdlc_tx_frame_to_buf() and px_hdlc_tx_frame_to_ring_buf(), and
+ *  decode throughput for px_hdlc_on_rx_u8() and px_hdlc_on_rx_data(), in
+ *  frames/s for a 64 byte frame and the largest frame that fits in
+ *  PX_HDLC_MRU.
+ *
+ *  A stream of random frames with injected errors is then fed to two
+ *  instances: one byte at a time with px_hdlc_on_rx_u8() and in random sized
+ *  blocks with px_hdlc_on_rx_data(). Both must accept and reject exactly the
+ *  same frames.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "px_hdlc.h"
+#include "px_crc16.h"
+#include "px_host_bench.h"
+
+/// Largest frame payload that is accepted (data + 16-bit FCS < PX_HDLC_MRU)
+#define BENCH_FRAME_SIZE_MAX    (PX_HDLC_MRU - 3)
+/// Total number of payload bytes processed for each frame size
+#define BENCH_TOTAL_BYTES       (8ul * 1024 * 1024)
+/// Number of frames in random stream
+#define BENCH_STREAM_FRAMES     20000
+/// Size of random stream buffer
+#define BENCH_STREAM_SIZE       (BENCH_STREAM_FRAMES * (PX_HDLC_TX_BUF_SIZE(PX_HDLC_MRU) + 2))
+
+/// Record of received frame to compare decoders
+typedef struct
+{
+    size_t   nr_of_bytes;   ///< Frame size
+    uint32_t hash;          ///< Hash of frame data
+} bench_rx_rec_t;
+
+/// Received frames of one decoder
+typedef struct
+{
+    bench_rx_rec_t rec[BENCH_STREAM_FRAMES];
+    size_t         nr_of_frames;
+} bench_rx_log_t;
+
+static uint8_t  bench_frame[PX_HDLC_MRU];
+/// Encoded frame (worst case: every byte escaped plus two flags)
+static uint8_t  bench_tx_buf[2 * (PX_HDLC_MRU + 2) + 2];
+static size_t   bench_tx_len;
+static px_hdlc_handle_t bench_hdlc;
+static px_hdlc_handle_t bench_hdlc_u8;
+static px_hdlc_handle_t bench_hdlc_data;
+static uint8_t *        bench_stream_buf;
+static size_t           bench_stream_len;
+static bench_rx_log_t   bench_rx_log_u8;
+static bench_rx_log_t   bench_rx_log_data;
+static uint8_t  bench_enc_buf[PX_HDLC_TX_BUF_SIZE(PX_HDLC_MRU)];
+static uint8_t  bench_ring_buf_data[2 * PX_HDLC_TX_BUF_SIZE(PX_HDLC_MRU)];
+static px_ring_buf_t bench_ring_buf;
+static size_t   bench_rx_frame_len;
+static bool     bench_rx_frame_match;
+
+static const char * bench_name(void)
+{
+#if PX_CRC16_RAM_TABLE
+    switch(PX_CRC16_SLICE_BY)
+    {
+    case 4:  return "slice-by-4 (RAM table)";
+    case 8:  return "slice-by-8 (RAM table)";
+    default: return "table (RAM)";
+    }
+#elif PX_CRC16_ROM_TABLE
+    switch(PX_CRC16_SLICE_BY)
+    {
+    case 4:  return "slice-by-4 (ROM table)";
+    case 8:  return "slice-by-8 (ROM table)";
+    default: return "table (ROM)";
+    }
+#elif PX_CRC16_NIBBLE_TABLE
+    return "nibble table (ROM)";
+#else
+    return "bitwise (no table)";
+#endif
+}
+
+static void bench_tx_u8(px_hdlc_handle_t * handle, uint8_t data)
+{
+    bench_tx_buf[bench_tx_len++] = data;
+}
+
+static void bench_on_rx_frame(px_hdlc_handle_t * handle, const uint8_t * data, size_t nr_of_bytes)
+{
+    bench_rx_frame_len   = nr_of_bytes;
+    bench_rx_frame_match = (memcmp(data, bench_frame, nr_of_bytes) == 0);
+}
+
+static size_t bench_rx_u8(px_hdlc_handle_t * handle, const uint8_t * data, size_t nr_of_bytes)
+{
+    size_t nr_of_frames = 0;
+
+    while(nr_of_bytes)
+    {
+        if(px_hdlc_on_rx_u8(handle, *data++))
+        {
+            nr_of_frames++;
+        }
+        nr_of_bytes--;
+    }
+    return nr_of_frames;
+}
+
+static size_t bench_rx(const uint8_t * data, size_t nr_of_bytes)
+{
+    return bench_rx_u8(&bench_hdlc, data, nr_of_bytes);
+}
+
+static uint32_t bench_hash(const uint8_t * data, size_t nr_of_bytes)
+{
+    uint32_t hash = 2166136261u;
+
+    // FNV-1a
+    while(nr_of_bytes--)
+    {
+        hash = (hash ^ *data++) * 16777619u;
+    }
+    return hash;
+}
+
+static void bench_rx_log(bench_rx_log_t * log, const uint8_t * data, size_t nr_of_bytes)
+{
+    if(log->nr_of_frames < BENCH_STREAM_FRAMES)
+    {
+        log->rec[log->nr_of_frames].nr_of_bytes = nr_of_bytes;
+        log->rec[log->nr_of_frames].hash        = bench_hash(data, nr_of_bytes);
+    }
+    log->nr_of_frames++;
+}
+
+static void bench_on_rx_frame_log(px_hdlc_handle_t * handle, const uint8_t * data, size_t nr_of_bytes)
+{
+    // Each instance has its own log
+    if(handle == &bench_hdlc_u8)
+    {
+        bench_rx_log(&bench_rx_log_u8, data, nr_of_bytes);
+    }
+    else
+    {
+        bench_rx_log(&bench_rx_log_data, data, nr_of_bytes);
+    }
+}
+
+static uint16_t bench_crc16_ref(uint16_t crc, const uint8_t * data, size_t nr_of_bytes)
+{
+    uint8_t i;
+
+    while(nr_of_bytes--)
+    {
+        crc ^= *data++;
+        for(i = 0; i < 8; i++)
+        {
+            crc = (crc & 1) ? (crc >> 1) ^ PX_CRC16_POLYNOMIAL : (crc >> 1);
+        }
+    }
+    return crc;
+}
+
+static void bench_verify(void)
+{
+    size_t offset;
+    size_t len;
+
+    // Standard check value of CRC-16/X-25 over "123456789"
+    PX_HOST_CHECK((px_crc16_update_data(PX_CRC16_INIT_VAL, "123456789", 9) ^ 0xffff) == 0x906e);
+    // Compare with reference over different alignments and lengths
+    for(offset = 0; offset < 8; offset++)
+    {
+        for(len = 0; len <= (sizeof(bench_frame) - offset); len++)
+        {
+            PX_HOST_CHECK(   px_crc16_update_data(PX_CRC16_INIT_VAL, &bench_frame[offset], len)
+                          == bench_crc16_ref(PX_CRC16_INIT_VAL, &bench_frame[offset], len)     );
+        }
+    }
+
+    // Loopback of every frame size, including bytes that must be escaped
+    bench_frame[0] = 0x7e;
+    bench_frame[1] = 0x7d;
+    for(len = 0; len <= BENCH_FRAME_SIZE_MAX; len++)
+    {
+        bench_tx_len       = 0;
+        px_hdlc_tx_frame(&bench_hdlc, bench_frame, len);
+        PX_HOST_CHECK(bench_rx(bench_tx_buf, bench_tx_len) == 1);
+        PX_HOST_CHECK(bench_rx_frame_len == len);
+        PX_HOST_CHECK(bench_rx_frame_match);
+    }
+
+    // Encoding into a buffer or ring buffer must produce an identical frame
+    bench_frame[2] = 0x7e;
+    for(len = 0; len <= sizeof(bench_frame); len++)
+    {
+        size_t enc_len;
+
+        bench_tx_len = 0;
+        px_hdlc_tx_frame(&bench_hdlc, bench_frame, len);
+        enc_len = px_hdlc_tx_frame_to_buf(bench_frame, len, bench_enc_buf, sizeof(bench_enc_buf));
+        PX_HOST_CHECK(enc_len == bench_tx_len);
+        PX_HOST_CHECK(memcmp(bench_enc_buf, bench_tx_buf, enc_len) == 0);
+        // Buffer one byte too small must fail
+        PX_HOST_CHECK(px_hdlc_tx_frame_to_buf(bench_frame, len, bench_enc_buf, enc_len - 1) == 0);
+        // Ring buffer (wrapping at different positions)
+        bench_ring_buf.idx_wr = bench_ring_buf.idx_rd = (px_ring_buf_idx_t)(len % sizeof(bench_ring_buf_data));
+        PX_HOST_CHECK(px_hdlc_tx_frame_to_ring_buf(bench_frame, len, &bench_ring_buf) == enc_len);
+        PX_HOST_CHECK(px_ring_buf_rd(&bench_ring_buf, bench_enc_buf, sizeof(bench_enc_buf)) == enc_len);
+        PX_HOST_CHECK(memcmp(bench_enc_buf, bench_tx_buf, enc_len) == 0);
+    }
+    // Ring buffer with too little space must not be written to
+    px_ring_buf_flush(&bench_ring_buf, 0);
+    px_ring_buf_wr(&bench_ring_buf, bench_enc_buf, sizeof(bench_ring_buf_data) - 10);
+    PX_HOST_CHECK(px_hdlc_tx_frame_to_ring_buf(bench_frame, 8, &bench_ring_buf) == 0);
+    PX_HOST_CHECK(px_ring_buf_count_used(&bench_ring_buf) == sizeof(bench_ring_buf_data) - 10);
+    px_ring_buf_flush(&bench_ring_buf, 0);
+
+    // Corrupted frame must be rejected and the next frame accepted
+    bench_tx_len = 0;
+    px_hdlc_tx_frame(&bench_hdlc, bench_frame, 64);
+    bench_tx_buf[10] ^= 0x01;
+    PX_HOST_CHECK(bench_rx(bench_tx_buf, bench_tx_len) == 0);
+    bench_tx_len = 0;
+    px_hdlc_tx_frame(&bench_hdlc, bench_frame, 64);
+    PX_HOST_CHECK(bench_rx(bench_tx_buf, bench_tx_len) == 1);
+
+    // Frame that overflows the receive buffer must be rejected and the next
+    // frame accepted
+    bench_tx_len = 0;
+    px_hdlc_tx_frame(&bench_hdlc, bench_frame, BENCH_FRAME_SIZE_MAX + 1);
+    PX_HOST_CHECK(bench_rx(bench_tx_buf, bench_tx_len) == 0);
+    bench_tx_len = 0;
+    px_hdlc_tx_frame(&bench_hdlc, bench_frame, BENCH_FRAME_SIZE_MAX);
+    PX_HOST_CHECK(bench_rx(bench_tx_buf, bench_tx_len) == 1);
+}
+
+static void bench_frame_size(size_t frame_size)
+{
+    uint64_t start_us;
+    uint64_t tx_time_us;
+    uint64_t tx_buf_time_us;
+    uint64_t tx_ring_buf_time_us;
+    uint64_t rx_time_us;
+    uint64_t rx_data_time_us;
+    size_t   enc_len = 0;
+    size_t   nr_of_frames = BENCH_TOTAL_BYTES / frame_size;
+    size_t   nr_of_frames_rx = 0;
+    size_t   i;
+
+    // Encode
+    start_us = px_host_bench_time_us();
+    for(i = 0; i < nr_of_frames; i++)
+    {
+        bench_tx_len = 0;
+        px_hdlc_tx_frame(&bench_hdlc, bench_frame, frame_size);
+    }
+    tx_time_us = px_host_bench_time_us() - start_us;
+
+    // Encode into buffer
+    start_us = px_host_bench_time_us();
+    for(i = 0; i < nr_of_frames; i++)
+    {
+        enc_len += px_hdlc_tx_frame_to_buf(bench_frame, frame_size, bench_enc_buf, sizeof(bench_enc_buf));
+    }
+    tx_buf_time_us = px_host_bench_time_us() - start_us;
+    PX_HOST_CHECK(enc_len == nr_of_frames * bench_tx_len);
+
+    // Encode into ring buffer
+    enc_len  = 0;
+    start_us = px_host_bench_time_us();
+    for(i = 0; i < nr_of_frames; i++)
+    {
+        enc_len += px_hdlc_tx_frame_to_ring_buf(bench_frame, frame_size, &bench_ring_buf);
+        px_ring_buf_flush(&bench_ring_buf, 0);
+    }
+    tx_ring_buf_time_us = px_host_bench_time_us() - start_us;
+    PX_HOST_CHECK(enc_len == nr_of_frames * bench_tx_len);
+
+    // Decode
+    start_us = px_host_bench_time_us();
+    for(i = 0; i < nr_of_frames; i++)
+    {
+        nr_of_frames_rx += bench_rx(bench_tx_buf, bench_tx_len);
+    }
+    rx_time_us = px_host_bench_time_us() - start_us;
+    PX_HOST_CHECK(nr_of_frames_rx == nr_of_frames);
+
+    // Decode in blocks
+    nr_of_frames_rx = 0;
+    start_us        = px_host_bench_time_us();
+    for(i = 0; i < nr_of_frames; i++)
+    {
+        nr_of_frames_rx += px_hdlc_on_rx_data(&bench_hdlc, bench_tx_buf, bench_tx_len);
+    }
+    rx_data_time_us = px_host_bench_time_us() - start_us;
+    PX_HOST_CHECK(nr_of_frames_rx == nr_of_frames);
+
+    printf("%10lu %12.0f %12.0f %12.0f %12.0f %12.0f\n",
+           (unsigned long)frame_size,
+           px_host_bench_per_sec(nr_of_frames, tx_time_us),
+           px_host_bench_per_sec(nr_of_frames, tx_buf_time_us),
+           px_host_bench_per_sec(nr_of_frames, tx_ring_buf_time_us),
+           px_host_bench_per_sec(nr_of_frames, rx_time_us),
+           px_host_bench_per_sec(nr_of_frames, rx_data_time_us));
+}
+
+/// Generate stream of random frames with injected errors
+static void bench_stream_gen(void)
+{
+    uint8_t frame[PX_HDLC_MRU];
+    size_t  len;
+    size_t  enc_len;
+    size_t  i;
+    size_t  j;
+
+    bench_stream_len = 0;
+    for(i = 0; i < BENCH_STREAM_FRAMES; i++)
+    {
+        // Random size, including frames that overflow the receive buffer
+        len = (size_t)rand() % PX_HDLC_MRU;
+        // Random data with many bytes that must be escaped
+        for(j = 0; j < len; j++)
+        {
+            switch(rand() % 16)
+            {
+            case 0:  frame[j] = 0x7e; break;
+            case 1:  frame[j] = 0x7d; break;
+            default: frame[j] = (uint8_t)rand(); break;
+            }
+        }
+        enc_len = px_hdlc_tx_frame_to_buf(frame, len,
+                                          &bench_stream_buf[bench_stream_len],
+                                          PX_HDLC_TX_BUF_SIZE(PX_HDLC_MRU));
+        // Inject error?
+        switch(rand() % 16)
+        {
+        case 0:
+            // Flip a bit
+            bench_stream_buf[bench_stream_len + 1 + (size_t)rand() % (enc_len - 2)] ^= (uint8_t)(1 << (rand() % 8));
+            break;
+        case 1:
+            // Drop a byte
+            j = bench_stream_len + 1 + (size_t)rand() % (enc_len - 2);
+            memmove(&bench_stream_buf[j], &bench_stream_buf[j + 1], bench_stream_len + enc_len - j - 1);
+            enc_len--;
+            break;
+        case 2:
+            // Abort frame with control escape before end marker
+            bench_stream_buf[bench_stream_len + enc_len - 1] = 0x7d;
+            bench_stream_buf[bench_stream_len + enc_len++]   = 0x7e;
+            break;
+        case 3:
+            // Remove end marker (frame merges with the next one)
+            enc_len--;
+            break;
+        case 4:
+            // Extra flag (empty frame)
+            bench_stream_buf[bench_stream_len + enc_len++] = 0x7e;
+            break;
+        default:
+            break;
+        }
+        bench_stream_len += enc_len;
+    }
+}
+
+/// Feed random stream to both decoders and compare accept/reject decisions
+static void bench_stream(void)
+{
+    uint64_t start_us;
+    uint64_t rx_u8_time_us;
+    uint64_t rx_data_time_us;
+    size_t   nr_of_frames_u8;
+    size_t   nr_of_frames_data = 0;
+    size_t   i;
+    size_t   len;
+
+    bench_stream_buf = malloc(BENCH_STREAM_SIZE);
+    PX_HOST_CHECK(bench_stream_buf != NULL);
+    bench_stream_gen();
+
+    // One byte at a time
+    start_us        = px_host_bench_time_us();
+    nr_of_frames_u8 = bench_rx_u8(&bench_hdlc_u8, bench_stream_buf, bench_stream_len);
+    rx_u8_time_us   = px_host_bench_time_us() - start_us;
+
+    // Random sized blocks
+    start_us = px_host_bench_time_us();
+    for(i = 0; i < bench_stream_len; i += len)
+    {
+        len = 1 + (size_t)rand() % 512;
+        if(len > bench_stream_len - i)
+        {
+            len = bench_stream_len - i;
+        }
+        nr_of_frames_data += px_hdlc_on_rx_data(&bench_hdlc_data, &bench_stream_buf[i], len);
+    }
+    rx_data_time_us = px_host_bench_time_us() - start_us;
+
+    // Identical decisions?
+    PX_HOST_CHECK(nr_of_frames_u8 == nr_of_frames_data);
+    PX_HOST_CHECK(bench_rx_log_u8.nr_of_frames == nr_of_frames_u8);
+    PX_HOST_CHECK(bench_rx_log_data.nr_of_frames == nr_of_frames_data);
+    PX_HOST_CHECK(memcmp(bench_rx_log_u8.rec, bench_rx_log_data.rec,
+                         nr_of_frames_u8 * sizeof(bench_rx_rec_t)) == 0);
+
+    printf("\nRandom stream: %u frames (%lu bytes), %lu accepted\n",
+           BENCH_STREAM_FRAMES, (unsigned long)bench_stream_len, (unsigned long)nr_of_frames_u8);
+    printf("%-20s %10.1f MB/s\n", "px_hdlc_on_rx_u8()",
+           px_host_bench_per_sec(bench_stream_len, rx_u8_time_us) / 1e6);
+    printf("%-20s %10.1f MB/s\n", "px_hdlc_on_rx_data()",
+           px_host_bench_per_sec(bench_stream_len, rx_data_time_us) / 1e6);
+
+    free(bench_stream_buf);
+}
+
+int main(void)
+{
+    size_t i;
+
+    // Fill frame with pseudo random data
+    srand(1);
+    for(i = 0; i < sizeof(bench_frame); i++)
+    {
+        bench_frame[i] = (uint8_t)rand();
+    }
+    px_hdlc_init(&bench_hdlc, &bench_tx_u8, &bench_on_rx_frame);
+    px_hdlc_init(&bench_hdlc_u8, NULL, &bench_on_rx_frame_log);
+    px_hdlc_init(&bench_hdlc_data, NULL, &bench_on_rx_frame_log);
+    px_ring_buf_init(&bench_ring_buf, bench_ring_buf_data, sizeof(bench_ring_buf_data));
+
+    printf("px_hdlc benchmark (PX_HDLC_MRU = %u): %s\n\n", PX_HDLC_MRU, bench_name());
+    bench_verify();
+
+    printf("Frames/s:\n");
+    printf("%10s %12s %12s %12s %12s %12s\n", "Frame size", "TX u8 fn", "TX buf", "TX ring buf", "RX u8", "RX data");
+    if(BENCH_FRAME_SIZE_MAX >= 64)
+    {
+        bench_frame_size(64);
+    }
+    bench_frame_size(BENCH_FRAME_SIZE_MAX);
+
+    bench_stream();
+
+    return 0;
+}
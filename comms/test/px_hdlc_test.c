@@ -5,7 +5,9 @@
 #include "uart0.h"
 #include "uart1.h"
 
-static void rs485_tx_u8(uint8_t data)
+static px_hdlc_handle_t px_hdlc_handle;
+
+static void rs485_tx_u8(px_hdlc_handle_t * handle, uint8_t data)
 {
     while(!uart1_tx_byte()data))
     {
@@ -13,7 +15,7 @@ static void rs485_tx_u8(uint8_t data)
     }
 }
 
-void px_hdlc_on_rx_frame(uint8_t * data, size_t nr_of_bytes)
+void px_hdlc_on_rx_frame(px_hdlc_handle_t * handle, const uint8_t * data, size_t nr_of_bytes)
 {
     PX_PRINTF_P("\nHDLC RX [%d]: ", nr_of_bytes);
     while(nr_of_bytes != 0)
@@ -39,14 +41,14 @@ void px_hdlc_test(void)
     uart0_init();
     uart1_init();
     printf_init();
-    px_hdlc_init(&rs485_tx_u8, &px_hdlc_on_rx_frame);
+    px_hdlc_init(&px_hdlc_handle, &rs485_tx_u8, &px_hdlc_on_rx_frame);
 
     // Enable global interrupts
     sei();
         
     // Send an HDLC packet
     data = 0x55;
-    px_hdlc_tx_frame(&data, 1);
+    px_hdlc_tx_frame(&px_hdlc_handle, &data, 1);
 
     // Process received data
     while(true)
@@ -55,7 +57,7 @@ void px_hdlc_test(void)
         {
             PX_PRINTF_P("%02X ", data);
             // Feed received data to HDLC layer
-            px_hdlc_on_rx_u8(data);
+            px_hdlc_on_rx_u8(&px_hdlc_handle, data);
         }
     }
 }
@@ -31,6 +31,8 @@
  *  - data/inc/px_log_fs_glue.h
  *  - data/src/px_log_fs_glue_at25s.c
  *  - data/src/px_log_fs_glue_at45d.c
+ *  - data/inc/px_log_fs_glue_ram.h
+ *  - data/src/px_log_fs_glue_ram.c
  *
  *  1. Introduction
  *  ===============
@@ -61,7 +63,8 @@
  *  file is full (#PX_LOG_FS_CFG_STOP_WR_WHEN_FULL = 1).
  *
  *  The size of each record is configured with #PX_LOG_FS_CFG_REC_DATA_SIZE.
- *  See 'px_log_fs_cfg_template.h'
+ *  See 'px_log_fs_cfg_template.h'. Records can also be variable size (see
+ *  #PX_LOG_FS_CFG_REC_VAR_SIZE).
  *
  *  The erase block size (number of pages) is configurable with
  *  #PX_LOG_FS_CFG_ERASE_BLOCK_SIZE. For example a single page of the Adesto
@@ -84,6 +87,14 @@
  *
  *  @include data/test/px_log_fs_test.c
  *
+ *  The file system can also be exercised on a host PC without hardware by
+ *  using the RAM simulated Serial Flash glue layer (px_log_fs_glue_ram.c). The
+ *  benchmark in data/test/px_log_fs_bench.c reports the number of Serial Flash
+ *  reads, writes and erases as well as execution time for mount, sustained
+ *  write, full read and wrap-around. Build and run it with:
+ *
+ *      make -C tools/px_host_test run
+ *
  *  3. Implementation details
  *  =========================
  *
@@ -171,6 +182,16 @@
  *
  *  ![7. Page 6 is LAST and page 7 is FIRST (largest diff = 85)](log_fs/first_last_07.png)
  *
+ *  With #PX_LOG_FS_CFG_INIT_BIN_SEARCH set to 1, px_log_fs_init() avoids
+ *  reading every page header. Around the circular buffer, the erase blocks form
+ *  one run of marked blocks (with increasing rolling numbers) and one run of
+ *  FREE blocks. Only the header of the first page of an erase block is read to
+ *  binary search for the newest and oldest block. The last page inside the
+ *  newest block and the first FREE record in the last page are also found with
+ *  a binary search, so the number of reads grows logarithmically with the size
+ *  of the file system. If an unexpected marker is found (for example BAD pages
+ *  after px_log_fs_reset()) the full scan described above is performed.
+ *
  *  5. Archiving records
  *  ====================
  *
@@ -186,6 +207,107 @@
  *  that page is inspected until the first unarchived record is found
  *  (RECORD marker =0xAF).
  *
+ *  6. Write cache
+ *  ==============
+ *
+ *  Each px_log_fs_wr() call normally results in a separate Serial Flash write
+ *  (page program cycle) for the record. With #PX_LOG_FS_CFG_WR_CACHE set to 1,
+ *  the page header and records are assembled in a RAM copy of the page
+ *  (inside px_log_fs_handle_t) and written in one operation. Each record still
+ *  has its own marker and CRC, so a write that is interrupted by a power
+ *  failure results in records that are either valid or detected as BAD, never
+ *  partially valid. Records that are still cached when power fails are lost;
+ *  #PX_LOG_FS_CFG_WR_CACHE_MAX_REC and px_log_fs_flush() bound this window.
+ *
+ *  If the page header fails to verify after the cached page is written, the
+ *  page is marked BAD and the cached records are written to the next FREE page
+ *  instead (up to 4 pages are tried). If a cached record fails to verify, only
+ *  that record is marked BAD and lost, even though px_log_fs_wr() had already
+ *  accepted it. px_log_fs_flush() (or the px_log_fs_wr() call that triggered
+ *  it) then returns #PX_LOG_FS_ERR_WRITE_FAIL.
+ *
+ *  7. Variable size records
+ *  =========================
+ *
+ *  With #PX_LOG_FS_CFG_REC_VAR_SIZE set to 1, each record only occupies the
+ *  space needed for its data so that flash capacity and the number of erase
+ *  cycles scale with the actual payload size. Each record consists of an 8-bit
+ *  RECORD marker, an 8-bit data size, the data and an 8-bit CRC calculated
+ *  over the size and data. #PX_LOG_FS_CFG_REC_DATA_SIZE specifies the maximum
+ *  data size (up to 255 bytes).
+ *
+ *  Records still do not span pages. If a record does not fit in the rest of a
+ *  page, it is written on the next page and the rest of the page is left
+ *  FREE. The records in a page are found by following the size of each record
+ *  from the first record. Because a corrupt size can not be trusted, the rest
+ *  of a page is skipped when an invalid (BAD) record is found. Reading
+ *  backwards with px_log_fs_rd_previous() is slower than reading forwards,
+ *  because the records of a page are followed from the start of the page to
+ *  find the previous record. The size of the record that has just been read
+ *  is returned by px_log_fs_rd_rec_size().
+ *
+ *  8. Seeking records by key
+ *  =========================
+ *
+ *  With #PX_LOG_FS_CFG_REC_KEY set to 1, each record contains a key
+ *  (px_log_fs_key_t) at offset #PX_LOG_FS_CFG_REC_KEY_OFFSET in the record
+ *  data, for example a px_rtc_sec_since_y2k_t timestamp. Keys must not decrease
+ *  from one record to the next. When a page is marked, the key of the first
+ *  record is also stored in the page header (which grows to 8 bytes and is
+ *  also protected by the CRC). px_log_fs_rd_seek() binary searches the page
+ *  headers from the FIRST to the LAST page and then scans the records of one
+ *  page, so finding the records of the last hour takes a handful of page reads
+ *  instead of reading the whole file.
+ *
+ *  @warn_s
+ *  Changing #PX_LOG_FS_CFG_REC_KEY changes the page header format. An existing
+ *  file system must be reset.
+ *  @warn_e
+ *
+ *  9. Bulk export
+ *  ==============
+ *
+ *  Reading the whole file with px_log_fs_rd_next() costs at least one Serial
+ *  Flash read per record. px_log_fs_export_rd() reads the records of a page
+ *  with one read and packs the data of the valid records into a buffer, for
+ *  example an HDLC frame (px_hdlc_tx_frame()). The position is kept in an
+ *  export cursor (px_log_fs_cursor_t) which also stores the rolling number of
+ *  the page. If the link drops, the export can be resumed from the cursor of
+ *  the last frame that was acknowledged. If the writer has overwritten those
+ *  records in the mean time, this is detected and the export restarts at the
+ *  first record. The host loopback benchmark in
+ *  data/test/px_log_fs_export_bench.c reports the throughput and number of
+ *  frames per record.
+ *
+ *  10. Wear levelling statistics
+ *  =============================
+ *
+ *  With #PX_LOG_FS_CFG_ERASE_CNT set to 1, the number of times each erase block
+ *  has been erased is stored in the header of the first page of the block.
+ *  The count is read before a block is erased and the incremented count is
+ *  written straight after the erase, while the page marker is still FREE.
+ *  When the page is marked later, the count is written again unchanged and
+ *  protected by the header CRC. So that the count survives a power failure
+ *  between the erase and the write, the incremented count is first copied to
+ *  the header of the last page of the previous block (excluded from the CRC of
+ *  that page) and read from there if the count of the block is missing. A
+ *  block that has never been counted (erased value) reads as zero. An erase
+ *  block must contain at least 2 pages. px_log_fs_reset() marks pages as BAD without
+ *  erasing them, so the counts are kept. The header grows by 4 bytes.
+ *
+ *  px_log_fs_get_erase_count() returns the erase count of one block and
+ *  px_log_fs_get_wear_stats() returns the minimum, maximum and total erase
+ *  count, the number of BAD pages and the number of failed writes since
+ *  px_log_fs_init(). Comparing the maximum erase count with the rated
+ *  endurance of the Serial Flash (for example 100000 cycles) predicts the end
+ *  of life. px_log_fs_dbg_report_info() also prints a histogram of the erase
+ *  counts.
+ *
+ *  @warn_s
+ *  Changing #PX_LOG_FS_CFG_ERASE_CNT changes the page header format. An
+ *  existing file system must be reset.
+ *  @warn_e
+ *
  *  @{
  */
 
@@ -218,6 +340,49 @@
 #error "One or more options not defined in 'px_log_fs_cfg.h'"
 #endif
 
+#ifndef PX_LOG_FS_CFG_INIT_BIN_SEARCH
+/// Locate first and last page with binary search during px_log_fs_init() (1) or always read all page headers (0)
+#define PX_LOG_FS_CFG_INIT_BIN_SEARCH 0
+#endif
+
+#ifndef PX_LOG_FS_CFG_WR_CACHE
+/// Cache records in RAM and write a page of records at a time (1) or write each record immediately (0)
+#define PX_LOG_FS_CFG_WR_CACHE 0
+#endif
+
+#ifndef PX_LOG_FS_CFG_WR_CACHE_MAX_REC
+/// Maximum number of cached records before they are written (0 = cache a whole page of records)
+#define PX_LOG_FS_CFG_WR_CACHE_MAX_REC 0
+#endif
+
+#ifndef PX_LOG_FS_CFG_REC_VAR_SIZE
+/// Store variable size records (1) or fixed size records (0). PX_LOG_FS_CFG_REC_DATA_SIZE is then the maximum record data size
+#define PX_LOG_FS_CFG_REC_VAR_SIZE 0
+#endif
+
+#if (PX_LOG_FS_CFG_REC_VAR_SIZE && (PX_LOG_FS_CFG_REC_DATA_SIZE > 255))
+#error "PX_LOG_FS_CFG_REC_DATA_SIZE can not exceed 255 with variable size records"
+#endif
+
+#ifndef PX_LOG_FS_CFG_REC_KEY
+/// Store key of first record in each page header to support px_log_fs_rd_seek() (1) or not (0)
+#define PX_LOG_FS_CFG_REC_KEY 0
+#endif
+
+#ifndef PX_LOG_FS_CFG_REC_KEY_OFFSET
+/// Offset of key (px_log_fs_key_t) in record data
+#define PX_LOG_FS_CFG_REC_KEY_OFFSET 0
+#endif
+
+#if (PX_LOG_FS_CFG_REC_KEY && ((PX_LOG_FS_CFG_REC_KEY_OFFSET + 4) > PX_LOG_FS_CFG_REC_DATA_SIZE))
+#error "Key does not fit in record data"
+#endif
+
+#ifndef PX_LOG_FS_CFG_ERASE_CNT
+/// Store erase count of each erase block in header of first page in block (1) or not (0)
+#define PX_LOG_FS_CFG_ERASE_CNT 0
+#endif
+
 #if (PX_LOG_FS_CFG_ERASE_BLOCK_SIZE == 0)
 #error "PX_LOG_FS_CFG_ERASE_BLOCK_SIZE cannot be zero"
 #endif
@@ -242,6 +407,9 @@ typedef enum
     PX_LOG_FS_ERR_FATAL,            ///< Fatal file system error
 } px_log_fs_err_t;
 
+/// Record key (for example px_rtc_sec_since_y2k_t timestamp). Must not decrease from one record to the next
+typedef uint32_t px_log_fs_key_t;
+
 /// Specification of data address in Serial Flash
 typedef struct
 {
@@ -249,6 +417,18 @@ typedef struct
     uint16_t offset;                ///< Offset inside page
 } px_log_fs_adr_t;
 
+/**
+ *  Export cursor.
+ *
+ *  Treat as opaque. It can be saved (or sent to the receiver) and passed to
+ *  px_log_fs_export_rd() again later to resume an export.
+ */
+typedef struct
+{
+    px_log_fs_adr_t adr;            ///< Address of next record to export
+    uint16_t        page_nr;        ///< Rolling number of page (to detect that page has been erased since)
+} px_log_fs_cursor_t;
+
 typedef struct
 {
     uint16_t        fs_page_start;  ///< First page in file system (must be on the start of an erase block)
@@ -259,8 +439,28 @@ typedef struct
     px_log_fs_adr_t adr_wr;         ///< Next write address (open position)
     px_log_fs_adr_t adr_rd;         ///< Current read address
     bool            archive_flag;   ///< Flag is set if current read record is archived
+    uint16_t        rd_rec_size;    ///< Data size of current read record
+    uint32_t        init_rd_count;  ///< Number of Serial Flash reads performed by px_log_fs_init()
+    uint32_t        wr_fail_count;  ///< Number of failed writes since px_log_fs_init()
+#if PX_LOG_FS_CFG_WR_CACHE
+    uint16_t        wr_cache_page;      ///< Page of cached header and records
+    uint16_t        wr_cache_offset;    ///< Offset of first cached byte in page (PX_LOG_FS_CFG_PAGE_SIZE if empty)
+    uint8_t         wr_cache_nr_of_rec; ///< Number of cached records
+    uint8_t         wr_cache_buf[PX_LOG_FS_CFG_PAGE_SIZE]; ///< Page image of cached header and records
+#endif
 } px_log_fs_handle_t;
 
+/// Wear levelling statistics
+typedef struct
+{
+    uint16_t nr_of_blocks;          ///< Number of erase blocks in file system
+    uint16_t nr_of_bad_pages;       ///< Number of pages marked BAD
+    uint32_t erase_count_min;       ///< Smallest erase count of a block
+    uint32_t erase_count_max;       ///< Largest erase count of a block
+    uint32_t erase_count_total;     ///< Sum of erase counts of all blocks
+    uint32_t wr_fail_count;         ///< Number of failed writes since px_log_fs_init()
+} px_log_fs_wear_stats_t;
+
 /* _____GLOBAL VARIABLES_____________________________________________________ */
 
 /* _____GLOBAL FUNCTION DECLARATIONS_________________________________________ */
@@ -271,6 +471,13 @@ typedef struct
  *  @param fs_page_start    First page in file system (must be on the start of an erase block)
  *  @param fs_page_end      Last page in file system (must be on the end of an erase block)
  *
+ *  If #PX_LOG_FS_CFG_INIT_BIN_SEARCH is 1, the first and last page is located
+ *  with a binary search over erase blocks and the first free record with a
+ *  binary search over records in the last page. If the layout is not as
+ *  expected (for example BAD pages), a full scan of all page headers is
+ *  performed instead. The number of Serial Flash reads is saved in
+ *  handle->init_rd_count.
+ *
  *  @retval PX_LOG_FS_ERR_NONE  File system was succesfully indexed
  */
 px_log_fs_err_t px_log_fs_init(px_log_fs_handle_t * handle,
@@ -295,7 +502,8 @@ px_log_fs_err_t px_log_fs_reset(px_log_fs_handle_t * handle,
  *  @param handle                   Pointer to file system handle structure
  *  @param data                     Pointer to buffer where record data must be
  *                                  copied to
- *  @param nr_of_bytes              Number of bytes to copy from record
+ *  @param nr_of_bytes              Number of bytes to copy from record (clipped
+ *                                  to record data size)
  *
  *  @retval PX_LOG_FS_ERR_NONE      Valid record data found and copied into
  *                                  structure
@@ -311,7 +519,8 @@ px_log_fs_err_t px_log_fs_rd_first(px_log_fs_handle_t * handle,
  *  @param handle                   Pointer to file system handle structure
  *  @param data                     Pointer to buffer where record data must be
  *                                  copied to
- *  @param nr_of_bytes              Number of bytes to copy from record
+ *  @param nr_of_bytes              Number of bytes to copy from record (clipped
+ *                                  to record data size)
  *
  *  @retval PX_LOG_FS_ERR_NONE      Valid record data found and copied into
  *                                  structure
@@ -326,7 +535,8 @@ px_log_fs_err_t px_log_fs_rd_first_unarchived(px_log_fs_handle_t * handle,
  *  @param handle                   Pointer to file system handle structure
  *  @param data                     Pointer to buffer where record data must be
  *                                  copied to
- *  @param nr_of_bytes              Number of bytes to copy from record
+ *  @param nr_of_bytes              Number of bytes to copy from record (clipped
+ *                                  to record data size)
  *
  *  @retval PX_LOG_FS_ERR_NONE      Valid record data found and copied into
  *                                  structure
@@ -342,7 +552,8 @@ px_log_fs_err_t px_log_fs_rd_next(px_log_fs_handle_t * handle,
  *  @param handle                   Pointer to file system handle structure
  *  @param data                     Pointer to buffer where record data must be
  *                                  copied to
- *  @param nr_of_bytes              Number of bytes to copy from record
+ *  @param nr_of_bytes              Number of bytes to copy from record (clipped
+ *                                  to record data size)
  *
  *  @retval PX_LOG_FS_ERR_NONE      Valid record data found and copied into
  *                                  structure
@@ -358,7 +569,8 @@ px_log_fs_err_t px_log_fs_rd_last(px_log_fs_handle_t * handle,
  *  @param handle                   Pointer to file system handle structure
  *  @param data                     Pointer to buffer where record data must be
  *                                  copied to
- *  @param nr_of_bytes              Number of bytes to copy from record
+ *  @param nr_of_bytes              Number of bytes to copy from record (clipped
+ *                                  to record data size)
  *
  *  @retval PX_LOG_FS_ERR_NONE      Valid record data found and copied into
  *                                  structure
@@ -368,6 +580,86 @@ px_log_fs_err_t px_log_fs_rd_previous(px_log_fs_handle_t * handle,
                                       void *               data,
                                       size_t               nr_of_bytes);
 
+#if PX_LOG_FS_CFG_REC_KEY
+/**
+ *  Seek and read first (oldest) record with a key that is equal or larger
+ *  than the specified key.
+ *
+ *  Only available if #PX_LOG_FS_CFG_REC_KEY is 1. Page headers are binary
+ *  searched for the last page that starts with a smaller key, followed by a
+ *  scan of the records from the start of that page. Continue reading with
+ *  px_log_fs_rd_next() afterwards, for example to download the last hour of
+ *  records.
+ *
+ *  @param handle                   Pointer to file system handle structure
+ *  @param key                      Key to seek (for example a
+ *                                  px_rtc_sec_since_y2k_t timestamp)
+ *  @param data                     Pointer to buffer where record data must be
+ *                                  copied to
+ *  @param nr_of_bytes              Number of bytes to copy from record (clipped
+ *                                  to record data size)
+ *
+ *  @retval PX_LOG_FS_ERR_NONE      Valid record data found and copied into
+ *                                  structure
+ *  @retval PX_LOG_FS_ERR_EMPTY     File is empty
+ *  @retval PX_LOG_FS_ERR_NO_RECORD No record found with a key that is equal or
+ *                                  larger
+ */
+px_log_fs_err_t px_log_fs_rd_seek(px_log_fs_handle_t * handle,
+                                  px_log_fs_key_t      key,
+                                  void *               data,
+                                  size_t               nr_of_bytes);
+#endif
+
+/**
+ *  Start a bulk export at the first (oldest) record.
+ *
+ *  @param handle                   Pointer to file system handle structure
+ *  @param cursor                   Pointer to export cursor that will be
+ *                                  initialised
+ *
+ *  @retval PX_LOG_FS_ERR_NONE      Cursor points to first record
+ *  @retval PX_LOG_FS_ERR_EMPTY     File is empty. Cursor points to write
+ *                                  address so that new records will be
+ *                                  exported
+ */
+px_log_fs_err_t px_log_fs_export_start(px_log_fs_handle_t * handle,
+                                       px_log_fs_cursor_t * cursor);
+
+/**
+ *  Export as many records as fit into the specified buffer.
+ *
+ *  Records are read from Serial Flash a page (or what fits in the buffer) at
+ *  a time instead of a record at a time. FREE and BAD records are skipped and
+ *  the data of valid records is packed back to back in the buffer:
+ *  - Fixed size records: #PX_LOG_FS_CFG_REC_DATA_SIZE data bytes per record
+ *  - Variable size records: an 8-bit data size, followed by the data bytes
+ *
+ *  The buffer is also used to read the records, so no extra RAM is required.
+ *  The cursor is advanced past the exported records. If the records at the
+ *  cursor have been overwritten in the mean time, the export restarts at the
+ *  first (oldest) record. Records that fail the CRC check are skipped, but
+ *  not marked as BAD.
+ *
+ *  @param handle                   Pointer to file system handle structure
+ *  @param cursor                   Pointer to export cursor
+ *  @param data                     Pointer to buffer where packed record data
+ *                                  must be copied to, for example an HDLC frame
+ *  @param nr_of_bytes              Size of buffer
+ *  @param nr_of_bytes_exported     Pointer to variable that will receive the
+ *                                  number of packed bytes in the buffer
+ *
+ *  @retval PX_LOG_FS_ERR_NONE      One or more records exported
+ *  @retval PX_LOG_FS_ERR_NO_RECORD No more records (or buffer too small for
+ *                                  the next record)
+ *  @retval PX_LOG_FS_ERR_EMPTY     File is empty
+ */
+px_log_fs_err_t px_log_fs_export_rd(px_log_fs_handle_t * handle,
+                                    px_log_fs_cursor_t * cursor,
+                                    void *               data,
+                                    size_t               nr_of_bytes,
+                                    size_t *             nr_of_bytes_exported);
+
 /**
  *  See if currently read record is archived or not.
  *
@@ -384,6 +676,24 @@ bool inline px_log_fs_rd_rec_is_archived(px_log_fs_handle_t * handle)
     return handle->archive_flag;
 }
 
+/**
+ *  Get data size of currently read record.
+ *
+ *  NB! Record *MUST* have been succesfully read first.
+ *
+ *  With variable size records (#PX_LOG_FS_CFG_REC_VAR_SIZE = 1) this is the
+ *  number of bytes that was written with px_log_fs_wr(). With fixed size
+ *  records it is always #PX_LOG_FS_CFG_REC_DATA_SIZE.
+ *
+ *  @param handle                   Pointer to file system handle structure
+ *
+ *  @return uint16_t                Number of data bytes stored in record
+ */
+uint16_t inline px_log_fs_rd_rec_size(px_log_fs_handle_t * handle)
+{
+    return handle->rd_rec_size;
+}
+
 /**
  *  Set currently read record as archived.
  *
@@ -408,7 +718,14 @@ px_log_fs_err_t px_log_fs_rd_rec_set_archive(px_log_fs_handle_t * handle);
  *
  *  A new record is appended to the end of the list of records. The maximum
  *  number of bytes that can be stored in the record is specified by
- *  PX_LOG_FS_CFG_DATA_SIZE.
+ *  #PX_LOG_FS_CFG_REC_DATA_SIZE. With variable size records
+ *  (#PX_LOG_FS_CFG_REC_VAR_SIZE = 1) only the specified number of bytes are
+ *  stored.
+ *
+ *  If #PX_LOG_FS_CFG_WR_CACHE is 1, the record is cached in RAM and the page
+ *  header and cached records are written in one operation when the page is
+ *  full, when #PX_LOG_FS_CFG_WR_CACHE_MAX_REC records have been cached or
+ *  when px_log_fs_flush() is called.
  *
  *  @param handle                   Pointer to file system handle structure
  *  @param data                     Pointer to buffer containing data that must
@@ -423,9 +740,62 @@ px_log_fs_err_t px_log_fs_wr(px_log_fs_handle_t * handle,
                              const void *         data,
                              size_t               nr_of_bytes);
 
+/**
+ *  Write cached records to Serial Flash.
+ *
+ *  Only has an effect if #PX_LOG_FS_CFG_WR_CACHE is 1. Cached records are
+ *  lost if power is interrupted before they are written, so this function
+ *  should be called before entering a low power mode or periodically (for
+ *  example with a px_systmr timer) to bound the time a record may stay in RAM.
+ *  Read functions call this function first so that cached records are found.
+ *
+ *  A page header that fails to verify is marked BAD and the cached records are
+ *  moved to the next FREE page. A cached record that fails to verify is marked
+ *  BAD and is lost.
+ *
+ *  @param handle                       Pointer to file system handle structure
+ *
+ *  @retval PX_LOG_FS_ERR_NONE          Success (or nothing to write)
+ *  @retval PX_LOG_FS_ERR_FULL          File system is full; cached records lost
+ *  @retval PX_LOG_FS_ERR_WRITE_FAIL    Failed to write one or more records
+ */
+px_log_fs_err_t px_log_fs_flush(px_log_fs_handle_t * handle);
+
+#if PX_LOG_FS_CFG_ERASE_CNT
+/**
+ *  Get erase count of the erase block that contains the specified page.
+ *
+ *  Only available if #PX_LOG_FS_CFG_ERASE_CNT is 1.
+ *
+ *  @param handle                   Pointer to file system handle structure
+ *  @param page                     Page in erase block
+ *
+ *  @return uint32_t                Number of times that the block has been
+ *                                  erased by the file system
+ */
+uint32_t px_log_fs_get_erase_count(px_log_fs_handle_t * handle,
+                                   uint16_t             page);
+#endif
+
+/**
+ *  Get wear levelling statistics.
+ *
+ *  The header of each page is read to count BAD pages. Erase counts are only
+ *  reported if #PX_LOG_FS_CFG_ERASE_CNT is 1 (otherwise they are zero).
+ *
+ *  @param handle                   Pointer to file system handle structure
+ *  @param stats                    Pointer to structure that will receive the
+ *                                  statistics
+ */
+void px_log_fs_get_wear_stats(px_log_fs_handle_t *     handle,
+                              px_log_fs_wear_stats_t * stats);
+
 /**
  *  Report log file system info.
  *
+ *  If #PX_LOG_FS_CFG_ERASE_CNT is 1, a histogram of the erase counts of all
+ *  erase blocks is also reported.
+ *
  *  @param handle                   Pointer to file system handle structure
  */
 void px_log_fs_dbg_report_info(px_log_fs_handle_t * handle);
@@ -46,5 +46,26 @@
 /// Stop writing when full (1) or erase oldest records and continue writing (0)
 #define PX_LOG_FS_CFG_STOP_WR_WHEN_FULL 0
 
+/// Locate first and last page with binary search during px_log_fs_init() (1) or always read all page headers (0)
+#define PX_LOG_FS_CFG_INIT_BIN_SEARCH   0
+
+/// Cache records in RAM and write a page of records at a time (1) or write each record immediately (0)
+#define PX_LOG_FS_CFG_WR_CACHE          0
+
+/// Maximum number of cached records before they are written (0 = cache a whole page of records)
+#define PX_LOG_FS_CFG_WR_CACHE_MAX_REC  0
+
+/// Store variable size records (1) or fixed size records (0). PX_LOG_FS_CFG_REC_DATA_SIZE is then the maximum record data size
+#define PX_LOG_FS_CFG_REC_VAR_SIZE      0
+
+/// Store key of first record in each page header to support px_log_fs_rd_seek() (1) or not (0)
+#define PX_LOG_FS_CFG_REC_KEY           0
+
+/// Offset of key (px_log_fs_key_t) in record data
+#define PX_LOG_FS_CFG_REC_KEY_OFFSET    0
+
+/// Store erase count of each erase block in header of first page in block (1) or not (0)
+#define PX_LOG_FS_CFG_ERASE_CNT         0
+
 /// @}
 #endif
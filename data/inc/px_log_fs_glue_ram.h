@@ -0,0 +1,128 @@
+#ifndef __PX_LOG_FS_GLUE_RAM_H__
+#define __PX_LOG_FS_GLUE_RAM_H__
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_log_fs_glue_ram.h : RAM simulated Serial Flash glue layer for Log FS
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/**
+ *  @addtogroup PX_LOG_FS
+ *
+ *  RAM simulated Serial Flash glue layer.
+ *
+ *  File(s):
+ *  - data/inc/px_log_fs_glue_ram.h
+ *  - data/src/px_log_fs_glue_ram.c
+ *
+ *  This glue layer replaces px_log_fs_glue_at25s.c / px_log_fs_glue_at45d.c
+ *  so that px_log_fs can be exercised and benchmarked on a host PC without
+ *  hardware. A caller supplied RAM buffer is used with NOR Flash semantics:
+ *  - An erase sets all bytes in the erase block to 0xFF
+ *  - A write can only clear bits (new value = old value AND written value)
+ *
+ *  Each read, write and erase operation is counted and an optional delay
+ *  function can be specified to inject the latency of a real device.
+ *
+ *  @{
+ */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_defs.h"
+#include "px_log_fs_glue.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/* _____DEFINITIONS__________________________________________________________ */
+
+/* _____TYPE DEFINITIONS_____________________________________________________ */
+/// Operation counters
+typedef struct
+{
+    uint32_t rd_count;          ///< Number of read operations
+    uint32_t rd_bytes;          ///< Number of bytes read
+    uint32_t wr_count;          ///< Number of write operations
+    uint32_t wr_bytes;          ///< Number of bytes written
+    uint32_t erase_count;       ///< Number of block erase operations
+} px_log_fs_glue_ram_stats_t;
+
+/// Delay function used to inject device latency
+typedef void (*px_log_fs_glue_ram_delay_fn_t)(uint32_t delay_us);
+
+/// Injected latency per operation (in microseconds)
+typedef struct
+{
+    uint32_t rd_us;             ///< Latency of each read operation
+    uint32_t wr_us;             ///< Latency of each write (page program) operation
+    uint32_t erase_us;          ///< Latency of each block erase operation
+} px_log_fs_glue_ram_latency_t;
+
+/* _____GLOBAL VARIABLES_____________________________________________________ */
+
+/* _____GLOBAL FUNCTION DECLARATIONS_________________________________________ */
+/**
+ *  Initialise RAM simulated Serial Flash.
+ *
+ *  The whole buffer is erased (set to 0xFF) and the counters are reset.
+ *
+ *  @param buf              Buffer of (nr_of_pages * PX_LOG_FS_CFG_PAGE_SIZE) bytes
+ *  @param nr_of_pages      Number of pages (must be a multiple of
+ *                          PX_LOG_FS_CFG_ERASE_BLOCK_SIZE)
+ */
+void px_log_fs_glue_ram_init(uint8_t * buf, uint16_t nr_of_pages);
+
+/**
+ *  Specify latency that must be injected for each operation.
+ *
+ *  @param delay_fn         Delay function to call (NULL to disable)
+ *  @param latency          Latency per operation (NULL to disable)
+ */
+void px_log_fs_glue_ram_set_latency(px_log_fs_glue_ram_delay_fn_t        delay_fn,
+                                    const px_log_fs_glue_ram_latency_t * latency);
+
+/**
+ *  Get operation counters.
+ *
+ *  @param stats            Pointer to structure that will receive counters
+ */
+void px_log_fs_glue_ram_get_stats(px_log_fs_glue_ram_stats_t * stats);
+
+/**
+ *  Reset operation counters.
+ */
+void px_log_fs_glue_ram_reset_stats(void);
+
+/**
+ *  Get pointer to start of simulated page.
+ *
+ *  Can be used to inspect content or to inject bit faults.
+ *
+ *  @param page             Page number
+ *
+ *  @return uint8_t *       Pointer to start of page in buffer
+ */
+uint8_t * px_log_fs_glue_ram_get_page(uint16_t page);
+
+/* _____MACROS_______________________________________________________________ */
+
+#ifdef __cplusplus
+}
+#endif
+
+/// @}
+#endif
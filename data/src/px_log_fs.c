@@ -44,11 +44,29 @@ PX_LOG_NAME("px_log_fs");
 /// Definition of header structure that is stored at the start of each page
 typedef struct
 {
-    uint8_t  marker;                            ///< FREE, PAGE, PAGE_A or BAD
-    uint16_t nr;                                ///< Rolling number to find first and last marked page
-    uint8_t  crc;                               ///< Checksum calculated over nr (excludes marker)
+    uint8_t         marker;                     ///< FREE, PAGE, PAGE_A or BAD
+    uint16_t        nr;                         ///< Rolling number to find first and last marked page
+#if PX_LOG_FS_CFG_REC_KEY
+    px_log_fs_key_t key;                        ///< Key of first record in page
+#endif
+#if PX_LOG_FS_CFG_ERASE_CNT
+    uint32_t        erase_cnt;                  ///< Erase count of block (first page of block) or copy of next block's erase count (last page of block)
+#endif
+    uint8_t         crc;                        ///< Checksum calculated over nr, key and erase count of first page of block (excludes marker)
 } PX_ATTR_PACKED px_log_fs_header_t;
 
+#if PX_LOG_FS_CFG_REC_VAR_SIZE
+/// Definition of a variable size record structure (maximum size)
+typedef struct
+{
+    uint8_t marker;                                 ///< RECORD or RECORD_A
+    uint8_t size;                                   ///< Number of data bytes
+    uint8_t data[PX_LOG_FS_CFG_REC_DATA_SIZE + 1];  ///< Record data content, followed by checksum calculated over size and data (excludes marker)
+} PX_ATTR_PACKED px_log_fs_record_t;
+
+/// Record size (including overhead) for specified number of data bytes
+#define PX_LOG_FS_REC_SIZE(data_size)   ((uint16_t)(data_size) + 3)
+#else
 /// Definition of a record structure
 typedef struct
 {
@@ -57,20 +75,35 @@ typedef struct
     uint8_t crc;                                ///< Checksum calculated over data (excludes marker)
 } PX_ATTR_PACKED px_log_fs_record_t;
 
+/// Record size (including overhead) is fixed
+#define PX_LOG_FS_REC_SIZE(data_size)   (sizeof(px_log_fs_record_t))
+#endif
+
 /// Page data size (page size - page header)
 #define PX_LOG_FS_PAGE_DATA_SIZE    (PX_LOG_FS_CFG_PAGE_SIZE - sizeof(px_log_fs_header_t))
-/// Records per page
-#define PX_LOG_FS_RECORDS_PER_PAGE  (PX_LOG_FS_PAGE_DATA_SIZE / sizeof(px_log_fs_record_t))
 /// First record offset
 #define PX_LOG_FS_REC_OFFSET_FIRST  (sizeof(px_log_fs_header_t))
+#if !PX_LOG_FS_CFG_REC_VAR_SIZE
+/// Records per page
+#define PX_LOG_FS_RECORDS_PER_PAGE  (PX_LOG_FS_PAGE_DATA_SIZE / sizeof(px_log_fs_record_t))
 /// Last record offset
 #define PX_LOG_FS_REC_OFFSET_LAST   (sizeof(px_log_fs_header_t) + (PX_LOG_FS_RECORDS_PER_PAGE - 1) * sizeof(px_log_fs_record_t))
+#endif
+
+/// Number of pages tried to write cached records to before they are discarded
+#define PX_LOG_FS_WR_CACHE_RETRY_MAX 4
+
+#if PX_LOG_FS_CFG_ERASE_CNT && (PX_LOG_FS_CFG_ERASE_BLOCK_SIZE < 2)
+#error "PX_LOG_FS_CFG_ERASE_CNT requires an erase block of 2 or more pages"
+#endif
 
 /* _____MACROS_______________________________________________________________ */
 
 /* _____GLOBAL VARIABLES_____________________________________________________ */
 
 /* _____LOCAL VARIABLES______________________________________________________ */
+/// Number of Serial Flash read operations (used to report mount cost)
+static uint32_t px_log_fs_rd_count;
 
 /* _____LOCAL FUNCTION DECLARATIONS__________________________________________ */
 
@@ -157,6 +190,24 @@ static uint16_t px_log_fs_page_previous(const px_log_fs_handle_t * handle,
     }
 }
 
+#if PX_LOG_FS_CFG_REC_KEY
+static uint16_t px_log_fs_page_add(const px_log_fs_handle_t * handle,
+                                   uint16_t                   page,
+                                   uint16_t                   nr_of_pages)
+{
+    uint32_t offset;
+
+    // Calculate offset from start and wrap if past end
+    offset = (uint32_t)(page - handle->fs_page_start) + nr_of_pages;
+    if(offset > (uint32_t)(handle->fs_page_end - handle->fs_page_start))
+    {
+        offset -= (uint32_t)(handle->fs_page_end - handle->fs_page_start) + 1;
+    }
+    return handle->fs_page_start + (uint16_t)offset;
+}
+#endif
+
+#if !PX_LOG_FS_CFG_REC_VAR_SIZE
 static void px_log_fs_record_adr_next(const px_log_fs_handle_t * handle,
                                       px_log_fs_adr_t *          adr)
 {
@@ -191,6 +242,23 @@ static void px_log_fs_record_adr_previous(const px_log_fs_handle_t * handle,
     }
 }
 
+static inline uint16_t px_log_fs_record_offset_last(const px_log_fs_handle_t * handle,
+                                                    uint16_t                   page)
+{
+    // Last record offset is fixed
+    return PX_LOG_FS_REC_OFFSET_LAST;
+}
+#endif
+
+static inline uint16_t px_log_fs_record_size(const px_log_fs_record_t * record)
+{
+#if PX_LOG_FS_CFG_REC_VAR_SIZE
+    return PX_LOG_FS_REC_SIZE(record->size);
+#else
+    return sizeof(px_log_fs_record_t);
+#endif
+}
+
 static uint8_t px_log_fs_crc(const void * data, size_t nr_of_bytes)
 {
     uint8_t   i;
@@ -228,11 +296,22 @@ static uint8_t px_log_fs_crc(const void * data, size_t nr_of_bytes)
     return crc;
 }
 
+static void px_log_fs_flash_rd(void *   buf,
+                               uint16_t page,
+                               uint16_t start_byte_in_page,
+                               uint16_t nr_of_bytes)
+{
+    // Count read operation
+    px_log_fs_rd_count++;
+    // Read data from Serial Flash
+    px_log_fs_glue_rd(buf, page, start_byte_in_page, nr_of_bytes);
+}
+
 static uint8_t px_log_fs_marker_rd(const px_log_fs_adr_t * adr)
 {
     uint8_t marker_rd;
 
-    px_log_fs_glue_rd(&marker_rd, adr->page, adr->offset, sizeof(marker_rd));
+    px_log_fs_flash_rd(&marker_rd, adr->page, adr->offset, sizeof(marker_rd));
 
     return marker_rd;
 }
@@ -244,7 +323,7 @@ static bool px_log_fs_marker_wr(uint8_t                 marker,
     uint8_t marker_rd;
 
     px_log_fs_glue_wr(&marker_wr, adr->page, adr->offset, sizeof(marker_wr));
-    px_log_fs_glue_rd(&marker_rd, adr->page, adr->offset, sizeof(marker_rd));
+    px_log_fs_flash_rd(&marker_rd, adr->page, adr->offset, sizeof(marker_rd));
     if(marker_rd == marker_wr)
     {
         // Success
@@ -257,15 +336,110 @@ static bool px_log_fs_marker_wr(uint8_t                 marker,
     }
 }
 
+#if PX_LOG_FS_CFG_REC_VAR_SIZE
+static void px_log_fs_record_adr_skip(const px_log_fs_handle_t * handle,
+                                      px_log_fs_adr_t *          adr,
+                                      uint16_t                   rec_size)
+{
+    // Skip record
+    adr->offset += rec_size;
+    // Is there space left for another record on page?
+    if(adr->offset + PX_LOG_FS_REC_SIZE(0) > PX_LOG_FS_CFG_PAGE_SIZE)
+    {
+        // First record on next page
+        adr->page   = px_log_fs_page_next(handle, adr->page);
+        adr->offset = PX_LOG_FS_REC_OFFSET_FIRST;
+    }
+}
+
+static void px_log_fs_record_adr_next(const px_log_fs_handle_t * handle,
+                                      px_log_fs_adr_t *          adr)
+{
+    uint8_t rec_hdr[2];
+
+    // Read record marker and size
+    px_log_fs_flash_rd(rec_hdr, adr->page, adr->offset, sizeof(rec_hdr));
+    // Valid record marker and size?
+    if(  (px_log_fs_marker_is_record(rec_hdr[0])                                       )
+       &&(rec_hdr[1] <= PX_LOG_FS_CFG_REC_DATA_SIZE                                    )
+       &&(adr->offset + PX_LOG_FS_REC_SIZE(rec_hdr[1]) <= PX_LOG_FS_CFG_PAGE_SIZE)  )
+    {
+        // Next record
+        px_log_fs_record_adr_skip(handle, adr, PX_LOG_FS_REC_SIZE(rec_hdr[1]));
+    }
+    else
+    {
+        // FREE, BAD or invalid record. Rest of page is unused or can not be
+        // trusted. First record on next page
+        adr->page   = px_log_fs_page_next(handle, adr->page);
+        adr->offset = PX_LOG_FS_REC_OFFSET_FIRST;
+    }
+}
+
+static void px_log_fs_record_adr_previous(const px_log_fs_handle_t * handle,
+                                          px_log_fs_adr_t *          adr)
+{
+    px_log_fs_adr_t adr_prev;
+    px_log_fs_adr_t adr_next;
+
+    // Record sizes vary, so walk forward from the first record on the page
+    adr_prev.page   = adr->page;
+    adr_prev.offset = PX_LOG_FS_REC_OFFSET_FIRST;
+    while(true)
+    {
+        adr_next = adr_prev;
+        px_log_fs_record_adr_next(handle, &adr_next);
+        // Reached specified record (or end of page)?
+        if(  (adr_next.page   != adr->page  )
+           ||(adr_next.offset >= adr->offset)  )
+        {
+            // Previous record found
+            adr->offset = adr_prev.offset;
+            return;
+        }
+        adr_prev = adr_next;
+    }
+}
+
+static uint16_t px_log_fs_record_offset_last(const px_log_fs_handle_t * handle,
+                                             uint16_t                   page)
+{
+    px_log_fs_adr_t adr;
+
+    // Set address to end of page and find the record before it
+    adr.page   = page;
+    adr.offset = PX_LOG_FS_CFG_PAGE_SIZE;
+    px_log_fs_record_adr_previous(handle, &adr);
+
+    return adr.offset;
+}
+#endif
+
+static uint8_t px_log_fs_header_crc(const px_log_fs_header_t * header, uint16_t page)
+{
+#if PX_LOG_FS_CFG_ERASE_CNT
+    // Not first page in block?
+    if((page % PX_LOG_FS_CFG_ERASE_BLOCK_SIZE) != 0)
+    {
+        // Exclude erase count copy (written after page is marked)
+        return px_log_fs_crc(&header->nr,
+                             offsetof(px_log_fs_header_t, erase_cnt) - offsetof(px_log_fs_header_t, nr));
+    }
+#endif
+    // Calculate CRC over all fields between marker and CRC
+    return px_log_fs_crc(&header->nr,
+                         offsetof(px_log_fs_header_t, crc) - offsetof(px_log_fs_header_t, nr));
+}
+
 static uint8_t px_log_fs_header_rd(px_log_fs_header_t * header, uint16_t page)
 {
     uint8_t crc;
 
     // Read page header
-    px_log_fs_glue_rd(header,
-                      page,
-                      0,
-                      sizeof(px_log_fs_header_t));
+    px_log_fs_flash_rd(header,
+                       page,
+                       0,
+                       sizeof(px_log_fs_header_t));
     // Page FREE or BAD?
     if(    px_log_fs_marker_is_free(header->marker)
         || px_log_fs_marker_is_bad(header->marker )  )
@@ -282,7 +456,7 @@ static uint8_t px_log_fs_header_rd(px_log_fs_header_t * header, uint16_t page)
         return header->marker;
     }
     // Check CRC
-    crc = px_log_fs_crc(&header->nr, sizeof(header->nr));
+    crc = px_log_fs_header_crc(header, page);
     if(crc != header->crc)
     {
         // Mark as BAD
@@ -352,16 +526,17 @@ static uint16_t px_log_fs_header_rd_next(const px_log_fs_handle_t * handle,
     }
 }
 
+#if !PX_LOG_FS_CFG_WR_CACHE
 static bool px_log_fs_header_wr(px_log_fs_header_t * header, uint16_t page)
 {
     px_log_fs_header_t header_rd;
 
     // Set CRC
-    header->crc = px_log_fs_crc(&header->nr, sizeof(header->nr));
+    header->crc = px_log_fs_header_crc(header, page);
     // Write header
     px_log_fs_glue_wr(header, page, 0, sizeof(*header));
     // Read back header
-    px_log_fs_glue_rd(&header_rd, page, 0, sizeof(*header));
+    px_log_fs_flash_rd(&header_rd, page, 0, sizeof(*header));
     // Match?
     if(memcmp(header, &header_rd, sizeof(*header)) != 0)
     {
@@ -375,6 +550,28 @@ static bool px_log_fs_header_wr(px_log_fs_header_t * header, uint16_t page)
     // Success
     return true;
 }
+#endif
+
+static uint8_t px_log_fs_record_crc(const px_log_fs_record_t * record)
+{
+#if PX_LOG_FS_CFG_REC_VAR_SIZE
+    // Calculate CRC over size and data
+    return px_log_fs_crc(&record->size, record->size + 1);
+#else
+    // Calculate CRC over data
+    return px_log_fs_crc(&record->data, sizeof(record->data));
+#endif
+}
+
+static inline uint8_t * px_log_fs_record_crc_ptr(px_log_fs_record_t * record)
+{
+#if PX_LOG_FS_CFG_REC_VAR_SIZE
+    // CRC follows data
+    return &record->data[record->size];
+#else
+    return &record->crc;
+#endif
+}
 
 static uint8_t px_log_fs_record_rd(px_log_fs_record_t *    record,
                                    const px_log_fs_adr_t * adr)
@@ -382,7 +579,19 @@ static uint8_t px_log_fs_record_rd(px_log_fs_record_t *    record,
     uint8_t crc;
 
     // Read record
-    px_log_fs_glue_rd(record, adr->page, adr->offset, sizeof(*record));
+#if PX_LOG_FS_CFG_REC_VAR_SIZE
+    // Read maximum record size (or up to end of page) at once
+    if(adr->offset + sizeof(*record) > PX_LOG_FS_CFG_PAGE_SIZE)
+    {
+        px_log_fs_flash_rd(record, adr->page, adr->offset, PX_LOG_FS_CFG_PAGE_SIZE - adr->offset);
+    }
+    else
+    {
+        px_log_fs_flash_rd(record, adr->page, adr->offset, sizeof(*record));
+    }
+#else
+    px_log_fs_flash_rd(record, adr->page, adr->offset, sizeof(*record));
+#endif
     // FREE or BAD?
     if(    px_log_fs_marker_is_free(record->marker)
         || px_log_fs_marker_is_bad (record->marker)  )
@@ -399,13 +608,26 @@ static uint8_t px_log_fs_record_rd(px_log_fs_record_t *    record,
         px_log_fs_glue_wr(&record->marker, adr->page, adr->offset, 1);
         return record->marker;
     }
+#if PX_LOG_FS_CFG_REC_VAR_SIZE
+    // Size correct?
+    if(  (record->size > PX_LOG_FS_CFG_REC_DATA_SIZE                                  )
+       ||(adr->offset + PX_LOG_FS_REC_SIZE(record->size) > PX_LOG_FS_CFG_PAGE_SIZE)  )
+    {
+        // No. Mark as BAD
+        PX_LOG_E("Invalid record size %u @ page %u offset %u",
+                 record->size, adr->page, adr->offset);
+        record->marker = PX_LOG_FS_MARKER_BAD;
+        px_log_fs_glue_wr(&record->marker, adr->page, adr->offset, 1);
+        return record->marker;
+    }
+#endif
     // CRC correct?
-    crc = px_log_fs_crc(&record->data, sizeof(record->data));
-    if(crc != record->crc)
+    crc = px_log_fs_record_crc(record);
+    if(crc != *px_log_fs_record_crc_ptr(record))
     {
         // Mark record as BAD
         PX_LOG_E("Record CRC check failed @ page %u offset %u (0x%02X != 0x%02X)",
-                 adr->page, adr->offset, record->crc != crc);
+                 adr->page, adr->offset, *px_log_fs_record_crc_ptr(record), crc);
         record->marker = PX_LOG_FS_MARKER_BAD;
         px_log_fs_glue_wr(&record->marker, adr->page, adr->offset, 1);
         return record->marker;
@@ -414,13 +636,15 @@ static uint8_t px_log_fs_record_rd(px_log_fs_record_t *    record,
     return record->marker;
 }
 
+#if !PX_LOG_FS_CFG_WR_CACHE
 static bool px_log_fs_record_wr(px_log_fs_record_t *    record,
                                 const px_log_fs_adr_t * adr)
 {
     px_log_fs_record_t record_rd;
+    uint16_t           rec_size = px_log_fs_record_size(record);
 
     // Sanity check
-    if(adr->offset + sizeof(px_log_fs_record_t) > PX_LOG_FS_CFG_PAGE_SIZE)
+    if(adr->offset + rec_size > PX_LOG_FS_CFG_PAGE_SIZE)
     {
         PX_LOG_E("Record will overflow the page");
         return false;
@@ -429,13 +653,13 @@ static bool px_log_fs_record_wr(px_log_fs_record_t *    record,
     // Set marker
     record->marker = PX_LOG_FS_MARKER_RECORD;
     // Set CRC
-    record->crc = px_log_fs_crc(&record->data, sizeof(record->data));
+    *px_log_fs_record_crc_ptr(record) = px_log_fs_record_crc(record);
     // Write record
-    px_log_fs_glue_wr(record, adr->page, adr->offset, sizeof(*record));
+    px_log_fs_glue_wr(record, adr->page, adr->offset, rec_size);
     // Read back record
-    px_log_fs_glue_rd(&record_rd, adr->page, adr->offset, sizeof(*record));
+    px_log_fs_flash_rd(&record_rd, adr->page, adr->offset, rec_size);
     // Match?
-    if(memcmp(record, &record_rd, sizeof(*record)) != 0)
+    if(memcmp(record, &record_rd, rec_size) != 0)
     {
         // Mark record as BAD
         PX_LOG_E("Record write failed @ page %u offset %u", adr->page, adr->offset);
@@ -447,14 +671,245 @@ static bool px_log_fs_record_wr(px_log_fs_record_t *    record,
     // Success
     return true;
 }
+#endif
 
-/* _____GLOBAL FUNCTIONS_____________________________________________________ */
-px_log_fs_err_t px_log_fs_init(px_log_fs_handle_t * handle,
-                               uint16_t             fs_page_start,
-                               uint16_t             fs_page_end)
+static bool px_log_fs_block_has_page(uint16_t block_page, uint16_t page)
+{
+    if(  (page >= block_page                                 )
+       &&(page <  block_page + PX_LOG_FS_CFG_ERASE_BLOCK_SIZE)  )
+    {
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+#if PX_LOG_FS_CFG_ERASE_CNT
+static uint32_t px_log_fs_erase_cnt_rd(const px_log_fs_handle_t * handle,
+                                       uint16_t                   block_page)
+{
+    uint32_t erase_cnt;
+
+    // Read erase count from header of first page in block
+    px_log_fs_flash_rd(&erase_cnt,
+                       block_page,
+                       offsetof(px_log_fs_header_t, erase_cnt),
+                       sizeof(erase_cnt));
+    // Not written (erased value)?
+    if(erase_cnt == 0xffffffff)
+    {
+        // Power lost after erase? Use copy in last page of previous block
+        px_log_fs_flash_rd(&erase_cnt,
+                           px_log_fs_page_previous(handle, block_page),
+                           offsetof(px_log_fs_header_t, erase_cnt),
+                           sizeof(erase_cnt));
+    }
+    // Never counted (erased value)?
+    if(erase_cnt == 0xffffffff)
+    {
+        return 0;
+    }
+    return erase_cnt;
+}
+#endif
+
+static px_log_fs_err_t px_log_fs_erase_block(px_log_fs_handle_t * handle,
+                                             uint16_t             block_page)
+{
+    px_log_fs_header_t header;
+    uint16_t           page;
+#if PX_LOG_FS_CFG_ERASE_CNT
+    uint32_t           erase_cnt;
+    uint32_t           erase_cnt_copy;
+
+    // Read erase count before it is erased
+    erase_cnt = px_log_fs_erase_cnt_rd(handle, block_page) + 1;
+    // Copy new erase count to last page of previous block first so that it
+    // survives a power failure between the erase and the write below
+    page = px_log_fs_page_previous(handle, block_page);
+    px_log_fs_flash_rd(&erase_cnt_copy,
+                       page,
+                       offsetof(px_log_fs_header_t, erase_cnt),
+                       sizeof(erase_cnt_copy));
+    if(erase_cnt_copy == 0xffffffff)
+    {
+        px_log_fs_glue_wr(&erase_cnt,
+                          page,
+                          offsetof(px_log_fs_header_t, erase_cnt),
+                          sizeof(erase_cnt));
+    }
+#endif
+
+    // Erase block
+    px_log_fs_glue_erase_block(block_page);
+#if PX_LOG_FS_CFG_ERASE_CNT
+    // Write new erase count in header of first page (marker stays FREE)
+    px_log_fs_glue_wr(&erase_cnt,
+                      block_page,
+                      offsetof(px_log_fs_header_t, erase_cnt),
+                      sizeof(erase_cnt));
+#endif
+    // Has oldest RECORD pages been erased?
+    if(!px_log_fs_block_has_page(block_page, handle->page_first))
+    {
+        return PX_LOG_FS_ERR_NONE;
+    }
+    // Find new first page (start at next erase block)
+    page = px_log_fs_page_next(handle, block_page + PX_LOG_FS_CFG_ERASE_BLOCK_SIZE - 1);
+    while(true)
+    {
+        // Is page marked?
+        if(px_log_fs_marker_is_page(px_log_fs_header_rd(&header, page)))
+        {
+            // Save new first page
+            handle->page_first = page;
+            PX_LOG_D("New first page is %u", handle->page_first);
+            return PX_LOG_FS_ERR_NONE;
+        }
+        if(page == handle->page_last)
+        {
+            PX_LOG_E("File system must be corrupt");
+            return PX_LOG_FS_ERR_FATAL;
+        }
+        // Next page
+        page = px_log_fs_page_next(handle, page);
+    }
+}
+
+static px_log_fs_err_t px_log_fs_page_free_find(px_log_fs_handle_t * handle,
+                                                px_log_fs_header_t * header)
+{
+    px_log_fs_err_t err;
+
+    // Find next FREE page (starting at write address)
+    while(!px_log_fs_marker_is_free(px_log_fs_header_rd(header, handle->adr_wr.page)))
+    {
+        // Start of used erase block?
+        if((handle->adr_wr.page % PX_LOG_FS_CFG_ERASE_BLOCK_SIZE) == 0)
+        {
+#if PX_LOG_FS_CFG_STOP_WR_WHEN_FULL
+            if(px_log_fs_block_has_page(handle->adr_wr.page, handle->page_first))
+            {
+                return PX_LOG_FS_ERR_FULL;
+            }
+#endif
+            // Erase block
+            err = px_log_fs_erase_block(handle, handle->adr_wr.page);
+            if(err != PX_LOG_FS_ERR_NONE)
+            {
+                return err;
+            }
+#if PX_LOG_FS_CFG_ERASE_CNT
+            // Read FREE header again (with new erase count)
+            px_log_fs_header_rd(header, handle->adr_wr.page);
+#endif
+            break;
+        }
+        // Next page
+        handle->adr_wr.page = px_log_fs_page_next(handle, handle->adr_wr.page);
+    }
+#if PX_LOG_FS_CFG_ERASE_CNT
+    // First page in block?
+    if((handle->adr_wr.page % PX_LOG_FS_CFG_ERASE_BLOCK_SIZE) == 0)
+    {
+        // Restore erase count from copy if power was lost after erase
+        header->erase_cnt = px_log_fs_erase_cnt_rd(handle, handle->adr_wr.page);
+    }
+#endif
+#if PX_LOG_FS_CFG_STOP_WR_WHEN_FULL
+    // Last FREE page? Keep it free so that newest record can be distinguished from oldest
+    if(px_log_fs_page_next(handle, handle->adr_wr.page) == handle->page_first)
+    {
+        return PX_LOG_FS_ERR_FULL;
+    }
+#endif
+
+    return PX_LOG_FS_ERR_NONE;
+}
+
+#if PX_LOG_FS_CFG_WR_CACHE
+static px_log_fs_err_t px_log_fs_wr_cache_move(px_log_fs_handle_t * handle)
 {
     px_log_fs_header_t header;
+    px_log_fs_err_t    err;
+    uint16_t           page_bad = handle->wr_cache_page;
+    bool               page_full;
+
+    // Was write address already advanced to the page after the BAD page?
+    page_full = (handle->adr_wr.page != page_bad);
+    // Find next FREE page after BAD page
+    handle->adr_wr.page = px_log_fs_page_next(handle, page_bad);
+    err = px_log_fs_page_free_find(handle, &header);
+    if(err != PX_LOG_FS_ERR_NONE)
+    {
+        return err;
+    }
+    // Mark page (keep key of first cached record)
+    header.marker = PX_LOG_FS_MARKER_PAGE;
+    header.nr     = handle->page_nr_next++;
+#if PX_LOG_FS_CFG_REC_KEY
+    memcpy(&header.key, &((px_log_fs_header_t *)&handle->wr_cache_buf[0])->key, sizeof(header.key));
+#endif
+    header.crc = px_log_fs_header_crc(&header, handle->adr_wr.page);
+    // Replace cached header. Cached records stay at the same offsets
+    memcpy(&handle->wr_cache_buf[0], &header, sizeof(header));
+    handle->wr_cache_page = handle->adr_wr.page;
+    // Cached records filled the page?
+    if(page_full)
+    {
+        // Continue on page after new page
+        handle->adr_wr.page   = px_log_fs_page_next(handle, handle->adr_wr.page);
+        handle->adr_wr.offset = PX_LOG_FS_REC_OFFSET_FIRST;
+    }
+    PX_LOG_D("Cached records moved to page %u", handle->wr_cache_page);
+
+    return PX_LOG_FS_ERR_NONE;
+}
+#endif
+
+static void px_log_fs_adr_wr_find(px_log_fs_handle_t * handle)
+{
     px_log_fs_record_t record;
+    uint8_t            marker;
+
+    // Start at first record in last page
+    handle->adr_wr.page   = handle->page_last;
+    handle->adr_wr.offset = PX_LOG_FS_REC_OFFSET_FIRST;
+    while(true)
+    {
+        // FREE record found?
+        marker = px_log_fs_record_rd(&record, &handle->adr_wr);
+        if(px_log_fs_marker_is_free(marker))
+        {
+            break;
+        }
+        // Next record
+#if PX_LOG_FS_CFG_REC_VAR_SIZE
+        if(px_log_fs_marker_is_record(marker))
+        {
+            // Size is known. Skip record
+            px_log_fs_record_adr_skip(handle, &handle->adr_wr, px_log_fs_record_size(&record));
+        }
+        else
+        {
+            px_log_fs_record_adr_next(handle, &handle->adr_wr);
+        }
+#else
+        px_log_fs_record_adr_next(handle, &handle->adr_wr);
+#endif
+        // Last page full?
+        if(handle->adr_wr.offset == PX_LOG_FS_REC_OFFSET_FIRST)
+        {
+            break;
+        }
+    }
+}
+
+static void px_log_fs_init_full_scan(px_log_fs_handle_t * handle)
+{
+    px_log_fs_header_t header;
     uint16_t           page_first;
     uint16_t           page;
     uint16_t           page_next;
@@ -463,21 +918,6 @@ px_log_fs_err_t px_log_fs_init(px_log_fs_handle_t * handle,
     uint16_t           page_nr_diff;
     uint16_t           page_nr_diff_largest = 0;
 
-    // Sanity checks
-    PX_LOG_ASSERT(fs_page_start != PX_LOG_FS_PAGE_INVALID);                                     // Must not be reserved invalid value
-    PX_LOG_ASSERT(fs_page_end   != PX_LOG_FS_PAGE_INVALID);                                     // Must not be reserved invalid value
-    PX_LOG_ASSERT((fs_page_start % PX_LOG_FS_CFG_ERASE_BLOCK_SIZE)  == 0);                      // Must be at the start of an erase block
-    PX_LOG_ASSERT(((fs_page_end + 1) % PX_LOG_FS_CFG_ERASE_BLOCK_SIZE)  == 0);                  // Must be at the end of an erase block
-    PX_LOG_ASSERT(((fs_page_end + 1 - fs_page_start) / PX_LOG_FS_CFG_ERASE_BLOCK_SIZE) >= 2);   // Must be at least 2 erase blocks in size (more is better)
-    PX_LOG_ASSERT(sizeof(px_log_fs_record_t) <= PX_LOG_FS_PAGE_DATA_SIZE);                      // A record must fit in a page
-    if(PX_LOG_FS_PAGE_DATA_SIZE % sizeof(px_log_fs_record_t) != 0)
-    {
-        PX_LOG_W("%u bytes will be wasted per page", PX_LOG_FS_PAGE_DATA_SIZE % sizeof(px_log_fs_record_t));
-    }
-
-    // Save file system start and end page
-    handle->fs_page_start = fs_page_start;
-    handle->fs_page_end   = fs_page_end;
     // Read first marked page
     page_first = px_log_fs_header_rd_first(handle, &header);
     if(page_first == PX_LOG_FS_PAGE_INVALID)
@@ -489,7 +929,7 @@ px_log_fs_err_t px_log_fs_init(px_log_fs_handle_t * handle,
         handle->page_nr_next  = 0;
         handle->adr_wr.page   = handle->fs_page_start;
         handle->adr_wr.offset = PX_LOG_FS_REC_OFFSET_FIRST;
-        return PX_LOG_FS_ERR_NONE;
+        return;
     }
     // Continue from first marked page...
     page = page_first;
@@ -528,44 +968,501 @@ px_log_fs_err_t px_log_fs_init(px_log_fs_handle_t * handle,
     while(page != page_first); // Finished?
 
     // Find first FREE record
-    handle->adr_wr.page   = handle->page_last;
-    handle->adr_wr.offset = PX_LOG_FS_REC_OFFSET_FIRST;
-    while(!px_log_fs_marker_is_free(px_log_fs_record_rd(&record, &handle->adr_wr)))
-    {
-        px_log_fs_record_adr_next(handle, &handle->adr_wr);
-        if(handle->adr_wr.offset == PX_LOG_FS_REC_OFFSET_FIRST)
-        {
-            break;
-        }
-    }
-
-    // Report first and last page
-    PX_LOG_D("First marked page %u", handle->page_first);
-    PX_LOG_D("Last marked page %u",  handle->page_last);
-    PX_LOG_D("Next page nr %u",      handle->page_nr_next);
+    px_log_fs_adr_wr_find(handle);
+}
 
-    return PX_LOG_FS_ERR_NONE;
+#if PX_LOG_FS_CFG_INIT_BIN_SEARCH
+static uint8_t px_log_fs_block_header_rd(const px_log_fs_handle_t * handle,
+                                         px_log_fs_header_t *       header,
+                                         uint16_t                   block)
+{
+    // Read header of first page in erase block
+    return px_log_fs_header_rd(header,
+                               handle->fs_page_start + block * PX_LOG_FS_CFG_ERASE_BLOCK_SIZE);
 }
 
-px_log_fs_err_t px_log_fs_reset(px_log_fs_handle_t * handle,
-                                uint16_t             fs_page_start,
-                                uint16_t             fs_page_end)
+static bool px_log_fs_init_bin_search(px_log_fs_handle_t * handle)
 {
     px_log_fs_header_t header;
-    uint16_t           page;
+#if !PX_LOG_FS_CFG_REC_VAR_SIZE
+    px_log_fs_adr_t    adr;
+#endif
+    uint16_t           nr_of_pages;
+    uint16_t           nr_of_blocks;
+    uint16_t           block_first;
+    uint16_t           block_last;
+    uint16_t           nr_first;
+    uint16_t           lo;
+    uint16_t           hi;
+    uint16_t           mid;
     uint8_t            marker;
 
-    // Sanity checks
-    PX_LOG_ASSERT(fs_page_start != PX_LOG_FS_PAGE_INVALID);                                     // Must not be reserved invalid value
-    PX_LOG_ASSERT(fs_page_end   != PX_LOG_FS_PAGE_INVALID);                                     // Must not be reserved invalid value
-    PX_LOG_ASSERT((fs_page_start % PX_LOG_FS_CFG_ERASE_BLOCK_SIZE)  == 0);                      // Must be at the start of an erase block
-    PX_LOG_ASSERT(((fs_page_end + 1) % PX_LOG_FS_CFG_ERASE_BLOCK_SIZE)  == 0);                  // Must be at the end of an erase block
-    PX_LOG_ASSERT(((fs_page_end + 1 - fs_page_start) / PX_LOG_FS_CFG_ERASE_BLOCK_SIZE) >= 2);   // Must be at least 2 erase blocks in size (more is better)
+    nr_of_pages  = handle->fs_page_end - handle->fs_page_start + 1;
+    nr_of_blocks = nr_of_pages / PX_LOG_FS_CFG_ERASE_BLOCK_SIZE;
+
+    /*
+     *  Around the circular buffer, erase blocks form one run of used blocks
+     *  (with increasing page numbers) followed by one run of FREE blocks. Each
+     *  step below relies on this to halve the search range by reading only the
+     *  header of the first page in an erase block. Any other marker (BAD) means
+     *  that the layout is not as expected and a full scan is performed.
+     */
+    marker = px_log_fs_block_header_rd(handle, &header, 0);
+    if(px_log_fs_marker_is_page(marker))
+    {
+        // Find last block that is newer than (or same as) first block
+        nr_first = header.nr;
+        lo       = 0;
+        hi       = nr_of_blocks;
+        while((hi - lo) > 1)
+        {
+            mid    = lo + (hi - lo) / 2;
+            marker = px_log_fs_block_header_rd(handle, &header, mid);
+            if(px_log_fs_marker_is_page(marker))
+            {
+                if((uint16_t)(header.nr - nr_first) < nr_of_pages)
+                {
+                    lo = mid;
+                }
+                else
+                {
+                    hi = mid;
+                }
+            }
+            else if(px_log_fs_marker_is_free(marker))
+            {
+                hi = mid;
+            }
+            else
+            {
+                return false;
+            }
+        }
+        block_last = lo;
+        // Find first used (oldest) block after last block (FREE blocks, then older blocks)
+        lo = block_last + 1;
+        hi = nr_of_blocks;
+        while(lo < hi)
+        {
+            mid    = lo + (hi - lo) / 2;
+            marker = px_log_fs_block_header_rd(handle, &header, mid);
+            if(px_log_fs_marker_is_page(marker))
+            {
+                hi = mid;
+            }
+            else if(px_log_fs_marker_is_free(marker))
+            {
+                lo = mid + 1;
+            }
+            else
+            {
+                return false;
+            }
+        }
+        // No older blocks found?
+        if(lo == nr_of_blocks)
+        {
+            // First block is oldest
+            block_first = 0;
+        }
+        else
+        {
+            block_first = lo;
+        }
+    }
+    else if(px_log_fs_marker_is_free(marker))
+    {
+        // Last block must be newest block, otherwise layout is unknown (or empty)
+        marker = px_log_fs_block_header_rd(handle, &header, nr_of_blocks - 1);
+        if(!px_log_fs_marker_is_page(marker))
+        {
+            return false;
+        }
+        block_last = nr_of_blocks - 1;
+        // Find first used (oldest) block (FREE blocks, then used blocks)
+        lo = 1;
+        hi = nr_of_blocks - 1;
+        while(lo < hi)
+        {
+            mid    = lo + (hi - lo) / 2;
+            marker = px_log_fs_block_header_rd(handle, &header, mid);
+            if(px_log_fs_marker_is_page(marker))
+            {
+                hi = mid;
+            }
+            else if(px_log_fs_marker_is_free(marker))
+            {
+                lo = mid + 1;
+            }
+            else
+            {
+                return false;
+            }
+        }
+        block_first = lo;
+    }
+    else
+    {
+        return false;
+    }
+
+    // First marked page is at the start of the oldest block
+    handle->page_first = handle->fs_page_start + block_first * PX_LOG_FS_CFG_ERASE_BLOCK_SIZE;
+    marker = px_log_fs_header_rd(&header, handle->page_first);
+    if(!px_log_fs_marker_is_page(marker))
+    {
+        return false;
+    }
+    nr_first = header.nr;
+
+    // Find last used page in newest block (used pages, then FREE pages)
+    lo = 0;
+    hi = PX_LOG_FS_CFG_ERASE_BLOCK_SIZE;
+    while((hi - lo) > 1)
+    {
+        mid    = lo + (hi - lo) / 2;
+        marker = px_log_fs_header_rd(&header,
+                                     handle->fs_page_start + block_last * PX_LOG_FS_CFG_ERASE_BLOCK_SIZE + mid);
+        if(px_log_fs_marker_is_free(marker))
+        {
+            hi = mid;
+        }
+        else
+        {
+            lo = mid;
+        }
+    }
+    handle->page_last = handle->fs_page_start + block_last * PX_LOG_FS_CFG_ERASE_BLOCK_SIZE + lo;
+    marker = px_log_fs_header_rd(&header, handle->page_last);
+    if(!px_log_fs_marker_is_page(marker))
+    {
+        return false;
+    }
+    // Sanity check: all marked pages must fit in file system
+    if((uint16_t)(header.nr - nr_first) >= nr_of_pages)
+    {
+        return false;
+    }
+    handle->page_nr_next = header.nr + 1;
+
+#if PX_LOG_FS_CFG_REC_VAR_SIZE
+    // Record sizes vary. Walk records in last page to find first FREE record
+    px_log_fs_adr_wr_find(handle);
+#else
+    // Find first FREE record in last page (used records, then FREE records)
+    adr.page = handle->page_last;
+    lo       = 0;
+    hi       = PX_LOG_FS_RECORDS_PER_PAGE;
+    while(lo < hi)
+    {
+        mid        = lo + (hi - lo) / 2;
+        adr.offset = PX_LOG_FS_REC_OFFSET_FIRST + mid * sizeof(px_log_fs_record_t);
+        if(px_log_fs_marker_is_free(px_log_fs_marker_rd(&adr)))
+        {
+            hi = mid;
+        }
+        else
+        {
+            lo = mid + 1;
+        }
+    }
+    // Last page full?
+    if(lo == PX_LOG_FS_RECORDS_PER_PAGE)
+    {
+        handle->adr_wr.page   = px_log_fs_page_next(handle, handle->page_last);
+        handle->adr_wr.offset = PX_LOG_FS_REC_OFFSET_FIRST;
+    }
+    else
+    {
+        handle->adr_wr.page   = handle->page_last;
+        handle->adr_wr.offset = PX_LOG_FS_REC_OFFSET_FIRST + lo * sizeof(px_log_fs_record_t);
+    }
+#endif
+
+    return true;
+}
+#endif
+
+static void px_log_fs_rd_copy(px_log_fs_handle_t *       handle,
+                              const px_log_fs_record_t * record,
+                              void *                     data,
+                              size_t                     nr_of_bytes)
+{
+    // Archived?
+    if(record->marker == PX_LOG_FS_MARKER_RECORD_A)
+    {
+        handle->archive_flag = true;
+    }
+    else
+    {
+        handle->archive_flag = false;
+    }
+    // Save record data size
+#if PX_LOG_FS_CFG_REC_VAR_SIZE
+    handle->rd_rec_size = record->size;
+#else
+    handle->rd_rec_size = PX_LOG_FS_CFG_REC_DATA_SIZE;
+#endif
+    // More bytes requested than stored in record?
+    if(nr_of_bytes > handle->rd_rec_size)
+    {
+#if !PX_LOG_FS_CFG_REC_VAR_SIZE
+        PX_LOG_E("More bytes requested than can be stored in a record");
+#endif
+        // Clip number of bytes that will be copied
+        nr_of_bytes = handle->rd_rec_size;
+    }
+    // Copy content of record to user supplied buffer
+    memcpy(data, &record->data, nr_of_bytes);
+}
+
+static px_log_fs_err_t px_log_fs_rd_fwd(px_log_fs_handle_t * handle,
+                                        px_log_fs_adr_t      adr,
+                                        void *               data,
+                                        size_t               nr_of_bytes)
+{
+    px_log_fs_header_t header;
+    px_log_fs_record_t record;
+    uint16_t           page;
+
+    // Find first valid record at (or after) specified address
+    while(true)
+    {
+        // Has last record been read?
+        if(  (adr.page   == handle->adr_wr.page  )
+           &&(adr.offset == handle->adr_wr.offset)  )
+        {
+            // Stop
+            return PX_LOG_FS_ERR_NO_RECORD;
+        }
+        // Next page?
+        if(adr.offset == PX_LOG_FS_REC_OFFSET_FIRST)
+        {
+            // Find next marked page
+            while(!px_log_fs_marker_is_page(px_log_fs_header_rd(&header, adr.page)))
+            {
+                if(adr.page == handle->page_last)
+                {
+                    PX_LOG_E("File system must be corrupt");
+                    return PX_LOG_FS_ERR_FATAL;
+                }
+                adr.page = px_log_fs_page_next(handle, adr.page);
+                // Has write page been reached?
+                if(  (adr.page   == handle->adr_wr.page  )
+                   &&(adr.offset == handle->adr_wr.offset)  )
+                {
+                    // Stop
+                    return PX_LOG_FS_ERR_NO_RECORD;
+                }
+            }
+        }
+        // Read record. Valid?
+        if(px_log_fs_marker_is_record(px_log_fs_record_rd(&record, &adr)))
+        {
+            // Save read address and copy record data
+            handle->adr_rd = adr;
+            px_log_fs_rd_copy(handle, &record, data, nr_of_bytes);
+            return PX_LOG_FS_ERR_NONE;
+        }
+        // Next record address
+        page = adr.page;
+        px_log_fs_record_adr_next(handle, &adr);
+        // Skipped rest of page that contains write address (after BAD record)?
+        if(  (page     == handle->adr_wr.page)
+           &&(adr.page != page               )  )
+        {
+            // Stop
+            return PX_LOG_FS_ERR_NO_RECORD;
+        }
+    }
+}
+
+static px_log_fs_err_t px_log_fs_rd_back(px_log_fs_handle_t * handle,
+                                         px_log_fs_adr_t      adr,
+                                         void *               data,
+                                         size_t               nr_of_bytes)
+{
+    px_log_fs_header_t header;
+    px_log_fs_record_t record;
+
+    // Find first valid record before specified address
+    while(true)
+    {
+        // Has first record been read?
+        if(  (adr.page   == handle->page_first        )
+           &&(adr.offset == PX_LOG_FS_REC_OFFSET_FIRST)  )
+        {
+            // Stop
+            return PX_LOG_FS_ERR_NO_RECORD;
+        }
+        // Previous page?
+        if(adr.offset == PX_LOG_FS_REC_OFFSET_FIRST)
+        {
+            // Find previous marked page
+            adr.page = px_log_fs_page_previous(handle, adr.page);
+            while(!px_log_fs_marker_is_page(px_log_fs_header_rd(&header, adr.page)))
+            {
+                if(adr.page == handle->page_first)
+                {
+                    PX_LOG_E("File system must be corrupt");
+                    return PX_LOG_FS_ERR_FATAL;
+                }
+                adr.page = px_log_fs_page_previous(handle, adr.page);
+            }
+            // Last record on page
+            adr.offset = px_log_fs_record_offset_last(handle, adr.page);
+        }
+        else
+        {
+            // Previous record on page
+            px_log_fs_record_adr_previous(handle, &adr);
+        }
+        // Read record. Valid?
+        if(px_log_fs_marker_is_record(px_log_fs_record_rd(&record, &adr)))
+        {
+            // Save read address and copy record data
+            handle->adr_rd = adr;
+            px_log_fs_rd_copy(handle, &record, data, nr_of_bytes);
+            return PX_LOG_FS_ERR_NONE;
+        }
+    }
+}
+
+static bool px_log_fs_export_cursor_is_valid(const px_log_fs_handle_t * handle,
+                                             const px_log_fs_cursor_t * cursor)
+{
+    px_log_fs_header_t header;
+    uint16_t           page;
+    uint16_t           nr_of_pages;
+
+    // Outside file system?
+    if(  (cursor->adr.page   < handle->fs_page_start                           )
+       ||(cursor->adr.page   > handle->fs_page_end                             )
+       ||(cursor->adr.offset < PX_LOG_FS_REC_OFFSET_FIRST                      )
+       ||(cursor->adr.offset > PX_LOG_FS_CFG_PAGE_SIZE - PX_LOG_FS_REC_SIZE(0))  )
+    {
+        return false;
+    }
+    // Inside page?
+    if(cursor->adr.offset != PX_LOG_FS_REC_OFFSET_FIRST)
+    {
+        // Page must not have been erased (and rewritten) since
+        return (   px_log_fs_marker_is_page(px_log_fs_header_rd(&header, cursor->adr.page))
+                && (header.nr == cursor->page_nr)                                           );
+    }
+    // Find next marked page (or write page if it has not been marked yet)
+    page        = cursor->adr.page;
+    nr_of_pages = 0;
+    while(!px_log_fs_marker_is_page(px_log_fs_header_rd(&header, page)))
+    {
+        if(  (page                  == handle->adr_wr.page       )
+           &&(handle->adr_wr.offset == PX_LOG_FS_REC_OFFSET_FIRST)  )
+        {
+            // Page number that will be assigned next must not have moved on
+            return ((uint16_t)(handle->page_nr_next - cursor->page_nr) <= nr_of_pages);
+        }
+        page = px_log_fs_page_next(handle, page);
+        if(page == cursor->adr.page)
+        {
+            return false;
+        }
+        nr_of_pages++;
+    }
+    // Each page that has been skipped by the writer (BAD) also consumed a page number
+    return ((uint16_t)(header.nr - cursor->page_nr) <= nr_of_pages);
+}
+
+static void px_log_fs_export_page_next(const px_log_fs_handle_t * handle,
+                                       px_log_fs_cursor_t *       cursor)
+{
+    // Skipped rest of page that contains write address (after BAD record)?
+    if(cursor->adr.page == handle->adr_wr.page)
+    {
+        // Continue at write address
+        cursor->adr = handle->adr_wr;
+        return;
+    }
+    // First record on next page. Next marked page is expected to have next page number
+    cursor->adr.page   = px_log_fs_page_next(handle, cursor->adr.page);
+    cursor->adr.offset = PX_LOG_FS_REC_OFFSET_FIRST;
+    cursor->page_nr++;
+}
+
+/* _____GLOBAL FUNCTIONS_____________________________________________________ */
+px_log_fs_err_t px_log_fs_init(px_log_fs_handle_t * handle,
+                               uint16_t             fs_page_start,
+                               uint16_t             fs_page_end)
+{
+    uint32_t rd_count = px_log_fs_rd_count;
+
+    // Sanity checks
+    PX_LOG_ASSERT(fs_page_start != PX_LOG_FS_PAGE_INVALID);                                     // Must not be reserved invalid value
+    PX_LOG_ASSERT(fs_page_end   != PX_LOG_FS_PAGE_INVALID);                                     // Must not be reserved invalid value
+    PX_LOG_ASSERT((fs_page_start % PX_LOG_FS_CFG_ERASE_BLOCK_SIZE)  == 0);                      // Must be at the start of an erase block
+    PX_LOG_ASSERT(((fs_page_end + 1) % PX_LOG_FS_CFG_ERASE_BLOCK_SIZE)  == 0);                  // Must be at the end of an erase block
+    PX_LOG_ASSERT(((fs_page_end + 1 - fs_page_start) / PX_LOG_FS_CFG_ERASE_BLOCK_SIZE) >= 2);   // Must be at least 2 erase blocks in size (more is better)
     PX_LOG_ASSERT(sizeof(px_log_fs_record_t) <= PX_LOG_FS_PAGE_DATA_SIZE);                      // A record must fit in a page
+#if !PX_LOG_FS_CFG_REC_VAR_SIZE
     if(PX_LOG_FS_PAGE_DATA_SIZE % sizeof(px_log_fs_record_t) != 0)
     {
         PX_LOG_W("%u bytes will be wasted per page", PX_LOG_FS_PAGE_DATA_SIZE % sizeof(px_log_fs_record_t));
     }
+#endif
+
+    // Save file system start and end page
+    handle->fs_page_start = fs_page_start;
+    handle->fs_page_end   = fs_page_end;
+#if PX_LOG_FS_CFG_INIT_BIN_SEARCH
+    // Locate first and last page with binary search. Inconsistent layout?
+    if(!px_log_fs_init_bin_search(handle))
+    {
+        PX_LOG_D("Binary search failed. Performing full scan");
+        // Fall back to full scan
+        px_log_fs_init_full_scan(handle);
+    }
+#else
+    // Read all page headers
+    px_log_fs_init_full_scan(handle);
+#endif
+    // Save number of Serial Flash reads
+    handle->init_rd_count = px_log_fs_rd_count - rd_count;
+    handle->wr_fail_count = 0;
+#if PX_LOG_FS_CFG_WR_CACHE
+    // Empty write cache
+    handle->wr_cache_offset    = PX_LOG_FS_CFG_PAGE_SIZE;
+    handle->wr_cache_nr_of_rec = 0;
+#endif
+
+    // Report first and last page
+    PX_LOG_D("First marked page %u", handle->page_first);
+    PX_LOG_D("Last marked page %u",  handle->page_last);
+    PX_LOG_D("Next page nr %u",      handle->page_nr_next);
+    PX_LOG_D("Serial Flash reads %lu", handle->init_rd_count);
+
+    return PX_LOG_FS_ERR_NONE;
+}
+
+px_log_fs_err_t px_log_fs_reset(px_log_fs_handle_t * handle,
+                                uint16_t             fs_page_start,
+                                uint16_t             fs_page_end)
+{
+    px_log_fs_header_t header;
+    uint16_t           page;
+    uint8_t            marker;
+
+    // Sanity checks
+    PX_LOG_ASSERT(fs_page_start != PX_LOG_FS_PAGE_INVALID);                                     // Must not be reserved invalid value
+    PX_LOG_ASSERT(fs_page_end   != PX_LOG_FS_PAGE_INVALID);                                     // Must not be reserved invalid value
+    PX_LOG_ASSERT((fs_page_start % PX_LOG_FS_CFG_ERASE_BLOCK_SIZE)  == 0);                      // Must be at the start of an erase block
+    PX_LOG_ASSERT(((fs_page_end + 1) % PX_LOG_FS_CFG_ERASE_BLOCK_SIZE)  == 0);                  // Must be at the end of an erase block
+    PX_LOG_ASSERT(((fs_page_end + 1 - fs_page_start) / PX_LOG_FS_CFG_ERASE_BLOCK_SIZE) >= 2);   // Must be at least 2 erase blocks in size (more is better)
+    PX_LOG_ASSERT(sizeof(px_log_fs_record_t) <= PX_LOG_FS_PAGE_DATA_SIZE);                      // A record must fit in a page
+#if !PX_LOG_FS_CFG_REC_VAR_SIZE
+    if(PX_LOG_FS_PAGE_DATA_SIZE % sizeof(px_log_fs_record_t) != 0)
+    {
+        PX_LOG_W("%u bytes will be wasted per page", PX_LOG_FS_PAGE_DATA_SIZE % sizeof(px_log_fs_record_t));
+    }
+#endif
 
     // Save file system start and end page
     handle->fs_page_start = fs_page_start;
@@ -601,6 +1498,12 @@ px_log_fs_err_t px_log_fs_reset(px_log_fs_handle_t * handle,
     handle->page_nr_next  = 0;
     handle->adr_wr.page   = page;
     handle->adr_wr.offset = PX_LOG_FS_REC_OFFSET_FIRST;
+    handle->wr_fail_count = 0;
+#if PX_LOG_FS_CFG_WR_CACHE
+    // Discard write cache
+    handle->wr_cache_offset    = PX_LOG_FS_CFG_PAGE_SIZE;
+    handle->wr_cache_nr_of_rec = 0;
+#endif
     return PX_LOG_FS_ERR_NONE;
 }
 
@@ -608,17 +1511,26 @@ px_log_fs_err_t px_log_fs_rd_first(px_log_fs_handle_t * handle,
                                    void *               data,
                                    size_t               nr_of_bytes)
 {
+    px_log_fs_adr_t adr;
+
+#if PX_LOG_FS_CFG_WR_CACHE
+    // Write cached records first so that they can be found
+    if(px_log_fs_flush(handle) != PX_LOG_FS_ERR_NONE)
+    {
+        // Records that failed are marked BAD and skipped. Continue reading
+        PX_LOG_W("Flush before read failed");
+    }
+#endif
     // No marked pages?
     if(handle->page_first == PX_LOG_FS_PAGE_INVALID)
     {
         return PX_LOG_FS_ERR_EMPTY;
     }
-    // Start before first record
-    handle->adr_rd.page   = handle->page_first;
-    handle->adr_rd.offset = PX_LOG_FS_REC_OFFSET_FIRST;
-    px_log_fs_record_adr_previous(handle, &handle->adr_rd);
+    // Start at first record
+    adr.page   = handle->page_first;
+    adr.offset = PX_LOG_FS_REC_OFFSET_FIRST;
     // Return first valid record
-    return px_log_fs_rd_next(handle, data, nr_of_bytes);
+    return px_log_fs_rd_fwd(handle, adr, data, nr_of_bytes);
 }
 
 px_log_fs_err_t px_log_fs_rd_first_unarchived(px_log_fs_handle_t * handle,
@@ -626,20 +1538,30 @@ px_log_fs_err_t px_log_fs_rd_first_unarchived(px_log_fs_handle_t * handle,
                                               size_t               nr_of_bytes)
 {
     px_log_fs_header_t header;
+    px_log_fs_adr_t    adr;
+    px_log_fs_err_t    err;
     uint8_t            marker;
 
+#if PX_LOG_FS_CFG_WR_CACHE
+    // Write cached records first so that they can be found
+    if(px_log_fs_flush(handle) != PX_LOG_FS_ERR_NONE)
+    {
+        // Records that failed are marked BAD and skipped. Continue reading
+        PX_LOG_W("Flush before read failed");
+    }
+#endif
     // No marked pages?
     if(handle->page_first == PX_LOG_FS_PAGE_INVALID)
     {
         return PX_LOG_FS_ERR_EMPTY;
     }
     // Find first unarchived page with records
-    handle->adr_rd.page   = handle->page_first;
-    handle->adr_rd.offset = PX_LOG_FS_REC_OFFSET_FIRST;
-    while(handle->adr_rd.page != handle->adr_wr.page)
+    adr.page   = handle->page_first;
+    adr.offset = PX_LOG_FS_REC_OFFSET_FIRST;
+    while(adr.page != handle->adr_wr.page)
     {
         // Read page marker
-        marker = px_log_fs_header_rd(&header, handle->adr_rd.page);
+        marker = px_log_fs_header_rd(&header, adr.page);
         // First unarchived page?
         if(marker == PX_LOG_FS_MARKER_PAGE)
         {
@@ -652,21 +1574,20 @@ px_log_fs_err_t px_log_fs_rd_first_unarchived(px_log_fs_handle_t * handle,
             return PX_LOG_FS_ERR_FATAL;
         }
         // Next page
-        handle->adr_rd.page = px_log_fs_page_next(handle, handle->adr_rd.page);
+        adr.page = px_log_fs_page_next(handle, adr.page);
     }
-    // Start before first record
-    px_log_fs_record_adr_previous(handle, &handle->adr_rd);
     // Find first unarchived record
-    do
+    err = px_log_fs_rd_fwd(handle, adr, data, nr_of_bytes);
+    while((err == PX_LOG_FS_ERR_NONE) && handle->archive_flag)
     {
         // Read next record
-        if(px_log_fs_rd_next(handle, data, nr_of_bytes) != PX_LOG_FS_ERR_NONE)
-        {
-            // No unarchived records found
-            return PX_LOG_FS_ERR_NO_RECORD;
-        }
+        err = px_log_fs_rd_next(handle, data, nr_of_bytes);
+    }
+    if(err != PX_LOG_FS_ERR_NONE)
+    {
+        // No unarchived records found
+        return PX_LOG_FS_ERR_NO_RECORD;
     }
-    while(handle->archive_flag);
 
     // Success
     return PX_LOG_FS_ERR_NONE;
@@ -676,143 +1597,350 @@ px_log_fs_err_t px_log_fs_rd_next(px_log_fs_handle_t * handle,
                                   void *               data,
                                   size_t               nr_of_bytes)
 {
-    px_log_fs_header_t header;
-    px_log_fs_record_t record;
-    uint8_t            marker;
+    px_log_fs_adr_t adr;
 
-    // More bytes requested than can be stored in record?
-    if(nr_of_bytes > PX_LOG_FS_CFG_REC_DATA_SIZE)
+#if PX_LOG_FS_CFG_WR_CACHE
+    // Write cached records first so that they can be found
+    if(px_log_fs_flush(handle) != PX_LOG_FS_ERR_NONE)
     {
-        PX_LOG_E("More bytes requested than can be stored in a record");
-        // Clip number of bytes that will be copied
-        nr_of_bytes = PX_LOG_FS_CFG_REC_DATA_SIZE;
+        // Records that failed are marked BAD and skipped. Continue reading
+        PX_LOG_W("Flush before read failed");
     }
+#endif
+    // Next record address
+    adr = handle->adr_rd;
+#if PX_LOG_FS_CFG_REC_VAR_SIZE
+    // Size of current record is known. Skip it
+    px_log_fs_record_adr_skip(handle, &adr, PX_LOG_FS_REC_SIZE(handle->rd_rec_size));
+#else
+    px_log_fs_record_adr_next(handle, &adr);
+#endif
+    // Return next valid record
+    return px_log_fs_rd_fwd(handle, adr, data, nr_of_bytes);
+}
 
-    // Find next valid record
-    while(true)
+px_log_fs_err_t px_log_fs_rd_last(px_log_fs_handle_t * handle,
+                                  void *               data,
+                                  size_t               nr_of_bytes)
+{
+#if PX_LOG_FS_CFG_WR_CACHE
+    // Write cached records first so that they can be found
+    if(px_log_fs_flush(handle) != PX_LOG_FS_ERR_NONE)
     {
-        // Next record address
-        px_log_fs_record_adr_next(handle, &handle->adr_rd);
-        // Has last record been read?
-        if(  (handle->adr_rd.page   == handle->adr_wr.page  )
-           &&(handle->adr_rd.offset == handle->adr_wr.offset)  )
-        {
-            // Stop
-            px_log_fs_record_adr_previous(handle, &handle->adr_rd);
-            return PX_LOG_FS_ERR_NO_RECORD;
-        }
-        // Next page?
-        if(handle->adr_rd.offset == PX_LOG_FS_REC_OFFSET_FIRST)
+        // Records that failed are marked BAD and skipped. Continue reading
+        PX_LOG_W("Flush before read failed");
+    }
+#endif
+    // No marked pages?
+    if(handle->page_first == PX_LOG_FS_PAGE_INVALID)
+    {
+        return PX_LOG_FS_ERR_EMPTY;
+    }
+    // Return last valid record (before write address)
+    return px_log_fs_rd_back(handle, handle->adr_wr, data, nr_of_bytes);
+}
+
+px_log_fs_err_t px_log_fs_rd_previous(px_log_fs_handle_t * handle,
+                                      void *               data,
+                                      size_t               nr_of_bytes)
+{
+#if PX_LOG_FS_CFG_WR_CACHE
+    // Write cached records first so that they can be found
+    if(px_log_fs_flush(handle) != PX_LOG_FS_ERR_NONE)
+    {
+        // Records that failed are marked BAD and skipped. Continue reading
+        PX_LOG_W("Flush before read failed");
+    }
+#endif
+    // Return previous valid record
+    return px_log_fs_rd_back(handle, handle->adr_rd, data, nr_of_bytes);
+}
+
+#if PX_LOG_FS_CFG_REC_KEY
+px_log_fs_err_t px_log_fs_rd_seek(px_log_fs_handle_t * handle,
+                                  px_log_fs_key_t      key,
+                                  void *               data,
+                                  size_t               nr_of_bytes)
+{
+    px_log_fs_header_t header;
+    px_log_fs_adr_t    adr;
+    px_log_fs_err_t    err;
+    px_log_fs_key_t    key_rd;
+    uint8_t            rec_data[PX_LOG_FS_CFG_REC_KEY_OFFSET + sizeof(px_log_fs_key_t)];
+    uint16_t           lo;
+    uint16_t           hi;
+    uint16_t           mid;
+    uint16_t           i;
+
+#if PX_LOG_FS_CFG_WR_CACHE
+    // Write cached records first so that they can be found
+    if(px_log_fs_flush(handle) != PX_LOG_FS_ERR_NONE)
+    {
+        // Records that failed are marked BAD and skipped. Continue reading
+        PX_LOG_W("Flush before read failed");
+    }
+#endif
+    // No marked pages?
+    if(handle->page_first == PX_LOG_FS_PAGE_INVALID)
+    {
+        return PX_LOG_FS_ERR_EMPTY;
+    }
+    // Calculate number of pages from first to last page
+    if(handle->page_last >= handle->page_first)
+    {
+        hi = handle->page_last - handle->page_first + 1;
+    }
+    else
+    {
+        hi = (handle->fs_page_end - handle->page_first + 1) + (handle->page_last - handle->fs_page_start + 1);
+    }
+
+    /*
+     *  Binary search for the last page with a first record key that is smaller
+     *  than the specified key. The first record with a key that is equal or
+     *  larger is in this page or at the start of the next marked page. The
+     *  first page is used if all keys are equal or larger.
+     */
+    lo = 0;
+    while((hi - lo) > 1)
+    {
+        mid = lo + (hi - lo) / 2;
+        // Find first marked page from mid (skip BAD pages)
+        for(i = mid; i < hi; i++)
         {
-            // Find next marked page
-            while(!px_log_fs_marker_is_page(px_log_fs_header_rd(&header, handle->adr_rd.page)))
+            if(px_log_fs_marker_is_page(px_log_fs_header_rd(&header,
+                                                           px_log_fs_page_add(handle, handle->page_first, i))))
             {
-                if(handle->adr_rd.page == handle->page_last)
-                {
-                    PX_LOG_E("File system must be corrupt");
-                    return PX_LOG_FS_ERR_FATAL;
-                }
-                handle->adr_rd.page = px_log_fs_page_next(handle, handle->adr_rd.page);
+                break;
             }
         }
-        // Read record
-        marker = px_log_fs_record_rd(&record, &handle->adr_rd);
-        if(px_log_fs_marker_is_record(marker))
+        if((i < hi) && (header.key < key))
         {
-            // Archived?
-            if(marker == PX_LOG_FS_MARKER_RECORD_A)
-            {
-                handle->archive_flag = true;
-            }
-            else
-            {
-                handle->archive_flag = false;
-            }
-            // Copy content of record to user supplied buffer
-            memcpy(data, &record.data, nr_of_bytes);
-            // Valid record
-            return PX_LOG_FS_ERR_NONE;
+            lo = i;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    // Scan records from start of page until key is equal or larger
+    adr.page   = px_log_fs_page_add(handle, handle->page_first, lo);
+    adr.offset = PX_LOG_FS_REC_OFFSET_FIRST;
+    err        = px_log_fs_rd_fwd(handle, adr, rec_data, sizeof(rec_data));
+    while(err == PX_LOG_FS_ERR_NONE)
+    {
+        memcpy(&key_rd, &rec_data[PX_LOG_FS_CFG_REC_KEY_OFFSET], sizeof(key_rd));
+        if(key_rd >= key)
+        {
+            // Copy record data to user supplied buffer
+            return px_log_fs_rd_fwd(handle, handle->adr_rd, data, nr_of_bytes);
         }
+        err = px_log_fs_rd_next(handle, rec_data, sizeof(rec_data));
     }
+    return err;
 }
+#endif
 
-px_log_fs_err_t px_log_fs_rd_last(px_log_fs_handle_t * handle,
-                                  void *               data,
-                                  size_t               nr_of_bytes)
+px_log_fs_err_t px_log_fs_export_start(px_log_fs_handle_t * handle,
+                                       px_log_fs_cursor_t * cursor)
 {
+    px_log_fs_header_t header;
+
+#if PX_LOG_FS_CFG_WR_CACHE
+    // Write cached records first so that they can be exported
+    if(px_log_fs_flush(handle) != PX_LOG_FS_ERR_NONE)
+    {
+        // Records that failed are marked BAD and skipped. Continue exporting
+        PX_LOG_W("Flush before export failed");
+    }
+#endif
     // No marked pages?
     if(handle->page_first == PX_LOG_FS_PAGE_INVALID)
     {
+        // Start at write address
+        cursor->adr     = handle->adr_wr;
+        cursor->page_nr = handle->page_nr_next;
         return PX_LOG_FS_ERR_EMPTY;
     }
-    // Start after last record
-    handle->adr_rd.page   = handle->adr_wr.page;
-    handle->adr_rd.offset = handle->adr_wr.offset;
-    // Return last valid record
-    return px_log_fs_rd_previous(handle, data, nr_of_bytes);
+    // Start at first record of first page
+    px_log_fs_header_rd(&header, handle->page_first);
+    cursor->adr.page   = handle->page_first;
+    cursor->adr.offset = PX_LOG_FS_REC_OFFSET_FIRST;
+    cursor->page_nr    = header.nr;
+
+    return PX_LOG_FS_ERR_NONE;
 }
 
-px_log_fs_err_t px_log_fs_rd_previous(px_log_fs_handle_t * handle,
-                                      void *               data,
-                                      size_t               nr_of_bytes)
+px_log_fs_err_t px_log_fs_export_rd(px_log_fs_handle_t * handle,
+                                    px_log_fs_cursor_t * cursor,
+                                    void *               data,
+                                    size_t               nr_of_bytes,
+                                    size_t *             nr_of_bytes_exported)
 {
-    px_log_fs_header_t header;
-    px_log_fs_record_t record;
-    uint8_t            marker;
-
-    // More bytes requested than can be stored in record?
-    if(nr_of_bytes > PX_LOG_FS_CFG_REC_DATA_SIZE)
+    px_log_fs_header_t   header;
+    px_log_fs_record_t * record;
+    uint8_t *            data_u8 = (uint8_t *)data;
+    uint8_t *            buf;
+    size_t               n = 0;
+    uint16_t             page;
+    uint16_t             rd_size;
+    uint16_t             rec_size;
+    uint16_t             i;
+
+    *nr_of_bytes_exported = 0;
+#if PX_LOG_FS_CFG_WR_CACHE
+    // Write cached records first so that they can be exported
+    if(px_log_fs_flush(handle) != PX_LOG_FS_ERR_NONE)
     {
-        PX_LOG_E("More bytes requested than can be stored in a record");
-        // Clip number of bytes that will be copied
-        nr_of_bytes = PX_LOG_FS_CFG_REC_DATA_SIZE;
+        // Records that failed are marked BAD and skipped. Continue exporting
+        PX_LOG_W("Flush before export failed");
+    }
+#endif
+    // No marked pages?
+    if(handle->page_first == PX_LOG_FS_PAGE_INVALID)
+    {
+        return PX_LOG_FS_ERR_EMPTY;
+    }
+    // Records at cursor overwritten since last export?
+    if(!px_log_fs_export_cursor_is_valid(handle, cursor))
+    {
+        PX_LOG_W("Export cursor invalid. Restarting at first record");
+        px_log_fs_export_start(handle, cursor);
     }
 
-    // Find previous valid record
     while(true)
     {
-        // Has first record been read?
-        if(  (handle->adr_rd.page   == handle->page_first        )
-           &&(handle->adr_rd.offset == PX_LOG_FS_REC_OFFSET_FIRST)  )
-        {
-            // Stop
-            return PX_LOG_FS_ERR_NO_RECORD;
-        }
-        // Previous record address
-        px_log_fs_record_adr_previous(handle, &handle->adr_rd);
-        // Previous page?
-        if(handle->adr_rd.offset == PX_LOG_FS_REC_OFFSET_LAST)
+        // Next page?
+        if(cursor->adr.offset == PX_LOG_FS_REC_OFFSET_FIRST)
         {
-            // Find previous marked page
-            while(!px_log_fs_marker_is_page(px_log_fs_header_rd(&header, handle->adr_rd.page)))
+            // Find next marked page
+            while(!px_log_fs_marker_is_page(px_log_fs_header_rd(&header, cursor->adr.page)))
             {
-                if(handle->adr_rd.page == handle->page_first)
+                // Has write page been reached?
+                if(cursor->adr.page == handle->adr_wr.page)
                 {
-                    PX_LOG_E("File system must be corrupt");
-                    return PX_LOG_FS_ERR_FATAL;
+                    // Remember page number that will be assigned to write page
+                    cursor->page_nr = handle->page_nr_next;
+                    break;
                 }
-                handle->adr_rd.page = px_log_fs_page_previous(handle, handle->adr_rd.page);
+                cursor->adr.page = px_log_fs_page_next(handle, cursor->adr.page);
+            }
+            if(px_log_fs_marker_is_page(header.marker))
+            {
+                cursor->page_nr = header.nr;
             }
         }
-        // Read record
-        marker = px_log_fs_record_rd(&record, &handle->adr_rd);
-        if(px_log_fs_marker_is_record(marker))
+        // Has last record been exported?
+        if(  (cursor->adr.page   == handle->adr_wr.page  )
+           &&(cursor->adr.offset == handle->adr_wr.offset)  )
         {
-            // Archived?
-            if(marker == PX_LOG_FS_MARKER_RECORD_A)
+            break;
+        }
+        // Enough space left in buffer for smallest record?
+        if(nr_of_bytes - n < PX_LOG_FS_REC_SIZE(0))
+        {
+            break;
+        }
+        // Read rest of page (up to write address) or as much as fits in buffer
+        if(cursor->adr.page == handle->adr_wr.page)
+        {
+            rd_size = handle->adr_wr.offset - cursor->adr.offset;
+        }
+        else
+        {
+            rd_size = PX_LOG_FS_CFG_PAGE_SIZE - cursor->adr.offset;
+        }
+        if(rd_size > nr_of_bytes - n)
+        {
+            rd_size = (uint16_t)(nr_of_bytes - n);
+        }
+        buf = &data_u8[n];
+        px_log_fs_flash_rd(buf, cursor->adr.page, cursor->adr.offset, rd_size);
+
+        // Pack data of valid records at the start of the buffer
+        page = cursor->adr.page;
+        i    = 0;
+        while(cursor->adr.page == page)
+        {
+            // Has last record been exported?
+            if(  (cursor->adr.page   == handle->adr_wr.page  )
+               &&(cursor->adr.offset == handle->adr_wr.offset)  )
             {
-                handle->archive_flag = true;
+                break;
             }
-            else
+            // Marker in buffer?
+            if(i >= rd_size)
+            {
+                break;
+            }
+            record = (px_log_fs_record_t *)&buf[i];
+            // FREE? Rest of page is unused
+            if(px_log_fs_marker_is_free(record->marker))
             {
-                handle->archive_flag = false;
+                px_log_fs_export_page_next(handle, cursor);
+                break;
+            }
+#if PX_LOG_FS_CFG_REC_VAR_SIZE
+            // Size in buffer?
+            if(i + 2 > rd_size)
+            {
+                break;
+            }
+            // BAD or invalid record? Rest of page can not be trusted
+            if(  (!px_log_fs_marker_is_record(record->marker)                                     )
+               ||(record->size > PX_LOG_FS_CFG_REC_DATA_SIZE                                      )
+               ||(cursor->adr.offset + PX_LOG_FS_REC_SIZE(record->size) > PX_LOG_FS_CFG_PAGE_SIZE)  )
+            {
+                px_log_fs_export_page_next(handle, cursor);
+                break;
+            }
+#endif
+            // Whole record in buffer?
+            rec_size = px_log_fs_record_size(record);
+            if(i + rec_size > rd_size)
+            {
+                break;
+            }
+            // Valid record?
+            if(  (px_log_fs_marker_is_record(record->marker)                     )
+               &&(px_log_fs_record_crc(record) == *px_log_fs_record_crc_ptr(record))  )
+            {
+                // Move data to packed position (never after record position)
+#if PX_LOG_FS_CFG_REC_VAR_SIZE
+                memmove(&data_u8[n], &record->size, rec_size - 2);
+                n += rec_size - 2;
+#else
+                memmove(&data_u8[n], &record->data, PX_LOG_FS_CFG_REC_DATA_SIZE);
+                n += PX_LOG_FS_CFG_REC_DATA_SIZE;
+#endif
+            }
+            // Next record
+            i += rec_size;
+#if PX_LOG_FS_CFG_REC_VAR_SIZE
+            px_log_fs_record_adr_skip(handle, &cursor->adr, rec_size);
+#else
+            px_log_fs_record_adr_next(handle, &cursor->adr);
+#endif
+            if(cursor->adr.page != page)
+            {
+                // Next marked page is expected to have next page number
+                cursor->page_nr++;
             }
-            // Copy content of record to user supplied buffer
-            memcpy(data, &record.data, nr_of_bytes);
-            // Valid record
-            return PX_LOG_FS_ERR_NONE;
         }
+        // No record fitted in rest of buffer?
+        if((i == 0) && (cursor->adr.page == page))
+        {
+            break;
+        }
+    }
+
+    *nr_of_bytes_exported = n;
+    if(n == 0)
+    {
+        return PX_LOG_FS_ERR_NO_RECORD;
     }
+    return PX_LOG_FS_ERR_NONE;
 }
 
 px_log_fs_err_t px_log_fs_rd_rec_set_archive(px_log_fs_handle_t * handle)
@@ -820,6 +1948,14 @@ px_log_fs_err_t px_log_fs_rd_rec_set_archive(px_log_fs_handle_t * handle)
     uint8_t marker;
     px_log_fs_adr_t adr;
 
+#if PX_LOG_FS_CFG_WR_CACHE
+    // Write cached records first so that they can be found
+    if(px_log_fs_flush(handle) != PX_LOG_FS_ERR_NONE)
+    {
+        // Records that failed are marked BAD and skipped. Continue reading
+        PX_LOG_W("Flush before read failed");
+    }
+#endif
     // Sanity check
     if(handle->archive_flag)
     {
@@ -842,6 +1978,7 @@ px_log_fs_err_t px_log_fs_rd_rec_set_archive(px_log_fs_handle_t * handle)
     if(!px_log_fs_marker_wr(PX_LOG_FS_MARKER_RECORD_A, &handle->adr_rd))
     {
         PX_LOG_E("Failed to write archive marker");
+        handle->wr_fail_count++;
         return PX_LOG_FS_ERR_WRITE_FAIL;
     }
     // Is this the last record in the page?
@@ -861,6 +1998,7 @@ px_log_fs_err_t px_log_fs_rd_rec_set_archive(px_log_fs_handle_t * handle)
             if(!px_log_fs_marker_wr(PX_LOG_FS_MARKER_PAGE_A, &adr))
             {
                 PX_LOG_E("Failed to mark page as archived. Lost whole page of records!");
+                handle->wr_fail_count++;
                 return PX_LOG_FS_ERR_WRITE_FAIL;
             }
             // Success
@@ -900,8 +2038,7 @@ px_log_fs_err_t px_log_fs_wr(px_log_fs_handle_t * handle,
 {
     px_log_fs_header_t header;
     px_log_fs_record_t record;
-    uint16_t           page;
-    uint8_t            marker;
+    px_log_fs_err_t    err;
 
     // Record too small?
     if(nr_of_bytes > PX_LOG_FS_CFG_REC_DATA_SIZE)
@@ -911,75 +2048,118 @@ px_log_fs_err_t px_log_fs_wr(px_log_fs_handle_t * handle,
         // Clip number of bytes that will be copied
         nr_of_bytes = PX_LOG_FS_CFG_REC_DATA_SIZE;
     }
+#if PX_LOG_FS_CFG_REC_KEY
+    // Record data must contain key
+    PX_LOG_ASSERT(nr_of_bytes >= PX_LOG_FS_CFG_REC_KEY_OFFSET + sizeof(px_log_fs_key_t));
+#endif
+#if PX_LOG_FS_CFG_REC_VAR_SIZE
+    // Set size and copy data
+    record.size = (uint8_t)nr_of_bytes;
+    memcpy(&record.data, data, nr_of_bytes);
+#else
     // Set unused data to 0xFF
     memset(&record.data, 0xff, sizeof(record.data));
     // Copy data
     memcpy(&record.data, data, nr_of_bytes);
+#endif
+
+#if PX_LOG_FS_CFG_REC_VAR_SIZE
+    // Record does not fit in rest of page?
+    if(handle->adr_wr.offset + px_log_fs_record_size(&record) > PX_LOG_FS_CFG_PAGE_SIZE)
+    {
+#if PX_LOG_FS_CFG_WR_CACHE
+        // Write cached header and records of current page
+        err = px_log_fs_flush(handle);
+        if(err != PX_LOG_FS_ERR_NONE)
+        {
+            return err;
+        }
+#endif
+        // Start at first record on next page
+        handle->adr_wr.page   = px_log_fs_page_next(handle, handle->adr_wr.page);
+        handle->adr_wr.offset = PX_LOG_FS_REC_OFFSET_FIRST;
+    }
+#endif
 
     // New page?
     if(handle->adr_wr.offset == PX_LOG_FS_REC_OFFSET_FIRST)
     {
         // Find next FREE page
-        while(!px_log_fs_marker_is_free(px_log_fs_header_rd(&header, handle->adr_wr.page)))
+        err = px_log_fs_page_free_find(handle, &header);
+        if(err != PX_LOG_FS_ERR_NONE)
         {
-            // Next page
-            handle->adr_wr.page = px_log_fs_page_next(handle, handle->adr_wr.page);
-#if PX_LOG_FS_CFG_STOP_WR_WHEN_FULL
-            if(handle->adr_wr.page == handle->page_first)
-            {
-                return PX_LOG_FS_ERR_FULL;
-            }
-#endif
-            // Start of new erase block?
-            if((handle->adr_wr.page % PX_LOG_FS_CFG_ERASE_BLOCK_SIZE) == 0)
-            {
-                // Erase block
-                px_log_fs_glue_erase_block(handle->adr_wr.page);
-                // Has oldest RECORD pages been erased?
-                if(  (handle->page_first >= handle->adr_wr.page)
-                   &&(handle->page_first <  handle->adr_wr.page + PX_LOG_FS_CFG_ERASE_BLOCK_SIZE)  )
-                {
-                    // Find new first page
-                    page = handle->adr_wr.page + PX_LOG_FS_CFG_ERASE_BLOCK_SIZE;
-                    while(true)
-                    {
-                        // Is page marked?
-                        marker = px_log_fs_header_rd(&header, handle->adr_wr.page);
-                        if(px_log_fs_marker_is_page(marker))
-                        {
-                            // Save new first page
-                            handle->page_first = page;
-                            PX_LOG_D("New first page is %u", handle->page_first);
-                            break;
-                        }
-                        if(page == handle->page_last)
-                        {
-                            PX_LOG_E("File system must be corrupt");
-                            return PX_LOG_FS_ERR_FATAL;
-                        }
-                        // Next page
-                        page = px_log_fs_page_next(handle, page);
-                    }
-                }
-                break;
-            }
+            return err;
         }
         // Mark page
         header.marker = PX_LOG_FS_MARKER_PAGE;
         header.nr     = handle->page_nr_next++;
+#if PX_LOG_FS_CFG_REC_KEY
+        // Save key of first record in page header
+        memcpy(&header.key, &record.data[PX_LOG_FS_CFG_REC_KEY_OFFSET], sizeof(header.key));
+#endif
+#if PX_LOG_FS_CFG_WR_CACHE
+        // Cache header (written with records)
+        header.crc = px_log_fs_header_crc(&header, handle->adr_wr.page);
+        memcpy(&handle->wr_cache_buf[0], &header, sizeof(header));
+        handle->wr_cache_page   = handle->adr_wr.page;
+        handle->wr_cache_offset = 0;
+#else
         if(!px_log_fs_header_wr(&header, handle->adr_wr.page))
         {
+            handle->wr_fail_count++;
             // Header write failed. Try next page
             handle->adr_wr.page = px_log_fs_page_next(handle, handle->adr_wr.page);
             return PX_LOG_FS_ERR_WRITE_FAIL;
         }
+#endif
     }
 
+#if PX_LOG_FS_CFG_WR_CACHE
+    // Cache is empty?
+    if(handle->wr_cache_offset == PX_LOG_FS_CFG_PAGE_SIZE)
+    {
+        // Start caching at write address
+        handle->wr_cache_page   = handle->adr_wr.page;
+        handle->wr_cache_offset = handle->adr_wr.offset;
+    }
+    // Cache new record
+    record.marker = PX_LOG_FS_MARKER_RECORD;
+    *px_log_fs_record_crc_ptr(&record) = px_log_fs_record_crc(&record);
+    memcpy(&handle->wr_cache_buf[handle->adr_wr.offset], &record, px_log_fs_record_size(&record));
+    handle->wr_cache_nr_of_rec++;
+    // Advance write address to next position
+#if PX_LOG_FS_CFG_REC_VAR_SIZE
+    px_log_fs_record_adr_skip(handle, &handle->adr_wr, px_log_fs_record_size(&record));
+#else
+    px_log_fs_record_adr_next(handle, &handle->adr_wr);
+#endif
+    // Page full or maximum number of records cached?
+    if(  (handle->adr_wr.offset == PX_LOG_FS_REC_OFFSET_FIRST)
+#if PX_LOG_FS_CFG_WR_CACHE_MAX_REC
+       ||(handle->wr_cache_nr_of_rec >= PX_LOG_FS_CFG_WR_CACHE_MAX_REC)
+#endif
+                                                                        )
+    {
+        // Write cached header and records
+        err = px_log_fs_flush(handle);
+        if(err != PX_LOG_FS_ERR_NONE)
+        {
+            return err;
+        }
+    }
+#else
     // Write new record
     if(!px_log_fs_record_wr(&record, &handle->adr_wr))
     {
+        handle->wr_fail_count++;
+#if PX_LOG_FS_CFG_REC_VAR_SIZE
+        // Record write failed. Rest of page can not be trusted. Try next page
+        handle->adr_wr.page   = px_log_fs_page_next(handle, handle->adr_wr.page);
+        handle->adr_wr.offset = PX_LOG_FS_REC_OFFSET_FIRST;
+#else
         // Record write failed. Try next record address
         px_log_fs_record_adr_next(handle, &handle->adr_wr);
+#endif
         return PX_LOG_FS_ERR_WRITE_FAIL;
     }
     // First record?
@@ -991,27 +2171,289 @@ px_log_fs_err_t px_log_fs_wr(px_log_fs_handle_t * handle,
     // Update last page
     handle->page_last = handle->adr_wr.page;
     // Advance write address to next position
+#if PX_LOG_FS_CFG_REC_VAR_SIZE
+    px_log_fs_record_adr_skip(handle, &handle->adr_wr, px_log_fs_record_size(&record));
+#else
     px_log_fs_record_adr_next(handle, &handle->adr_wr);
+#endif
+#endif
+
+#if !PX_LOG_FS_CFG_STOP_WR_WHEN_FULL
+    // Has write address caught up with first page (file system is full)?
+    if(  (handle->adr_wr.offset == PX_LOG_FS_REC_OFFSET_FIRST)
+       &&(handle->adr_wr.page   == handle->page_first        )
+       &&((handle->adr_wr.page % PX_LOG_FS_CFG_ERASE_BLOCK_SIZE) == 0)  )
+    {
+        // Erase oldest block now so that newest record can be distinguished from oldest
+        return px_log_fs_erase_block(handle, handle->adr_wr.page);
+    }
+#endif
 
     // Success
     return PX_LOG_FS_ERR_NONE;
 }
 
-void px_log_fs_dbg_report_info(px_log_fs_handle_t * handle)
+px_log_fs_err_t px_log_fs_flush(px_log_fs_handle_t * handle)
+{
+#if PX_LOG_FS_CFG_WR_CACHE
+    px_log_fs_header_t header_rd;
+    px_log_fs_record_t record_rd;
+    px_log_fs_adr_t    adr;
+    px_log_fs_err_t    err = PX_LOG_FS_ERR_NONE;
+    uint16_t           offset_end;
+    uint16_t           rec_size;
+    uint8_t            i;
+    uint8_t            retry = 0;
+
+    // Nothing cached?
+    if(handle->wr_cache_offset == PX_LOG_FS_CFG_PAGE_SIZE)
+    {
+        return PX_LOG_FS_ERR_NONE;
+    }
+    // Calculate end of cached records
+    if(handle->wr_cache_offset == 0)
+    {
+        offset_end = PX_LOG_FS_REC_OFFSET_FIRST;
+    }
+    else
+    {
+        offset_end = handle->wr_cache_offset;
+    }
+    for(i = 0; i < handle->wr_cache_nr_of_rec; i++)
+    {
+        offset_end += px_log_fs_record_size((px_log_fs_record_t *)&handle->wr_cache_buf[offset_end]);
+    }
+
+    while(true)
+    {
+        // Write cached header and records in one operation
+        px_log_fs_glue_wr(&handle->wr_cache_buf[handle->wr_cache_offset],
+                          handle->wr_cache_page,
+                          handle->wr_cache_offset,
+                          offset_end - handle->wr_cache_offset);
+        adr.page = handle->wr_cache_page;
+        // Header not written?
+        if(handle->wr_cache_offset != 0)
+        {
+            break;
+        }
+        // Read back header. Match?
+        px_log_fs_flash_rd(&header_rd, adr.page, 0, sizeof(header_rd));
+        if(memcmp(&handle->wr_cache_buf[0], &header_rd, sizeof(header_rd)) == 0)
+        {
+            break;
+        }
+        // Mark header as BAD (records on page are ignored)
+        PX_LOG_E("Header write failed @ page %u", adr.page);
+        handle->wr_fail_count++;
+        header_rd.marker = PX_LOG_FS_MARKER_BAD;
+        px_log_fs_glue_wr(&header_rd.marker, adr.page, 0, 1);
+        // Move cached records to next FREE page and try again
+        if(++retry < PX_LOG_FS_WR_CACHE_RETRY_MAX)
+        {
+            err = px_log_fs_wr_cache_move(handle);
+        }
+        else
+        {
+            err = PX_LOG_FS_ERR_WRITE_FAIL;
+        }
+        if(err != PX_LOG_FS_ERR_NONE)
+        {
+            // Discard cached records
+            PX_LOG_E("%u cached records lost", handle->wr_cache_nr_of_rec);
+            handle->wr_cache_offset    = PX_LOG_FS_CFG_PAGE_SIZE;
+            handle->wr_cache_nr_of_rec = 0;
+            // Continue on next page
+            if(handle->adr_wr.page == adr.page)
+            {
+                handle->adr_wr.page = px_log_fs_page_next(handle, adr.page);
+            }
+            handle->adr_wr.offset = PX_LOG_FS_REC_OFFSET_FIRST;
+            return err;
+        }
+    }
+    // Header written?
+    if(handle->wr_cache_offset == 0)
+    {
+        adr.offset = PX_LOG_FS_REC_OFFSET_FIRST;
+    }
+    else
+    {
+        adr.offset = handle->wr_cache_offset;
+    }
+    // Read back each record
+    while(adr.offset < offset_end)
+    {
+        rec_size = px_log_fs_record_size((px_log_fs_record_t *)&handle->wr_cache_buf[adr.offset]);
+        px_log_fs_flash_rd(&record_rd, adr.page, adr.offset, rec_size);
+        // Match?
+        if(memcmp(&handle->wr_cache_buf[adr.offset], &record_rd, rec_size) != 0)
+        {
+            // Mark record as BAD
+            PX_LOG_E("Record write failed @ page %u offset %u", adr.page, adr.offset);
+            handle->wr_fail_count++;
+            record_rd.marker = PX_LOG_FS_MARKER_BAD;
+            px_log_fs_glue_wr(&record_rd.marker, adr.page, adr.offset, 1);
+            err = PX_LOG_FS_ERR_WRITE_FAIL;
+        }
+        adr.offset += rec_size;
+    }
+#if PX_LOG_FS_CFG_REC_VAR_SIZE
+    // Record write failed and page is still being written?
+    if((err != PX_LOG_FS_ERR_NONE) && (handle->adr_wr.page == adr.page))
+    {
+        // Rest of page can not be trusted. Continue on next page
+        handle->adr_wr.page   = px_log_fs_page_next(handle, adr.page);
+        handle->adr_wr.offset = PX_LOG_FS_REC_OFFSET_FIRST;
+    }
+#endif
+    // First record?
+    if(handle->page_first == PX_LOG_FS_PAGE_INVALID)
+    {
+        // Save first page
+        handle->page_first = adr.page;
+    }
+    // Update last page
+    handle->page_last = adr.page;
+    // Empty cache
+    handle->wr_cache_offset    = PX_LOG_FS_CFG_PAGE_SIZE;
+    handle->wr_cache_nr_of_rec = 0;
+
+    return err;
+#else
+    // Nothing cached
+    return PX_LOG_FS_ERR_NONE;
+#endif
+}
+
+#if PX_LOG_FS_CFG_ERASE_CNT
+uint32_t px_log_fs_get_erase_count(px_log_fs_handle_t * handle,
+                                   uint16_t             page)
+{
+    // Sanity check
+    PX_LOG_ASSERT((page >= handle->fs_page_start) && (page <= handle->fs_page_end));
+
+    // Read erase count from first page in block
+    return px_log_fs_erase_cnt_rd(handle, page - (page % PX_LOG_FS_CFG_ERASE_BLOCK_SIZE));
+}
+#endif
+
+void px_log_fs_get_wear_stats(px_log_fs_handle_t *     handle,
+                              px_log_fs_wear_stats_t * stats)
 {
     px_log_fs_header_t header;
     uint16_t           page;
-    uint8_t            i;
+#if PX_LOG_FS_CFG_ERASE_CNT
+    uint32_t           erase_cnt;
+#endif
+
+    memset(stats, 0, sizeof(*stats));
+    stats->nr_of_blocks  = (handle->fs_page_end + 1 - handle->fs_page_start) / PX_LOG_FS_CFG_ERASE_BLOCK_SIZE;
+    stats->wr_fail_count = handle->wr_fail_count;
+#if PX_LOG_FS_CFG_ERASE_CNT
+    stats->erase_count_min = 0xffffffff;
+#endif
+    for(page = handle->fs_page_start; page <= handle->fs_page_end; page++)
+    {
+        // Count BAD pages
+        if(px_log_fs_marker_is_bad(px_log_fs_header_rd(&header, page)))
+        {
+            stats->nr_of_bad_pages++;
+        }
+#if PX_LOG_FS_CFG_ERASE_CNT
+        // First page in block?
+        if((page % PX_LOG_FS_CFG_ERASE_BLOCK_SIZE) == 0)
+        {
+            erase_cnt = px_log_fs_erase_cnt_rd(handle, page);
+            if(erase_cnt < stats->erase_count_min)
+            {
+                stats->erase_count_min = erase_cnt;
+            }
+            if(erase_cnt > stats->erase_count_max)
+            {
+                stats->erase_count_max = erase_cnt;
+            }
+            stats->erase_count_total += erase_cnt;
+        }
+#endif
+    }
+}
+
+void px_log_fs_dbg_report_info(px_log_fs_handle_t * handle)
+{
+    px_log_fs_header_t     header;
+    px_log_fs_wear_stats_t stats;
+    uint16_t               page;
+    uint8_t                i;
+#if PX_LOG_FS_CFG_ERASE_CNT
+    uint16_t               hist[8];
+    uint8_t                hist_bins;
+    uint32_t               hist_width;
+    uint16_t               hist_max;
+    uint16_t               j;
+#endif
 
     printf("Page start:       0x%04X\n", handle->fs_page_start);
     printf("Page end:         0x%04X\n", handle->fs_page_end);
     printf("Page size:        %u\n",     PX_LOG_FS_CFG_PAGE_SIZE);
-    printf("Record size:      %u\n",     sizeof(px_log_fs_record_t));
+#if PX_LOG_FS_CFG_REC_VAR_SIZE
+    printf("Max record size:  %u\n",     (unsigned int)sizeof(px_log_fs_record_t));
+    printf("Max data size:    %u\n",     PX_LOG_FS_CFG_REC_DATA_SIZE);
+#else
+    printf("Record size:      %u\n",     (unsigned int)sizeof(px_log_fs_record_t));
     printf("Record data size: %u\n",     PX_LOG_FS_CFG_REC_DATA_SIZE);
-    printf("Records per page: %u\n",     PX_LOG_FS_RECORDS_PER_PAGE);
+    printf("Records per page: %u\n",     (unsigned int)PX_LOG_FS_RECORDS_PER_PAGE);
+#endif
     printf("First page:       0x%04X\n", handle->page_first);
     printf("Last page:        0x%04X\n", handle->page_last);
 
+    px_log_fs_get_wear_stats(handle, &stats);
+    printf("BAD pages:        %u\n",     stats.nr_of_bad_pages);
+    printf("Write failures:   %lu\n",    (unsigned long)stats.wr_fail_count);
+#if PX_LOG_FS_CFG_ERASE_CNT
+    printf("Erase count min:  %lu\n",    (unsigned long)stats.erase_count_min);
+    printf("Erase count max:  %lu\n",    (unsigned long)stats.erase_count_max);
+    printf("Erase count avg:  %lu\n",    (unsigned long)(stats.erase_count_total / stats.nr_of_blocks));
+
+    // Sort erase count of each block into histogram bins
+    memset(hist, 0, sizeof(hist));
+    if(stats.erase_count_max - stats.erase_count_min < PX_LENGTHOF_ARRAY(hist))
+    {
+        hist_bins = stats.erase_count_max - stats.erase_count_min + 1;
+    }
+    else
+    {
+        hist_bins = PX_LENGTHOF_ARRAY(hist);
+    }
+    hist_width = (stats.erase_count_max - stats.erase_count_min) / hist_bins + 1;
+    for(page = handle->fs_page_start; page <= handle->fs_page_end; page += PX_LOG_FS_CFG_ERASE_BLOCK_SIZE)
+    {
+        hist[(px_log_fs_erase_cnt_rd(handle, page) - stats.erase_count_min) / hist_width]++;
+    }
+    hist_max = 1;
+    for(i = 0; i < hist_bins; i++)
+    {
+        if(hist[i] > hist_max)
+        {
+            hist_max = hist[i];
+        }
+    }
+    // Report histogram (number of blocks per erase count range)
+    printf("\nErase count histogram (blocks):\n");
+    for(i = 0; i < hist_bins; i++)
+    {
+        printf("%8lu - %8lu: %5u ",
+               (unsigned long)(stats.erase_count_min + i * hist_width),
+               (unsigned long)(stats.erase_count_min + (i + 1) * hist_width - 1),
+               hist[i]);
+        for(j = 0; j < (uint32_t)hist[i] * 40 / hist_max; j++)
+        {
+            putchar('#');
+        }
+        putchar('\n');
+    }
+#endif
+
     printf("\n        ");
     for(i = 0; i < 16; i++)
     {
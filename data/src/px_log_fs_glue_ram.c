@@ -0,0 +1,164 @@
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_log_fs_glue_ram.h : RAM simulated Serial Flash glue layer for Log FS
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+#include <string.h>
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_log_fs_glue_ram.h"
+#include "px_log_fs_cfg.h"
+#include "px_log.h"
+
+/* _____LOCAL DEFINITIONS____________________________________________________ */
+PX_LOG_NAME("px_log_fs_glue_ram");
+
+/* _____MACROS_______________________________________________________________ */
+
+/* _____GLOBAL VARIABLES_____________________________________________________ */
+
+/* _____LOCAL VARIABLES______________________________________________________ */
+/// Simulated Serial Flash buffer
+static uint8_t *                     px_log_fs_glue_ram_buf;
+/// Number of simulated pages
+static uint16_t                      px_log_fs_glue_ram_nr_of_pages;
+/// Operation counters
+static px_log_fs_glue_ram_stats_t    px_log_fs_glue_ram_stats;
+/// Optional delay function to inject latency
+static px_log_fs_glue_ram_delay_fn_t px_log_fs_glue_ram_delay_fn;
+/// Injected latency per operation
+static px_log_fs_glue_ram_latency_t  px_log_fs_glue_ram_latency;
+
+/* _____LOCAL FUNCTION DECLARATIONS__________________________________________ */
+
+/* _____LOCAL FUNCTIONS______________________________________________________ */
+static void px_log_fs_glue_ram_delay(uint32_t delay_us)
+{
+    if((px_log_fs_glue_ram_delay_fn != NULL) && (delay_us != 0))
+    {
+        px_log_fs_glue_ram_delay_fn(delay_us);
+    }
+}
+
+/* _____GLOBAL FUNCTIONS_____________________________________________________ */
+void px_log_fs_glue_ram_init(uint8_t * buf, uint16_t nr_of_pages)
+{
+    // Sanity checks
+    PX_LOG_ASSERT(buf != NULL);
+    PX_LOG_ASSERT((nr_of_pages % PX_LOG_FS_CFG_ERASE_BLOCK_SIZE) == 0);
+
+    px_log_fs_glue_ram_buf         = buf;
+    px_log_fs_glue_ram_nr_of_pages = nr_of_pages;
+    // Erase whole device
+    memset(buf, 0xff, (size_t)nr_of_pages * PX_LOG_FS_CFG_PAGE_SIZE);
+    // Reset counters
+    px_log_fs_glue_ram_reset_stats();
+}
+
+void px_log_fs_glue_ram_set_latency(px_log_fs_glue_ram_delay_fn_t        delay_fn,
+                                    const px_log_fs_glue_ram_latency_t * latency)
+{
+    px_log_fs_glue_ram_delay_fn = delay_fn;
+    if(latency != NULL)
+    {
+        px_log_fs_glue_ram_latency = *latency;
+    }
+    else
+    {
+        memset(&px_log_fs_glue_ram_latency, 0, sizeof(px_log_fs_glue_ram_latency));
+    }
+}
+
+void px_log_fs_glue_ram_get_stats(px_log_fs_glue_ram_stats_t * stats)
+{
+    *stats = px_log_fs_glue_ram_stats;
+}
+
+void px_log_fs_glue_ram_reset_stats(void)
+{
+    memset(&px_log_fs_glue_ram_stats, 0, sizeof(px_log_fs_glue_ram_stats));
+}
+
+uint8_t * px_log_fs_glue_ram_get_page(uint16_t page)
+{
+    // Sanity check
+    PX_LOG_ASSERT(page < px_log_fs_glue_ram_nr_of_pages);
+
+    return &px_log_fs_glue_ram_buf[(size_t)page * PX_LOG_FS_CFG_PAGE_SIZE];
+}
+
+void px_log_fs_glue_rd(void *   buf,
+                       uint16_t page,
+                       uint16_t start_byte_in_page,
+                       uint16_t nr_of_bytes)
+{
+    // Sanity checks
+    PX_LOG_ASSERT(page < px_log_fs_glue_ram_nr_of_pages);
+    PX_LOG_ASSERT(start_byte_in_page < PX_LOG_FS_CFG_PAGE_SIZE);
+    PX_LOG_ASSERT(nr_of_bytes <= (PX_LOG_FS_CFG_PAGE_SIZE - start_byte_in_page));
+
+    // Update counters
+    px_log_fs_glue_ram_stats.rd_count++;
+    px_log_fs_glue_ram_stats.rd_bytes += nr_of_bytes;
+    px_log_fs_glue_ram_delay(px_log_fs_glue_ram_latency.rd_us);
+
+    // Read data from simulated Serial Flash
+    memcpy(buf, px_log_fs_glue_ram_get_page(page) + start_byte_in_page, nr_of_bytes);
+}
+
+void px_log_fs_glue_wr(const void * buf,
+                       uint16_t     page,
+                       uint16_t     start_byte_in_page,
+                       uint16_t     nr_of_bytes)
+{
+    const uint8_t * data = (const uint8_t *)buf;
+    uint8_t *       dst;
+
+    // Sanity checks
+    PX_LOG_ASSERT(page < px_log_fs_glue_ram_nr_of_pages);
+    PX_LOG_ASSERT(start_byte_in_page < PX_LOG_FS_CFG_PAGE_SIZE);
+    PX_LOG_ASSERT(nr_of_bytes <= (PX_LOG_FS_CFG_PAGE_SIZE - start_byte_in_page));
+
+    // Update counters
+    px_log_fs_glue_ram_stats.wr_count++;
+    px_log_fs_glue_ram_stats.wr_bytes += nr_of_bytes;
+    px_log_fs_glue_ram_delay(px_log_fs_glue_ram_latency.wr_us);
+
+    // Write data to simulated Serial Flash (bits can only be cleared)
+    dst = px_log_fs_glue_ram_get_page(page) + start_byte_in_page;
+    while(nr_of_bytes != 0)
+    {
+        *dst++ &= *data++;
+        nr_of_bytes--;
+    }
+}
+
+void px_log_fs_glue_erase_block(uint16_t page)
+{
+    // Sanity checks
+    PX_LOG_ASSERT((page & (PX_LOG_FS_CFG_ERASE_BLOCK_SIZE - 1)) == 0);
+    PX_LOG_ASSERT(page < px_log_fs_glue_ram_nr_of_pages);
+
+    // Update counters
+    px_log_fs_glue_ram_stats.erase_count++;
+    px_log_fs_glue_ram_delay(px_log_fs_glue_ram_latency.erase_us);
+
+    // Erase block of simulated Serial Flash
+    memset(px_log_fs_glue_ram_get_page(page),
+           0xff,
+           (size_t)PX_LOG_FS_CFG_ERASE_BLOCK_SIZE * PX_LOG_FS_CFG_PAGE_SIZE);
+}
@@ -0,0 +1,324 @@
+/*
+ *  Host benchmark for px_log_fs using the RAM simulated Serial Flash
+ *  (px_log_fs_glue_ram.c). Build and run with tools/px_host_test/Makefile:
+ *
+ *      make -C tools/px_host_test run
+ *
+ *  Optional arguments: [pages] [read latency us] [write latency us] [erase latency us]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include "px_log_fs.h"
+#include "px_log_fs_glue_ram.h"
+#include "px_host_bench.h"
+
+/// Default number of simulated pages (AT25SF041 = 4 Mbit = 2048 pages)
+#define BENCH_PAGES_DEFAULT     2048
+
+#if PX_LOG_FS_CFG_REC_VAR_SIZE
+/// Record data size varies from 4 to 60 bytes
+#define BENCH_REC_DATA_SIZE(rec_nr) (4 + (rec_nr) % 57)
+/// Average record size (including 3 bytes overhead)
+#define BENCH_REC_SIZE_AVG      (32 + 3)
+#else
+/// Record data size is fixed
+#define BENCH_REC_DATA_SIZE(rec_nr) (sizeof(uint32_t) + sizeof(int16_t))
+/// Record size (including 2 bytes overhead)
+#define BENCH_REC_SIZE_AVG      (PX_LOG_FS_CFG_REC_DATA_SIZE + 2)
+#endif
+
+// Define record data content
+typedef struct
+{
+    uint32_t nr;
+    int16_t  temperature;
+    uint8_t  data[PX_LOG_FS_CFG_REC_DATA_SIZE];
+} PX_ATTR_PACKED px_log_fs_data_t;
+
+static px_log_fs_handle_t px_log_fs_handle;
+static px_log_fs_data_t   px_log_fs_data;
+static uint16_t           bench_pages = BENCH_PAGES_DEFAULT;
+static uint8_t *          bench_flash;
+
+static uint64_t                   bench_start_us;
+static px_log_fs_glue_ram_stats_t bench_stats;
+static uint32_t                   bench_erase_total;
+
+static void bench_start(void)
+{
+    px_log_fs_glue_ram_reset_stats();
+    bench_start_us = px_host_bench_time_us();
+}
+
+static void bench_stop(const char * name, uint32_t nr_of_records)
+{
+    uint64_t time_us = px_host_bench_time_us() - bench_start_us;
+
+    px_log_fs_glue_ram_get_stats(&bench_stats);
+    bench_erase_total += bench_stats.erase_count;
+    printf("%-16s %8lu %10lu %10lu %10lu %10lu %8lu %10lu %12.0f\n",
+           name,
+           (unsigned long)nr_of_records,
+           (unsigned long)bench_stats.rd_count,
+           (unsigned long)bench_stats.rd_bytes,
+           (unsigned long)bench_stats.wr_count,
+           (unsigned long)bench_stats.wr_bytes,
+           (unsigned long)bench_stats.erase_count,
+           (unsigned long)time_us,
+           px_host_bench_per_sec(nr_of_records, time_us));
+}
+
+static uint32_t bench_wr(uint32_t nr_of_records)
+{
+    uint32_t i;
+
+    for(i = 0; i < nr_of_records; i++)
+    {
+        px_log_fs_data.nr++;
+        px_log_fs_data.temperature = (int16_t)(px_log_fs_data.nr & 0x3ff);
+        PX_HOST_CHECK(px_log_fs_wr(&px_log_fs_handle, &px_log_fs_data, BENCH_REC_DATA_SIZE(px_log_fs_data.nr)) == PX_LOG_FS_ERR_NONE);
+    }
+    // Write cached records (if any)
+    PX_HOST_CHECK(px_log_fs_flush(&px_log_fs_handle) == PX_LOG_FS_ERR_NONE);
+
+    return nr_of_records;
+}
+
+#if PX_LOG_FS_CFG_WR_CACHE
+static uint32_t bench_wr_bad_header(uint32_t nr_of_records)
+{
+    px_log_fs_wear_stats_t stats;
+    uint16_t               page;
+    uint8_t *              header;
+
+    // Find page that the next page header will be written to
+    page   = px_log_fs_handle.adr_wr.page;
+    header = px_log_fs_glue_ram_get_page(page);
+    if(header[0] != 0xff)
+    {
+        page   = (page + 1) % bench_pages;
+        header = px_log_fs_glue_ram_get_page(page);
+    }
+    // Clear page number in FREE header so that header write fails to verify
+    header[1] = 0x00;
+    header[2] = 0x00;
+    // Cached records must be moved to next page without being lost
+    bench_wr(nr_of_records);
+    px_log_fs_get_wear_stats(&px_log_fs_handle, &stats);
+    PX_HOST_CHECK(stats.nr_of_bad_pages == 1);
+    PX_HOST_CHECK(stats.wr_fail_count   == 1);
+
+    return nr_of_records;
+}
+#endif
+
+static uint32_t bench_rd_all(void)
+{
+    px_log_fs_err_t  err;
+    px_log_fs_data_t data;
+    uint32_t         nr_of_records = 0;
+    uint32_t         nr_previous   = 0;
+
+    err = px_log_fs_rd_first(&px_log_fs_handle, &data, sizeof(data));
+    while(err == PX_LOG_FS_ERR_NONE)
+    {
+        // Records must be in sequence
+        if(nr_of_records != 0)
+        {
+            PX_HOST_CHECK(data.nr == nr_previous + 1);
+        }
+#if PX_LOG_FS_CFG_REC_VAR_SIZE
+        // Record size must match written size
+        PX_HOST_CHECK(px_log_fs_rd_rec_size(&px_log_fs_handle) == BENCH_REC_DATA_SIZE(data.nr));
+#endif
+        nr_previous = data.nr;
+        nr_of_records++;
+        err = px_log_fs_rd_next(&px_log_fs_handle, &data, sizeof(data));
+    }
+    // Last record must be the newest one written
+    PX_HOST_CHECK((nr_of_records == 0) || (nr_previous == px_log_fs_data.nr));
+
+    return nr_of_records;
+}
+
+#if PX_LOG_FS_CFG_REC_KEY
+static uint32_t bench_seek(uint32_t nr_of_seeks, uint32_t nr_of_records)
+{
+    px_log_fs_data_t data;
+    uint32_t         nr_first = px_log_fs_data.nr - nr_of_records + 1;
+    uint32_t         nr;
+    uint32_t         i;
+
+    // Record number is key. Seek to records spread over whole file
+    for(i = 0; i < nr_of_seeks; i++)
+    {
+        nr = nr_first + (i * 7919) % nr_of_records;
+        PX_HOST_CHECK(px_log_fs_rd_seek(&px_log_fs_handle, nr, &data, sizeof(data)) == PX_LOG_FS_ERR_NONE);
+        PX_HOST_CHECK(data.nr == nr);
+    }
+    // Key before first record must return first record
+    PX_HOST_CHECK(px_log_fs_rd_seek(&px_log_fs_handle, 0, &data, sizeof(data)) == PX_LOG_FS_ERR_NONE);
+    PX_HOST_CHECK(data.nr == nr_first);
+    // Key after last record must fail
+    PX_HOST_CHECK(px_log_fs_rd_seek(&px_log_fs_handle, px_log_fs_data.nr + 1, &data, sizeof(data)) == PX_LOG_FS_ERR_NO_RECORD);
+
+    return nr_of_seeks + 2;
+}
+#endif
+
+static void bench_verify_init(uint32_t nr_of_iterations)
+{
+    px_log_fs_handle_t handle_wr;
+    uint32_t           i;
+
+    // Write a varying number of records and check that mount finds the same position
+    for(i = 0; i < nr_of_iterations; i++)
+    {
+        bench_wr(1 + (i * 37) % 997);
+        handle_wr = px_log_fs_handle;
+        PX_HOST_CHECK(px_log_fs_init(&px_log_fs_handle, 0, bench_pages - 1) == PX_LOG_FS_ERR_NONE);
+        PX_HOST_CHECK(px_log_fs_handle.page_first    == handle_wr.page_first);
+        PX_HOST_CHECK(px_log_fs_handle.page_last     == handle_wr.page_last);
+        PX_HOST_CHECK(px_log_fs_handle.page_nr_next  == handle_wr.page_nr_next);
+        PX_HOST_CHECK(px_log_fs_handle.adr_wr.page   == handle_wr.adr_wr.page);
+        PX_HOST_CHECK(px_log_fs_handle.adr_wr.offset == handle_wr.adr_wr.offset);
+    }
+}
+
+static void bench_wear(void)
+{
+    px_log_fs_wear_stats_t stats;
+
+    px_log_fs_get_wear_stats(&px_log_fs_handle, &stats);
+    printf("\nBAD pages %u, write failures %lu",
+           stats.nr_of_bad_pages, (unsigned long)stats.wr_fail_count);
+    PX_HOST_CHECK(stats.nr_of_bad_pages == 0);
+    PX_HOST_CHECK(stats.wr_fail_count   == 0);
+#if PX_LOG_FS_CFG_ERASE_CNT
+    printf(", erase count min %lu max %lu total %lu (block erases %lu)",
+           (unsigned long)stats.erase_count_min,
+           (unsigned long)stats.erase_count_max,
+           (unsigned long)stats.erase_count_total,
+           (unsigned long)bench_erase_total);
+    // Each erase must be counted
+    PX_HOST_CHECK(stats.erase_count_total == bench_erase_total);
+    // Blocks are erased in sequence, so erase counts may differ by one at most
+    PX_HOST_CHECK(stats.erase_count_max - stats.erase_count_min <= 1);
+    PX_HOST_CHECK(px_log_fs_get_erase_count(&px_log_fs_handle, 0) >= stats.erase_count_min);
+#endif
+    printf("\n");
+}
+
+static void bench_latency_delay(uint32_t delay_us)
+{
+    px_host_bench_delay_us(delay_us);
+}
+
+int main(int argc, char * argv[])
+{
+    px_log_fs_glue_ram_latency_t latency = {0};
+    uint32_t                     nr_of_records;
+    uint32_t                     records_per_fs;
+
+    if(argc > 1)
+    {
+        bench_pages = (uint16_t)strtoul(argv[1], NULL, 0);
+    }
+    if(argc > 2)
+    {
+        latency.rd_us    = (uint32_t)strtoul(argv[2], NULL, 0);
+    }
+    if(argc > 3)
+    {
+        latency.wr_us    = (uint32_t)strtoul(argv[3], NULL, 0);
+    }
+    if(argc > 4)
+    {
+        latency.erase_us = (uint32_t)strtoul(argv[4], NULL, 0);
+    }
+    PX_HOST_CHECK(bench_pages >= 2 * PX_LOG_FS_CFG_ERASE_BLOCK_SIZE);
+    PX_HOST_CHECK((bench_pages % PX_LOG_FS_CFG_ERASE_BLOCK_SIZE) == 0);
+
+    // Create simulated Serial Flash
+    bench_flash = malloc((size_t)bench_pages * PX_LOG_FS_CFG_PAGE_SIZE);
+    PX_HOST_CHECK(bench_flash != NULL);
+    px_log_fs_glue_ram_init(bench_flash, bench_pages);
+    px_log_fs_glue_ram_set_latency(bench_latency_delay, &latency);
+
+    // Estimate capacity (number of records that fit in file system)
+    records_per_fs =   (uint32_t)bench_pages
+                     * ((PX_LOG_FS_CFG_PAGE_SIZE - 4) / BENCH_REC_SIZE_AVG);
+
+    printf("px_log_fs benchmark: %u pages x %u bytes, erase block %u pages, record data %u bytes\n",
+           bench_pages, PX_LOG_FS_CFG_PAGE_SIZE, PX_LOG_FS_CFG_ERASE_BLOCK_SIZE, PX_LOG_FS_CFG_REC_DATA_SIZE);
+    printf("Latency (us): read %lu, write %lu, erase %lu\n\n",
+           (unsigned long)latency.rd_us, (unsigned long)latency.wr_us, (unsigned long)latency.erase_us);
+    printf("Mount with binary search: %s\n", PX_LOG_FS_CFG_INIT_BIN_SEARCH ? "yes" : "no");
+    printf("Write cache: %s (max records %u)\n", PX_LOG_FS_CFG_WR_CACHE ? "yes" : "no", PX_LOG_FS_CFG_WR_CACHE_MAX_REC);
+    printf("Variable size records: %s\n", PX_LOG_FS_CFG_REC_VAR_SIZE ? "yes (4 to 60 bytes)" : "no");
+    printf("Record key in page header: %s\n", PX_LOG_FS_CFG_REC_KEY ? "yes" : "no");
+    printf("Erase count in page header: %s\n\n", PX_LOG_FS_CFG_ERASE_CNT ? "yes" : "no");
+    printf("%-16s %8s %10s %10s %10s %10s %8s %10s %12s\n",
+           "Phase", "Records", "Reads", "Rd bytes", "Writes", "Wr bytes", "Erases", "Time us", "Records/s");
+
+    // Mount empty file system
+    bench_start();
+    PX_HOST_CHECK(px_log_fs_init(&px_log_fs_handle, 0, bench_pages - 1) == PX_LOG_FS_ERR_NONE);
+    bench_stop("init (empty)", 0);
+
+    // Fill half of the file system
+    bench_start();
+#if PX_LOG_FS_CFG_WR_CACHE
+    nr_of_records  = bench_wr(records_per_fs / 4);
+    nr_of_records += bench_wr_bad_header(records_per_fs / 2 - nr_of_records);
+#else
+    nr_of_records = bench_wr(records_per_fs / 2);
+#endif
+    bench_stop("write", nr_of_records);
+
+    // Mount half full file system
+    bench_start();
+    PX_HOST_CHECK(px_log_fs_init(&px_log_fs_handle, 0, bench_pages - 1) == PX_LOG_FS_ERR_NONE);
+    bench_stop("init (half)", 0);
+
+    // Read all records
+    bench_start();
+    nr_of_records = bench_rd_all();
+    bench_stop("read all", nr_of_records);
+    PX_HOST_CHECK(nr_of_records == records_per_fs / 2);
+
+    // Write until file system has wrapped around
+    bench_start();
+    nr_of_records = bench_wr(records_per_fs);
+    bench_stop("write (wrap)", nr_of_records);
+
+    // Mount wrapped file system
+    bench_start();
+    PX_HOST_CHECK(px_log_fs_init(&px_log_fs_handle, 0, bench_pages - 1) == PX_LOG_FS_ERR_NONE);
+    bench_stop("init (wrapped)", 0);
+
+    // Read all records after wrap
+    bench_start();
+    nr_of_records = bench_rd_all();
+    bench_stop("read all (wrap)", nr_of_records);
+    PX_HOST_CHECK(nr_of_records != 0);
+
+#if PX_LOG_FS_CFG_REC_KEY
+    // Seek records by key
+    bench_start();
+    nr_of_records = bench_seek(1000, nr_of_records);
+    bench_stop("seek", nr_of_records);
+#endif
+
+    // Check mount result at many different write positions
+    bench_start();
+    bench_verify_init(2 * bench_pages / 16);
+    bench_stop("verify init", 0);
+
+    // Report wear levelling statistics
+    bench_wear();
+
+    free(bench_flash);
+
+    return 0;
+}
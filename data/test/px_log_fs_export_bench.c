@@ -0,0 +1,368 @@
+/*
+ *  Host benchmark for px_log_fs bulk export (px_log_fs_export_rd()) into HDLC
+ *  frames. The frames are looped back into the HDLC receiver, which checks
+ *  that every record arrives exactly once and in sequence. Link drops are
+ *  simulated by corrupting frames; the export is then resumed from the cursor
+ *  of the last frame that was received. Build and run with
+ *  tools/px_host_test/Makefile:
+ *
+ *      make -C tools/px_host_test run
+ *
+ *  Optional arguments: [pages] [drop every n frames]
+ *
+ *  Each HDLC frame contains:
+ *
+ *      [cursor after last record in frame] [packed record data ...]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "px_log_fs.h"
+#include "px_log_fs_glue_ram.h"
+#include "px_hdlc.h"
+#include "px_host_bench.h"
+
+/// Default number of simulated pages (AT25SF041 = 4 Mbit = 2048 pages)
+#define BENCH_PAGES_DEFAULT     2048
+/// Default link drop interval (number of frames)
+#define BENCH_DROP_DEFAULT      97
+/// Frame payload size (HDLC receive buffer also holds the 16-bit FCS and must not fill up)
+#define BENCH_FRAME_SIZE        (PX_HDLC_MRU - 3)
+
+#if PX_LOG_FS_CFG_REC_VAR_SIZE
+/// Record data size varies from 4 to 60 bytes
+#define BENCH_REC_DATA_SIZE(rec_nr) (4 + (rec_nr) % 57)
+/// Average record size (including 3 bytes overhead)
+#define BENCH_REC_SIZE_AVG      (32 + 3)
+#else
+/// Record data size is fixed
+#define BENCH_REC_DATA_SIZE(rec_nr) (sizeof(uint32_t) + sizeof(int16_t))
+/// Record size (including 2 bytes overhead)
+#define BENCH_REC_SIZE_AVG      (PX_LOG_FS_CFG_REC_DATA_SIZE + 2)
+#endif
+
+// Define record data content
+typedef struct
+{
+    uint32_t nr;
+    int16_t  temperature;
+    uint8_t  data[PX_LOG_FS_CFG_REC_DATA_SIZE];
+} PX_ATTR_PACKED px_log_fs_data_t;
+
+// Receiver state
+typedef struct
+{
+    px_log_fs_cursor_t cursor;          ///< Cursor received in last good frame
+    uint32_t           nr_expected;     ///< Expected number of next record (0 = any)
+    uint32_t           nr_last;         ///< Number of last record received
+    uint32_t           nr_of_records;   ///< Number of records received
+    uint32_t           nr_of_frames;    ///< Number of good frames received
+    bool               frame_flag;      ///< Good frame received
+} bench_rx_t;
+
+static px_log_fs_handle_t px_log_fs_handle;
+static px_log_fs_data_t   px_log_fs_data;
+static px_hdlc_handle_t   bench_hdlc;
+static uint16_t           bench_pages = BENCH_PAGES_DEFAULT;
+static uint32_t           bench_drop  = BENCH_DROP_DEFAULT;
+static uint8_t *          bench_flash;
+
+static bench_rx_t         bench_rx;
+static uint8_t            bench_frame[BENCH_FRAME_SIZE];
+static uint32_t           bench_tx_frames;
+static uint32_t           bench_tx_bytes;
+static uint32_t           bench_tx_drops;
+static bool               bench_corrupt_flag;
+
+static uint64_t                   bench_start_us;
+static px_log_fs_glue_ram_stats_t bench_stats;
+
+static void bench_tx_u8(px_hdlc_handle_t * handle, uint8_t data)
+{
+    bench_tx_bytes++;
+    // Corrupt byte to simulate link drop?
+    if(bench_corrupt_flag)
+    {
+        bench_corrupt_flag = false;
+        data ^= 0x01;
+    }
+    // Loop back into HDLC receiver
+    px_hdlc_on_rx_u8(handle, data);
+}
+
+static void bench_on_rx_frame(px_hdlc_handle_t * handle, const uint8_t * data, size_t nr_of_bytes)
+{
+    px_log_fs_data_t rec;
+    size_t           rec_size;
+
+    PX_HOST_CHECK(nr_of_bytes > sizeof(px_log_fs_cursor_t));
+    memcpy(&bench_rx.cursor, data, sizeof(px_log_fs_cursor_t));
+    data        += sizeof(px_log_fs_cursor_t);
+    nr_of_bytes -= sizeof(px_log_fs_cursor_t);
+
+    // Unpack records
+    while(nr_of_bytes != 0)
+    {
+#if PX_LOG_FS_CFG_REC_VAR_SIZE
+        rec_size = *data++;
+        nr_of_bytes--;
+#else
+        rec_size = PX_LOG_FS_CFG_REC_DATA_SIZE;
+#endif
+        PX_HOST_CHECK(rec_size <= nr_of_bytes);
+        memcpy(&rec, data, rec_size);
+        data        += rec_size;
+        nr_of_bytes -= rec_size;
+        // Record must be in sequence and have written size
+        PX_HOST_CHECK((bench_rx.nr_expected == 0) || (rec.nr == bench_rx.nr_expected));
+        PX_HOST_CHECK(rec_size >= BENCH_REC_DATA_SIZE(rec.nr));
+        bench_rx.nr_last     = rec.nr;
+        bench_rx.nr_expected = rec.nr + 1;
+        bench_rx.nr_of_records++;
+    }
+    bench_rx.nr_of_frames++;
+    bench_rx.frame_flag = true;
+}
+
+static void bench_start(void)
+{
+    px_log_fs_glue_ram_reset_stats();
+    bench_tx_frames = 0;
+    bench_tx_bytes  = 0;
+    bench_tx_drops  = 0;
+    bench_start_us  = px_host_bench_time_us();
+}
+
+static void bench_stop(const char * name, uint32_t nr_of_records)
+{
+    uint64_t time_us = px_host_bench_time_us() - bench_start_us;
+
+    px_log_fs_glue_ram_get_stats(&bench_stats);
+    printf("%-16s %8lu %8lu %6lu %10lu %10lu %10lu %12.0f %10.3f\n",
+           name,
+           (unsigned long)nr_of_records,
+           (unsigned long)bench_tx_frames,
+           (unsigned long)bench_tx_drops,
+           (unsigned long)bench_stats.rd_count,
+           (unsigned long)bench_tx_bytes,
+           (unsigned long)time_us,
+           px_host_bench_per_sec(bench_tx_bytes, time_us),
+           nr_of_records ? (double)bench_tx_frames / (double)nr_of_records : 0.0);
+}
+
+static void bench_wr(uint32_t nr_of_records)
+{
+    uint32_t i;
+
+    for(i = 0; i < nr_of_records; i++)
+    {
+        px_log_fs_data.nr++;
+        px_log_fs_data.temperature = (int16_t)(px_log_fs_data.nr & 0x3ff);
+        PX_HOST_CHECK(px_log_fs_wr(&px_log_fs_handle, &px_log_fs_data, BENCH_REC_DATA_SIZE(px_log_fs_data.nr)) == PX_LOG_FS_ERR_NONE);
+    }
+    // Write cached records (if any)
+    PX_HOST_CHECK(px_log_fs_flush(&px_log_fs_handle) == PX_LOG_FS_ERR_NONE);
+}
+
+static uint32_t bench_rd_all(void)
+{
+    px_log_fs_err_t  err;
+    px_log_fs_data_t data;
+    uint32_t         nr_of_records = 0;
+
+    err = px_log_fs_rd_first(&px_log_fs_handle, &data, sizeof(data));
+    while(err == PX_LOG_FS_ERR_NONE)
+    {
+        nr_of_records++;
+        err = px_log_fs_rd_next(&px_log_fs_handle, &data, sizeof(data));
+    }
+    return nr_of_records;
+}
+
+static uint32_t bench_rd_first_nr(void)
+{
+    px_log_fs_data_t data;
+
+    PX_HOST_CHECK(px_log_fs_rd_first(&px_log_fs_handle, &data, sizeof(data)) == PX_LOG_FS_ERR_NONE);
+    return data.nr;
+}
+
+/*
+ *  Send one frame of records from cursor. Returns false if there are no more
+ *  records. If the frame was lost, the cursor is restored to the cursor of the
+ *  last frame that was received (resume after link drop).
+ */
+static bool bench_export_frame(px_log_fs_cursor_t * cursor)
+{
+    px_log_fs_err_t err;
+    size_t          nr_of_bytes;
+
+    err = px_log_fs_export_rd(&px_log_fs_handle,
+                              cursor,
+                              &bench_frame[sizeof(px_log_fs_cursor_t)],
+                              sizeof(bench_frame) - sizeof(px_log_fs_cursor_t),
+                              &nr_of_bytes);
+    if(err != PX_LOG_FS_ERR_NONE)
+    {
+        PX_HOST_CHECK(err == PX_LOG_FS_ERR_NO_RECORD);
+        return false;
+    }
+    memcpy(bench_frame, cursor, sizeof(px_log_fs_cursor_t));
+
+    // Simulate link drop?
+    bench_tx_frames++;
+    if((bench_drop != 0) && ((bench_tx_frames % bench_drop) == 0))
+    {
+        bench_corrupt_flag = true;
+        bench_tx_drops++;
+    }
+    bench_rx.frame_flag = false;
+    px_hdlc_tx_frame(&bench_hdlc, bench_frame, sizeof(px_log_fs_cursor_t) + nr_of_bytes);
+    if(!bench_rx.frame_flag)
+    {
+        // Resume from cursor of last frame that was received
+        *cursor = bench_rx.cursor;
+    }
+    return true;
+}
+
+static uint32_t bench_export_all(void)
+{
+    px_log_fs_cursor_t cursor;
+
+    memset(&bench_rx, 0, sizeof(bench_rx));
+    px_log_fs_export_start(&px_log_fs_handle, &cursor);
+    bench_rx.cursor      = cursor;
+    bench_rx.nr_expected = bench_rd_first_nr();
+    while(bench_export_frame(&cursor))
+    {
+        ;
+    }
+    // Last record must be the newest one written
+    PX_HOST_CHECK(bench_rx.nr_last == px_log_fs_data.nr);
+
+    return bench_rx.nr_of_records;
+}
+
+static uint32_t bench_export_live(uint32_t nr_of_records)
+{
+    px_log_fs_cursor_t cursor;
+    uint32_t           i;
+
+    // Export while records are written (oldest records may be overwritten
+    // before first frame, so first record number is not checked)
+    memset(&bench_rx, 0, sizeof(bench_rx));
+    px_log_fs_export_start(&px_log_fs_handle, &cursor);
+    bench_rx.cursor      = cursor;
+    for(i = 0; i < nr_of_records; i++)
+    {
+        bench_wr(1 + i % 3);
+        bench_export_frame(&cursor);
+    }
+    while(bench_export_frame(&cursor))
+    {
+        ;
+    }
+    PX_HOST_CHECK(bench_rx.nr_last == px_log_fs_data.nr);
+
+    return bench_rx.nr_of_records;
+}
+
+static uint32_t bench_export_overwritten(uint32_t records_per_fs)
+{
+    px_log_fs_cursor_t cursor;
+    uint32_t           i;
+
+    // Export a few frames
+    memset(&bench_rx, 0, sizeof(bench_rx));
+    px_log_fs_export_start(&px_log_fs_handle, &cursor);
+    bench_rx.cursor      = cursor;
+    bench_rx.nr_expected = bench_rd_first_nr();
+    for(i = 0; i < 10; i++)
+    {
+        bench_export_frame(&cursor);
+    }
+    // Link down while file system wraps and overwrites records at cursor
+    bench_wr(records_per_fs);
+    // Resume must restart at first record
+    bench_rx.nr_expected = bench_rd_first_nr();
+    while(bench_export_frame(&cursor))
+    {
+        ;
+    }
+    PX_HOST_CHECK(bench_rx.nr_last == px_log_fs_data.nr);
+
+    return bench_rx.nr_of_records;
+}
+
+int main(int argc, char * argv[])
+{
+    uint32_t nr_of_records;
+    uint32_t records_per_fs;
+
+    if(argc > 1)
+    {
+        bench_pages = (uint16_t)strtoul(argv[1], NULL, 0);
+    }
+    if(argc > 2)
+    {
+        bench_drop  = (uint32_t)strtoul(argv[2], NULL, 0);
+    }
+    PX_HOST_CHECK(bench_pages >= 2 * PX_LOG_FS_CFG_ERASE_BLOCK_SIZE);
+    PX_HOST_CHECK((bench_pages % PX_LOG_FS_CFG_ERASE_BLOCK_SIZE) == 0);
+
+    // Create simulated Serial Flash
+    bench_flash = malloc((size_t)bench_pages * PX_LOG_FS_CFG_PAGE_SIZE);
+    PX_HOST_CHECK(bench_flash != NULL);
+    px_log_fs_glue_ram_init(bench_flash, bench_pages);
+    PX_HOST_CHECK(px_log_fs_init(&px_log_fs_handle, 0, bench_pages - 1) == PX_LOG_FS_ERR_NONE);
+
+    // HDLC loopback
+    px_hdlc_init(&bench_hdlc, bench_tx_u8, bench_on_rx_frame);
+
+    // Estimate capacity (number of records that fit in file system)
+    records_per_fs =   (uint32_t)bench_pages
+                     * ((PX_LOG_FS_CFG_PAGE_SIZE - 4) / BENCH_REC_SIZE_AVG);
+
+    printf("px_log_fs export benchmark: %u pages x %u bytes, record data %u bytes, HDLC MRU %u bytes\n",
+           bench_pages, PX_LOG_FS_CFG_PAGE_SIZE, PX_LOG_FS_CFG_REC_DATA_SIZE, PX_HDLC_MRU);
+    printf("Variable size records: %s\n", PX_LOG_FS_CFG_REC_VAR_SIZE ? "yes (4 to 60 bytes)" : "no");
+    printf("Link drop every %lu frames\n\n", (unsigned long)bench_drop);
+    printf("%-16s %8s %8s %6s %10s %10s %10s %12s %10s\n",
+           "Phase", "Records", "Frames", "Drops", "Reads", "Wire bytes", "Time us", "Bytes/s", "Frames/rec");
+
+    // Fill half of the file system
+    bench_wr(records_per_fs / 2);
+
+    // Baseline: read all records one at a time
+    bench_start();
+    nr_of_records = bench_rd_all();
+    bench_stop("read all", nr_of_records);
+
+    // Export all records
+    bench_start();
+    nr_of_records = bench_export_all();
+    bench_stop("export", nr_of_records);
+    PX_HOST_CHECK(nr_of_records == records_per_fs / 2);
+
+    // Write until file system has wrapped around and export all records
+    bench_wr(records_per_fs);
+    bench_start();
+    nr_of_records = bench_export_all();
+    bench_stop("export (wrap)", nr_of_records);
+    PX_HOST_CHECK(nr_of_records == bench_rd_all());
+
+    // Export while new records are written
+    bench_start();
+    nr_of_records = bench_export_live(1000);
+    bench_stop("export (live)", nr_of_records);
+
+    // Resume after records at cursor have been overwritten
+    bench_start();
+    nr_of_records = bench_export_overwritten(records_per_fs);
+    bench_stop("export (resume)", nr_of_records);
+
+    free(bench_flash);
+
+    return 0;
+}
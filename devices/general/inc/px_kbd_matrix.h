@@ -84,7 +84,7 @@
 
 /* _____PROJECT INCLUDES_____________________________________________________ */
 #include "px_defs.h"
-#include "px_link_list.h"
+#include "px_link_list_hash.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -108,6 +108,11 @@ extern "C" {
 #define PX_KBD_MATRIX_MAX_NR_KEYS_PRESSED 4
 #endif
 
+#ifndef PX_KBD_MATRIX_NR_OF_BUCKETS
+/// Number of hash buckets to find a pressed key (must be a power of two)
+#define PX_KBD_MATRIX_NR_OF_BUCKETS 4
+#endif
+
 #ifndef KBD_DELAY_BEFORE_REPEATING_KEY
 /// Delay before a pressed key will be repeated
 #define KBD_DELAY_BEFORE_REPEATING_KEY 200
@@ -173,12 +178,12 @@ typedef struct
     uint8_t bit_mask[PX_KBD_MATRIX_MAX_NR_KEYS/8];
 } px_kbd_matrix_key_state_t;
 
-/// Linked list item that describes which key has been pressed
+/// Linked list item that describes which key has been pressed (key = row * nr_of_columns + col)
 typedef struct
 {
-    px_link_list_item_t key_list_item;
-    uint8_t             row;
-    uint8_t             col;
+    px_link_list_hash_item_t key_list_item;
+    uint8_t                  row;
+    uint8_t                  col;
 } px_kbd_matrix_key_t;
 
 /// Keyboard matrix definition and state
@@ -189,7 +194,8 @@ typedef struct
     px_kbd_matrix_key_state_t    key_state;                                          ///< Bit mask that stores the current state of the keys
     px_kbd_matrix_key_state_t    key_history[PX_KBD_MATRIX_NR_SAMPLES];              ///< Array of bit masks that stores the key state history
     uint8_t                      key_history_index;                                  ///< Wrapping index (used as a ring buffer)
-    px_link_list_t               key_press_list;                                     ///< Linked list of pressed keys
+    px_link_list_hash_t          key_press_list;                                     ///< Linked list of pressed keys
+    px_link_list_hash_item_t *   key_press_buckets[PX_KBD_MATRIX_NR_OF_BUCKETS];     ///< Hash index to find a pressed key
     px_kbd_matrix_key_t          key_press_array[PX_KBD_MATRIX_MAX_NR_KEYS_PRESSED]; ///< Storage for linked list to remember which keys are pressed
     uint16_t                     key_repeat_counter;                                 ///< Counter to determine if a pressed key must repeated (typematic)
     px_kbd_matrix_set_row_t      set_row;                                            ///< Function handler to write a row output
@@ -150,10 +150,10 @@ static bool px_kbd_matrix_phantom_key(px_link_list_t * key_press_list)
                 }
             }
             // Next item
-            key_press_compare = (px_kbd_matrix_key_t *)px_link_list_get_item_next(key_press_list, &key_press_compare->key_list_item);
+            key_press_compare = (px_kbd_matrix_key_t *)px_link_list_get_item_next(key_press_list, &key_press_compare->key_list_item.list_item);
         }
         // Next item
-        key_press = (px_kbd_matrix_key_t *)px_link_list_get_item_next(key_press_list, &key_press->key_list_item);
+        key_press = (px_kbd_matrix_key_t *)px_link_list_get_item_next(key_press_list, &key_press->key_list_item.list_item);
     }
 
     return false;
@@ -164,15 +164,15 @@ static void px_kbd_matrix_on_key_event(px_kbd_matrix_t *     matrix,
                                        uint8_t               col,
                                        px_kbd_matrix_event_t event)
 {
-    px_link_list_t *      key_press_list = &(matrix->key_press_list);
-    px_link_list_item_t * key_press_item;
+    px_link_list_hash_t * key_press_list = &(matrix->key_press_list);
     px_kbd_matrix_key_t * key_press;
+    uint32_t              key = (uint32_t)row * matrix->nr_of_columns + col;
     uint8_t               i;    
 
     if(event == PX_KBD_MATRIX_EVENT_PRESSED)
     {
         // See if key pressed list is full
-        if(px_link_list_is_full(key_press_list))
+        if(px_link_list_is_full(&key_press_list->list))
         {
             // Ignore extra key presses
             return;
@@ -183,24 +183,28 @@ static void px_kbd_matrix_on_key_event(px_kbd_matrix_t *     matrix,
         {
             key_press = &(matrix->key_press_array[i]);
 
-            if(px_link_list_has_item(key_press_list, &(key_press->key_list_item)) == false)
+            if(px_link_list_hash_has_item(key_press_list, &(key_press->key_list_item)) == false)
             {
                 // Add key to list
                 key_press->row = row;
                 key_press->col = col;
-                px_link_list_insert_item_end(key_press_list, &(key_press->key_list_item));
-				break;
+                if(!px_link_list_hash_insert_item_end(key_press_list, &(key_press->key_list_item), key))
+                {
+                    // Key is already in the list
+                    return;
+                }
+                break;
             }
         }
 
         // See if phantom key detection should be performed
-        if(px_link_list_get_item_count(key_press_list) >= 3)
+        if(px_link_list_get_item_count(&key_press_list->list) >= 3)
         {
             // See if key forms the third side of a rectangle
-            if(px_kbd_matrix_phantom_key(key_press_list))
+            if(px_kbd_matrix_phantom_key(&key_press_list->list))
             {
                 // Remove phantom key from the list
-                key_press = (px_kbd_matrix_key_t *)px_link_list_remove_item_last(key_press_list);
+                px_link_list_hash_remove_item_last(key_press_list);
                 return;
             }
         }
@@ -213,25 +217,12 @@ static void px_kbd_matrix_on_key_event(px_kbd_matrix_t *     matrix,
 
     if(event == PX_KBD_MATRIX_EVENT_RELEASED)
     {
-        // Start at first item in the list
-        key_press_item = px_link_list_get_item_first(key_press_list);
-        while(key_press_item != NULL)
+        // Remove key from the list (if it is in the list)
+        if(px_link_list_hash_remove_key(key_press_list, key) != NULL)
         {
-            // Access data of list item
-            key_press = (px_kbd_matrix_key_t *)key_press_item;
-
-            // See if key is in the list
-            if(  (key_press->row == row) && (key_press->col == col)  )
-            {
-                // Remove key from the list
-                px_link_list_remove_item(key_press_list, key_press_item);
-                // Call event handler
-                matrix->on_key_event_handler(row, col, event);
-                break;
-            }
-            // Next item
-            key_press_item = px_link_list_get_item_next(key_press_list, key_press_item);
-        }        
+            // Call event handler
+            matrix->on_key_event_handler(row, col, event);
+        }
     }    
 }
 
@@ -285,7 +276,7 @@ static void px_kbd_matrix_debounce(px_kbd_matrix_t *matrix)
     // Compare with existing status
     kbd_key_state_xor(&(matrix->key_state), &new, &changed);
     // Process each pending event
-    nr_of_keys = matrix->nr_of_rows   matrix->nr_of_columns;
+    nr_of_keys = matrix->nr_of_rows * matrix->nr_of_columns;
     for (i = 0; i < nr_of_keys; i++)
 	{    
         if (kbd_key_state_get(&changed, i))
@@ -411,7 +402,7 @@ static void px_kbd_matrix_sample(px_kbd_matrix_t *matrix)
 
 static void px_kbd_matrix_repeat(px_kbd_matrix_t * matrix)
 {
-    px_link_list_t *      key_press_list = &(matrix->key_press_list);
+    px_link_list_t *      key_press_list = &(matrix->key_press_list.list);
     px_kbd_matrix_key_t * key_press;
 
     // See if a key(s) must be repeated
@@ -470,12 +461,15 @@ void px_kbd_matrix_init(px_kbd_matrix_t *            matrix,
     }
 
     // Initialise linked list
-    px_link_list_init(&(matrix->key_press_list), PX_KBD_MATRIX_MAX_NR_KEYS_PRESSED);
+    px_link_list_hash_init(&(matrix->key_press_list),
+                           matrix->key_press_buckets,
+                           PX_KBD_MATRIX_NR_OF_BUCKETS,
+                           PX_KBD_MATRIX_MAX_NR_KEYS_PRESSED);
 
     // Initialise items used for linked list
     for(i = 0; i < PX_KBD_MATRIX_MAX_NR_KEYS_PRESSED; i++)
     {
-        px_link_list_item_init(&(matrix->key_press_list), &(matrix->key_press_array[i].key_list_item));
+        px_link_list_hash_item_init(&(matrix->key_press_list), &(matrix->key_press_array[i].key_list_item));
         matrix->key_press_array[i].row = 0;
         matrix->key_press_array[i].col = 0;
     }
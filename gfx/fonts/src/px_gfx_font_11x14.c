@@ -3154,7 +3154,8 @@ static const uint8_t px_gfx_font_11x14_data[] =
 
 const px_gfx_font_t px_gfx_font_11x14 =
 {
-    .width  = 12,
-    .height = 15,
-    .data   = px_gfx_font_11x14_data,
+    .width       = 12,
+    .height      = 15,
+    .data        = px_gfx_font_11x14_data,
+    .nr_of_chars = 95,
 };
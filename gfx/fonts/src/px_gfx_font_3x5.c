@@ -904,7 +904,8 @@ static const uint8_t px_gfx_font_3x5_data[] =
 
 const px_gfx_font_t px_gfx_font_3x5 =
 {
-    .width  = 4,
-    .height = 6,
-    .data   = px_gfx_font_3x5_data,
+    .width       = 4,
+    .height      = 6,
+    .data        = px_gfx_font_3x5_data,
+    .nr_of_chars = 59,
 };
@@ -1824,7 +1824,8 @@ static const uint8_t px_gfx_font_5x7_data[] =
 
 const px_gfx_font_t px_gfx_font_5x7 =
 {
-    .width  = 6,
-    .height = 8,
-    .data   = px_gfx_font_5x7_data,
+    .width       = 6,
+    .height      = 8,
+    .data        = px_gfx_font_5x7_data,
+    .nr_of_chars = 95,
 };
@@ -41,6 +41,31 @@
  *  Tool preset file: 
  *  - px_gfx_preset.xml
  *
+ *  If PX_GFX_CFG_SPAN = 1, fills, horizontal and vertical lines and images
+ *  (and therefore text) are clipped once to the view port and display and then
+ *  handed to the display driver as a rectangle (px_gfx_disp_buf_fill() and
+ *  px_gfx_disp_buf_img()). The driver writes whole frame buffer bytes, with a
+ *  mask for a partial first and last byte, instead of doing a bounds check and
+ *  read-modify-write for each pixel. Diagonal lines, circles and single pixels
+ *  are still drawn pixel by pixel.
+ *
+ *  Font data is a list of glyphs, each a character code followed by the glyph
+ *  image, terminated by a zero character code. The font template sets
+ *  px_gfx_font_t::nr_of_chars to the number of glyphs. If the glyphs are
+ *  consecutive (e.g. ' ' to '~'), px_gfx_draw_char() finds a glyph by
+ *  indexing instead of walking the list from the start. Fonts with gaps or
+ *  with nr_of_chars = 0 (font data generated with an older template) are
+ *  searched linearly, as before.
+ *
+ *  Changed areas of the frame buffer are tracked as a small set of rectangles
+ *  (up to PX_GFX_CFG_UPDATE_AREAS), so that px_gfx_draw_update() only sends
+ *  those parts to the display. A new area is merged with an existing one when
+ *  the merged rectangle is not larger than the two separate ones. When all
+ *  slots are used, the two areas that grow the least when merged are combined.
+ *  Areas are aligned to PX_GFX_CFG_UPDATE_ALIGN_Y rows (8 for a page organised
+ *  display), because that is the unit that the display driver sends.
+ *  px_gfx_update_stats_get() reports the number of bytes sent to the display.
+ *
  *  @{
  */
 
@@ -59,6 +84,18 @@
      || !defined(PX_GFX_CFG_DEFAULT_FONT   )  )
 #error "One or more options not defined in 'px_gfx_cfg.h'"
 #endif
+#ifndef PX_GFX_CFG_SPAN
+/// Draw fills, lines and images with spans of whole frame buffer bytes (1) or pixel by pixel (0)
+#define PX_GFX_CFG_SPAN 1
+#endif
+#ifndef PX_GFX_CFG_UPDATE_AREAS
+/// Maximum number of changed areas tracked (1 = one bounding rectangle)
+#define PX_GFX_CFG_UPDATE_AREAS 4
+#endif
+#ifndef PX_GFX_CFG_UPDATE_ALIGN_Y
+/// Align changed areas to this number of rows (8 for a page organised display)
+#define PX_GFX_CFG_UPDATE_ALIGN_Y 8
+#endif
 
 #ifdef __cplusplus
 extern "C"
@@ -125,6 +162,7 @@ typedef struct
     px_gfx_xy_t     width;
     px_gfx_xy_t     height;
     const uint8_t * data;
+    uint16_t        nr_of_chars;    ///< Number of glyphs in data; 0 if unknown (linear search)
 } px_gfx_font_t;
 
 /// Area definition
@@ -153,6 +191,15 @@ typedef struct
     px_gfx_xy_ref_t xy_ref;     ///< Coordinate reference
 } px_gfx_view_port_t;
 
+/// Display update statistics
+typedef struct
+{
+    uint32_t nr_of_updates;     ///< Number of display updates (px_gfx_draw() and px_gfx_draw_update())
+    uint32_t nr_of_areas;       ///< Number of areas sent to display
+    uint32_t nr_of_bytes;       ///< Number of bytes sent to display
+    uint32_t nr_of_bytes_last;  ///< Number of bytes sent to display during last update
+} px_gfx_update_stats_t;
+
 /* _____GLOBAL VARIABLES_____________________________________________________ */
 
 /* _____GLOBAL FUNCTION DECLARATIONS_________________________________________ */
@@ -172,7 +219,7 @@ void px_gfx_buf_clear(void);
 void px_gfx_draw(void);
 
 /**
- *  Update display with total area that has changed in display buffer.
+ *  Update display with areas that have changed in display buffer.
  */
 void px_gfx_draw_update(void);
 
@@ -180,12 +227,25 @@ void px_gfx_draw_update(void);
  *  Get total area of frame that has changed.
  *  
  *  @param area     Pointer to structure to contain area that has changed
+ *                  (bounding rectangle of all changed areas)
  *  
  *  @retval true    frame buffer has changed
  *  @retval false   frame buffer has stayed the same (no change)
  */
 bool px_gfx_update_area_get(px_gfx_area_t * area);
 
+/**
+ *  Get display update statistics.
+ *
+ *  @return const px_gfx_update_stats_t *  Pointer to statistics
+ */
+const px_gfx_update_stats_t * px_gfx_update_stats_get(void);
+
+/**
+ *  Reset display update statistics.
+ */
+void px_gfx_update_stats_reset(void);
+
 /**
  *  Reset drawing properties to default.
  */
@@ -245,6 +305,51 @@ void px_gfx_view_port_set(px_gfx_xy_t     x,
  */
 void px_gfx_view_port_reset(void);
 
+/**
+ *  Get absolute area of a rectangle.
+ *  
+ *  The coordinates are adjusted for the view port. The area is not clipped.
+ *  
+ *  @param x        Top left X coordinate
+ *  @param y        Top left Y coordinate
+ *  @param width    Width
+ *  @param height   Height
+ *  @param area     Pointer to structure to contain area
+ */
+void px_gfx_area_get(px_gfx_xy_t     x,
+                     px_gfx_xy_t     y,
+                     px_gfx_xy_t     width,
+                     px_gfx_xy_t     height,
+                     px_gfx_area_t * area);
+
+/**
+ *  Set clip area.
+ *  
+ *  All drawing (and the update areas it generates) is restricted to the clip
+ *  area. Coordinates are absolute (not relative to the view port) and are
+ *  clipped to the display area.
+ *  
+ *  @param area     Pointer to clip area
+ *  
+ *  @retval true    Clip area is not empty
+ *  @retval false   Clip area lies outside display (nothing will be drawn)
+ */
+bool px_gfx_clip_set(const px_gfx_area_t * area);
+
+/**
+ *  Get clip area.
+ *  
+ *  @param area     Pointer to structure to contain clip area
+ */
+void px_gfx_clip_get(px_gfx_area_t * area);
+
+/**
+ *  Reset clip area.
+ *  
+ *  The clip area is set to the whole display.
+ */
+void px_gfx_clip_reset(void);
+
 /**
  *  Set the new font.
  *  
@@ -381,6 +486,44 @@ void px_gfx_draw_str(px_gfx_xy_t  x,
                      px_gfx_xy_t  y,
                      const char * str);
 
+/**
+ *  Get area that a font string would occupy if drawn with px_gfx_draw_str().
+ *  
+ *  The current font and alignment are used. The returned area is absolute
+ *  (adjusted for the view port) and is not clipped.
+ *  
+ *  @param x        X coordinate of starting point of string
+ *  @param y        Y coordinate of starting point of string
+ *  @param str      String
+ *  @param area     Pointer to structure to contain area
+ *  
+ *  @retval true    Area is valid
+ *  @retval false   Empty string (no area)
+ */
+bool px_gfx_str_area_get(px_gfx_xy_t     x,
+                         px_gfx_xy_t     y,
+                         const char *    str,
+                         px_gfx_area_t * area);
+
+/**
+ *  Scroll (move) pixels in an area left.
+ *  
+ *  The pixels in the leftmost nr_of_cols columns are discarded and the
+ *  rightmost nr_of_cols columns are left unchanged, to be redrawn by the
+ *  caller.
+ *  
+ *  @param x            X coordinate of left of area
+ *  @param y            Y coordinate of top of area
+ *  @param width        Width of area
+ *  @param height       Height of area
+ *  @param nr_of_cols   Number of columns to scroll left
+ */
+void px_gfx_scroll_left(px_gfx_xy_t x,
+                        px_gfx_xy_t y,
+                        px_gfx_xy_t width,
+                        px_gfx_xy_t height,
+                        px_gfx_xy_t nr_of_cols);
+
 /**
  *  Draw a formatted font string using the current foreground color.
  *  
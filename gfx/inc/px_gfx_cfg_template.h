@@ -35,6 +35,29 @@
 /// Default font
 #define PX_GFX_CFG_DEFAULT_FONT     px_gfx_font_5x7
 
+/**
+ *  Draw fills, horizontal and vertical lines and images by writing whole frame
+ *  buffer bytes (1) or pixel by pixel (0).
+ *
+ *  The display driver must implement px_gfx_disp_buf_fill() and
+ *  px_gfx_disp_buf_img() if enabled.
+ */
+#define PX_GFX_CFG_SPAN             1
+
+/**
+ *  Maximum number of changed areas that are tracked and sent to the display by
+ *  px_gfx_draw_update(). 1 = one rectangle that contains all changes.
+ */
+#define PX_GFX_CFG_UPDATE_AREAS     4
+
+/**
+ *  Align changed areas to this number of rows.
+ *
+ *  Set to 8 for a page organised display (e.g. ST7567), where a page of 8 rows
+ *  is the smallest unit that is sent, otherwise 1.
+ */
+#define PX_GFX_CFG_UPDATE_ALIGN_Y   8
+
 /* _____DEFINITIONS__________________________________________________________ */
 
 #endif
@@ -45,7 +45,19 @@ void px_gfx_disp_buf_clear     (void);
 void px_gfx_disp_buf_pixel     (px_gfx_xy_t    x,
                                 px_gfx_xy_t    y,
                                 px_gfx_color_t color);
-void px_gfx_disp_update        (const px_gfx_area_t * area);
+#if PX_GFX_CFG_SPAN
+void px_gfx_disp_buf_fill      (const px_gfx_area_t * area,
+                                px_gfx_color_t        color);
+void px_gfx_disp_buf_img       (const px_gfx_area_t * area,
+                                px_gfx_xy_t           x,
+                                px_gfx_xy_t           y,
+                                const px_gfx_img_t *  img,
+                                px_gfx_color_t        color_fg,
+                                px_gfx_color_t        color_bg);
+#endif
+void px_gfx_disp_buf_scroll_left(const px_gfx_area_t * area,
+                                 px_gfx_xy_t           nr_of_cols);
+size_t px_gfx_disp_update      (const px_gfx_area_t * area);
 void px_gfx_disp_log_report_buf(void);
 
 /* _____MACROS_______________________________________________________________ */
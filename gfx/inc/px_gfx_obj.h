@@ -24,6 +24,29 @@
  *  
  *  Graphical object layer on primitive drawing layer.
  *  
+ *  Objects form a retained tree: each object has a parent and an optional list
+ *  of children that are drawn on top of it (in list order). A child is clipped
+ *  to the area of its parent. Object coordinates are relative to the view port
+ *  of the closest parent with the view_port flag set (e.g. a window) or
+ *  absolute if there is none. Areas (PX_GFX_OBJ_EVENT_AREA) are reported in
+ *  absolute coordinates, for example with px_gfx_area_get() or
+ *  px_gfx_str_area_get().
+ *  
+ *  px_gfx_obj_update_set() marks an object as updated. The area that the
+ *  object occupied when it was last drawn and the area that it occupies now
+ *  (PX_GFX_OBJ_EVENT_AREA) form the invalidated (damaged) area of the object.
+ *  px_gfx_obj_draw() only repairs damaged areas of the tree:
+ *  - If an updated object is opaque and covers its damaged area, only the
+ *    object itself (and any object overlapping it) is redrawn.
+ *  - Otherwise the whole tree is redrawn, clipped to the damaged area.
+ *  - A damaged area that is covered by an opaque object higher in the list of
+ *    siblings is skipped (the object is hidden).
+ *  
+ *  If the whole object is redrawn and nothing is drawn on top of it, it
+ *  receives PX_GFX_OBJ_EVENT_DRAW_UPDATE instead of PX_GFX_OBJ_EVENT_DRAW. The
+ *  object may then reuse the pixels it drew previously (see
+ *  px_gfx_obj_graph_scroll()).
+ *  
  *  File(s):
  *  - gfx/inc/px_gfx_obj.h 
  *  - gfx/src/px_gfx_obj.c
@@ -60,7 +83,9 @@ typedef enum
  */
 typedef enum
 {
-    PX_GFX_OBJ_EVENT_DRAW,
+    PX_GFX_OBJ_EVENT_DRAW,          ///< Draw object (view port and clip area have been set)
+    PX_GFX_OBJ_EVENT_DRAW_UPDATE,   ///< Draw object; previously drawn pixels are intact and may be reused
+    PX_GFX_OBJ_EVENT_AREA,          ///< Report absolute area occupied by object (data = px_gfx_area_t *) and set opaque flag (view port has been set)
 } px_gfx_obj_event_t;
 
 /** 
@@ -85,7 +110,14 @@ typedef struct px_gfx_obj_s
     px_gfx_obj_type_t          obj_type;        ///< Object type
     bool                       visible;         ///< Flag to indicate if object is visible
     bool                       update;          ///< Flag to indicate if object has been updated and must be drawn
+    bool                       update_child;    ///< Flag to indicate if a child (or its child) has been updated
+    bool                       opaque;          ///< Flag to indicate if object covers every pixel of its area
+    bool                       view_port;       ///< Flag to indicate if child coordinates are relative to object area
+    px_gfx_area_t              area;            ///< Area occupied by object when it was last drawn
+    px_gfx_area_t              inval;           ///< Area that must be redrawn (invalidated)
     px_gfx_obj_event_handler_t event_handler;   ///< Object event handler function
+    struct px_gfx_obj_s *      obj_parent;      ///< Pointer to parent object
+    struct px_gfx_obj_s *      obj_child_first; ///< Pointer to first object in child linked list
     struct px_gfx_obj_s *      obj_next;        ///< Pointer to next object in linked list
 } px_gfx_obj_t;
 
@@ -102,6 +134,9 @@ void           px_gfx_obj_visible_set (px_gfx_obj_handle_t  obj, bool flag);
 bool           px_gfx_obj_update_get  (px_gfx_obj_handle_t  obj);
 void           px_gfx_obj_update_set  (px_gfx_obj_handle_t  obj,  bool flag);
 
+void           px_gfx_obj_add_child   (px_gfx_obj_handle_t  obj_parent,
+                                       px_gfx_obj_handle_t  obj_child);
+
 void           px_gfx_obj_draw        (px_gfx_obj_handle_t  obj);
 
 /* _____MACROS_______________________________________________________________ */
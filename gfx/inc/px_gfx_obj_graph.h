@@ -24,6 +24,14 @@
  *  
  *  Graphical graph object.
  *  
+ *  A graph that scrolls can be redrawn incrementally: move the Y data left,
+ *  append the new samples and call px_gfx_obj_graph_scroll() with the number of
+ *  samples appended. When the graph is drawn the existing pixels are moved left
+ *  and only the new columns are drawn. The graph is redrawn completely if
+ *  another object is drawn on top of it or if it was partly redrawn in the
+ *  mean time. Other samples must not be changed while a scroll is pending; use
+ *  px_gfx_obj_graph_prop_set() to force a complete redraw.
+ *  
  *  File(s):
  *  - gfx/inc/px_gfx_obj_graph.h 
  *  - gfx/src/px_gfx_obj_graph.c
@@ -60,8 +68,10 @@ typedef struct
 /// Label object data structure
 typedef struct
 {
-    px_gfx_obj_t                    obj;    ///< Common object properties
-    const px_gfx_obj_graph_prop_t * prop;   ///< Additional graph properties
+    px_gfx_obj_t                    obj;            ///< Common object properties
+    const px_gfx_obj_graph_prop_t * prop;           ///< Additional graph properties
+    px_gfx_xy_t                     scroll_cols;    ///< Number of columns scrolled since graph was drawn
+    bool                            redraw_full;    ///< Flag to indicate that graph must be redrawn completely
 } px_gfx_obj_graph_t;
 
 /* _____GLOBAL VARIABLES_____________________________________________________ */
@@ -71,6 +81,8 @@ px_gfx_obj_handle_t             px_gfx_obj_graph_create  (const px_gfx_obj_graph
 const px_gfx_obj_graph_prop_t * px_gfx_obj_graph_prop_get(const px_gfx_obj_handle_t       obj);
 void                            px_gfx_obj_graph_prop_set(px_gfx_obj_handle_t             obj,
                                                           const px_gfx_obj_graph_prop_t * prop);
+void                            px_gfx_obj_graph_scroll  (px_gfx_obj_handle_t             obj,
+                                                          px_gfx_xy_t                     nr_of_samples);
 
 /* _____MACROS_______________________________________________________________ */
 
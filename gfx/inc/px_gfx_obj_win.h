@@ -22,6 +22,10 @@
  *  @ingroup GFX
  *  @defgroup PX_GFX_OBJ_WINDOW px_gfx_obj_win.h : Graphical window object
  *  
+ *  Graphical window object. The window area is the view port of its child
+ *  objects: child coordinates are relative to the top left corner of the
+ *  window and children are clipped to the window area.
+ *  
  *  File(s):
  *  - gfx/inc/px_gfx_obj_win.h 
  *  - gfx/src/px_gfx_obj_win.c
@@ -58,7 +62,6 @@ typedef struct
 {
     px_gfx_obj_t                  obj;          ///< Common object properties
     const px_gfx_obj_win_prop_t * prop;         ///< Additional window properties
-    px_gfx_obj_t *                obj_first;    ///< Pointer to first object in child linked list
 } px_gfx_obj_win_t;
 
 /* _____GLOBAL VARIABLES_____________________________________________________ */
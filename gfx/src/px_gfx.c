@@ -19,6 +19,7 @@
 /* _____STANDARD INCLUDES____________________________________________________ */
 #include <string.h>
 #include <stdarg.h>
+#include <stdio.h>
 
 /* _____PROJECT INCLUDES_____________________________________________________ */
 #include "px_gfx.h"
@@ -44,7 +45,10 @@ typedef struct
 typedef struct
 {
     px_gfx_draw_prop_t      draw_prop;
-    px_gfx_area_t           update_area;    ///< Area of frame to be updated
+    px_gfx_area_t           update_area[PX_GFX_CFG_UPDATE_AREAS];   ///< Areas of frame to be updated
+    uint8_t                 nr_of_update_areas;                     ///< Number of areas to be updated
+    px_gfx_update_stats_t   update_stats;                           ///< Display update statistics
+    px_gfx_area_t           clip;                                   ///< Clip area (absolute)
 } px_gfx_t;
 
 /* _____MACROS_______________________________________________________________ */
@@ -73,20 +77,27 @@ static const px_gfx_draw_prop_t px_gfx_draw_prop_default =
     .font       = &PX_GFX_CFG_DEFAULT_FONT,
 };
 
+/// Display area
+static const px_gfx_area_t px_gfx_area_disp =
+{
+    .x1 = PX_GFX_X_MIN,
+    .y1 = PX_GFX_Y_MIN,
+    .x2 = PX_GFX_X_MAX,
+    .y2 = PX_GFX_Y_MAX,
+};
+
 /* _____LOCAL FUNCTION DECLARATIONS__________________________________________ */
+static void px_gfx_update_area_add(const px_gfx_area_t * area_new);
 
 /* _____LOCAL FUNCTIONS______________________________________________________ */
 static void px_gfx_update_area_reset(void)
 {
-    px_gfx.update_area.x1 = PX_GFX_X_MAX + 1;
-    px_gfx.update_area.x2 = PX_GFX_X_MIN - 1;
-    px_gfx.update_area.y1 = PX_GFX_Y_MAX + 1;
-    px_gfx.update_area.y2 = PX_GFX_Y_MIN - 1;
+    px_gfx.nr_of_update_areas = 0;
 }
 
 static bool px_gfx_update_area_is_set(void)
 {
-    if(px_gfx.update_area.x1 <= PX_GFX_X_MAX)
+    if(px_gfx.nr_of_update_areas != 0)
     {
         return true;
     }
@@ -96,29 +107,158 @@ static bool px_gfx_update_area_is_set(void)
     }
 }
 
+/// Return cost of updating area (number of pixels)
+static int32_t px_gfx_update_area_cost(const px_gfx_area_t * area)
+{
+    return (int32_t)(area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1);
+}
+
+/// Merge area b into area a
+static void px_gfx_update_area_merge(px_gfx_area_t * a, const px_gfx_area_t * b)
+{
+    if(a->x1 > b->x1) a->x1 = b->x1;
+    if(a->x2 < b->x2) a->x2 = b->x2;
+    if(a->y1 > b->y1) a->y1 = b->y1;
+    if(a->y2 < b->y2) a->y2 = b->y2;
+}
+
+/// Return extra cost of merging two areas instead of updating them separately
+static int32_t px_gfx_update_area_merge_cost(const px_gfx_area_t * a, const px_gfx_area_t * b)
+{
+    px_gfx_area_t area = *a;
+
+    px_gfx_update_area_merge(&area, b);
+
+    return   px_gfx_update_area_cost(&area)
+           - px_gfx_update_area_cost(a)
+           - px_gfx_update_area_cost(b);
+}
+
+/// Remove area from list of areas to be updated
+static void px_gfx_update_area_remove(uint8_t i)
+{
+    px_gfx.nr_of_update_areas--;
+    px_gfx.update_area[i] = px_gfx.update_area[px_gfx.nr_of_update_areas];
+}
+
 static void px_gfx_update_area(px_gfx_xy_t x1,
                                px_gfx_xy_t y1,
                                px_gfx_xy_t x2,
                                px_gfx_xy_t y2)
 {
+    px_gfx_area_t area;
+
     // Swap coordinates if required
     if(x1 > x2) PX_SWAP(px_gfx_xy_t, x1, x2);
     if(y1 > y2) PX_SWAP(px_gfx_xy_t, y1, y2);
-    // Outside display area?
-    if((x1 < PX_GFX_X_MIN) && (x2 < PX_GFX_X_MIN)) return;
-    if((x1 > PX_GFX_X_MAX) && (x2 > PX_GFX_X_MAX)) return;
-    if((y1 < PX_GFX_Y_MIN) && (y2 < PX_GFX_Y_MIN)) return;
-    if((y1 > PX_GFX_Y_MAX) && (y2 > PX_GFX_Y_MAX)) return;
-    // Clip to display if required
-    if(x1 < PX_GFX_X_MIN) x1 = PX_GFX_X_MIN;
-    if(x2 > PX_GFX_X_MAX) x2 = PX_GFX_X_MAX;
-    if(y1 < PX_GFX_Y_MIN) y1 = PX_GFX_Y_MIN;
+    // Outside clip area?
+    if((x1 < px_gfx.clip.x1) && (x2 < px_gfx.clip.x1)) return;
+    if((x1 > px_gfx.clip.x2) && (x2 > px_gfx.clip.x2)) return;
+    if((y1 < px_gfx.clip.y1) && (y2 < px_gfx.clip.y1)) return;
+    if((y1 > px_gfx.clip.y2) && (y2 > px_gfx.clip.y2)) return;
+    // Clip if required
+    if(x1 < px_gfx.clip.x1) x1 = px_gfx.clip.x1;
+    if(x2 > px_gfx.clip.x2) x2 = px_gfx.clip.x2;
+    if(y1 < px_gfx.clip.y1) y1 = px_gfx.clip.y1;
+    if(y2 > px_gfx.clip.y2) y2 = px_gfx.clip.y2;
+    // Empty clip area?
+    if((x1 > x2) || (y1 > y2)) return;
+    // Align rows to unit that display driver sends
+    y1 -= y1 % PX_GFX_CFG_UPDATE_ALIGN_Y;
+    y2 += (PX_GFX_CFG_UPDATE_ALIGN_Y - 1) - (y2 % PX_GFX_CFG_UPDATE_ALIGN_Y);
     if(y2 > PX_GFX_Y_MAX) y2 = PX_GFX_Y_MAX;
-    // Update area
-    if(px_gfx.update_area.x1 > x1)  px_gfx.update_area.x1 = x1;
-    if(px_gfx.update_area.x2 < x2)  px_gfx.update_area.x2 = x2;
-    if(px_gfx.update_area.y1 > y1)  px_gfx.update_area.y1 = y1;
-    if(px_gfx.update_area.y2 < y2)  px_gfx.update_area.y2 = y2;
+    area.x1 = x1;
+    area.y1 = y1;
+    area.x2 = x2;
+    area.y2 = y2;
+    px_gfx_update_area_add(&area);
+}
+
+/// Add (clipped and aligned) area to list of areas to be updated
+static void px_gfx_update_area_add(const px_gfx_area_t * area_new)
+{
+    px_gfx_area_t area = *area_new;
+    uint8_t       i;
+    uint8_t       j;
+    uint8_t       i_min;
+    uint8_t       j_min;
+    int32_t       cost;
+    int32_t       cost_min;
+
+    // Merge with existing areas if it is not more expensive than separate updates
+    i = 0;
+    while(i < px_gfx.nr_of_update_areas)
+    {
+        if(px_gfx_update_area_merge_cost(&area, &px_gfx.update_area[i]) <= 0)
+        {
+            // Merge, remove existing area and check all areas again
+            px_gfx_update_area_merge(&area, &px_gfx.update_area[i]);
+            px_gfx_update_area_remove(i);
+            i = 0;
+        }
+        else
+        {
+            i++;
+        }
+    }
+    // Free slot?
+    if(px_gfx.nr_of_update_areas < PX_GFX_CFG_UPDATE_AREAS)
+    {
+        px_gfx.update_area[px_gfx.nr_of_update_areas++] = area;
+        return;
+    }
+    // Find the pair of areas (new area is last) that is the cheapest to merge
+    i_min    = 0;
+    j_min    = PX_GFX_CFG_UPDATE_AREAS;
+    cost_min = px_gfx_update_area_merge_cost(&px_gfx.update_area[0], &area);
+    for(i = 0; i < PX_GFX_CFG_UPDATE_AREAS; i++)
+    {
+        for(j = i + 1; j <= PX_GFX_CFG_UPDATE_AREAS; j++)
+        {
+            if(j == PX_GFX_CFG_UPDATE_AREAS)
+            {
+                cost = px_gfx_update_area_merge_cost(&px_gfx.update_area[i], &area);
+            }
+            else
+            {
+                cost = px_gfx_update_area_merge_cost(&px_gfx.update_area[i], &px_gfx.update_area[j]);
+            }
+            if(cost < cost_min)
+            {
+                cost_min = cost;
+                i_min    = i;
+                j_min    = j;
+            }
+        }
+    }
+    if(j_min == PX_GFX_CFG_UPDATE_AREAS)
+    {
+        // Merge new area into existing area
+        px_gfx_update_area_merge(&px_gfx.update_area[i_min], &area);
+    }
+    else
+    {
+        // Merge two existing areas and add new area in free slot
+        px_gfx_update_area_merge(&px_gfx.update_area[i_min], &px_gfx.update_area[j_min]);
+        px_gfx.update_area[j_min] = area;
+    }
+}
+
+/// Send areas that have changed to display and update statistics
+static void px_gfx_update_areas_send(void)
+{
+    uint8_t i;
+    size_t  nr_of_bytes = 0;
+
+    for(i = 0; i < px_gfx.nr_of_update_areas; i++)
+    {
+        nr_of_bytes += px_gfx_disp_update(&px_gfx.update_area[i]);
+    }
+    px_gfx.update_stats.nr_of_updates++;
+    px_gfx.update_stats.nr_of_areas     += px_gfx.nr_of_update_areas;
+    px_gfx.update_stats.nr_of_bytes     += nr_of_bytes;
+    px_gfx.update_stats.nr_of_bytes_last = nr_of_bytes;
+    px_gfx_update_area_reset();
 }
 
 static px_gfx_xy_t px_gfx_vp_adjust_x(px_gfx_xy_t x)
@@ -160,11 +300,11 @@ static void px_gfx_vp_draw_pixel(px_gfx_xy_t x, px_gfx_xy_t y, px_gfx_color_t co
             return;
         }
     }
-    // X and Y coordinate inside display area?
-    if(  (x < PX_GFX_X_MIN) 
-       ||(x > PX_GFX_X_MAX)
-       ||(y < PX_GFX_Y_MIN)
-       ||(y > PX_GFX_Y_MAX)  )
+    // X and Y coordinate inside clip area (inside display area)?
+    if(  (x < px_gfx.clip.x1)
+       ||(x > px_gfx.clip.x2)
+       ||(y < px_gfx.clip.y1)
+       ||(y > px_gfx.clip.y2)  )
     {
         // No
         return;
@@ -173,43 +313,193 @@ static void px_gfx_vp_draw_pixel(px_gfx_xy_t x, px_gfx_xy_t y, px_gfx_color_t co
     px_gfx_disp_buf_pixel(x, y, color);
 }
 
+/// Clip area to view port and clip area (display); return false if nothing is left
+static bool px_gfx_vp_clip(px_gfx_area_t * area)
+{
+    // View port active?
+    if(px_gfx.draw_prop.vp_active)
+    {
+        // Clip to view port
+        if(area->x1 < px_gfx.draw_prop.vp.x)
+        {
+            area->x1 = px_gfx.draw_prop.vp.x;
+        }
+        if(area->x2 > px_gfx.draw_prop.vp.x + px_gfx.draw_prop.vp.width - 1)
+        {
+            area->x2 = px_gfx.draw_prop.vp.x + px_gfx.draw_prop.vp.width - 1;
+        }
+        if(area->y1 < px_gfx.draw_prop.vp.y)
+        {
+            area->y1 = px_gfx.draw_prop.vp.y;
+        }
+        if(area->y2 > px_gfx.draw_prop.vp.y + px_gfx.draw_prop.vp.height - 1)
+        {
+            area->y2 = px_gfx.draw_prop.vp.y + px_gfx.draw_prop.vp.height - 1;
+        }
+    }
+    // Clip to clip area (inside display area)
+    if(area->x1 < px_gfx.clip.x1) area->x1 = px_gfx.clip.x1;
+    if(area->x2 > px_gfx.clip.x2) area->x2 = px_gfx.clip.x2;
+    if(area->y1 < px_gfx.clip.y1) area->y1 = px_gfx.clip.y1;
+    if(area->y2 > px_gfx.clip.y2) area->y2 = px_gfx.clip.y2;
+    // Anything left?
+    return (area->x1 <= area->x2) && (area->y1 <= area->y2);
+}
+
+static void px_gfx_vp_draw_fill(px_gfx_xy_t    x,
+                                px_gfx_xy_t    y,
+                                px_gfx_xy_t    width,
+                                px_gfx_xy_t    height,
+                                px_gfx_color_t color)
+{
+#if PX_GFX_CFG_SPAN
+    px_gfx_area_t area;
+
+    // Clip once and fill whole frame buffer bytes
+    area.x1 = x;
+    area.y1 = y;
+    area.x2 = x + width - 1;
+    area.y2 = y + height - 1;
+    if(px_gfx_vp_clip(&area))
+    {
+        px_gfx_disp_buf_fill(&area, color);
+    }
+#else
+    px_gfx_xy_t i, j;
+
+    for(j = y; j < y + height; j++)
+    {
+        for(i = x; i < x + width; i++)
+        {
+            px_gfx_vp_draw_pixel(i, j, color);
+        }
+    }
+#endif
+}
+
+static void px_gfx_vp_draw_img(px_gfx_xy_t x, px_gfx_xy_t y, const px_gfx_img_t * img)
+{
+#if PX_GFX_CFG_SPAN
+    px_gfx_area_t area;
+
+    // Clip once and draw whole frame buffer bytes
+    area.x1 = x;
+    area.y1 = y;
+    area.x2 = x + img->width - 1;
+    area.y2 = y + img->height - 1;
+    if(px_gfx_vp_clip(&area))
+    {
+        px_gfx_disp_buf_img(&area, x, y, img,
+                            px_gfx.draw_prop.color_fg,
+                            px_gfx.draw_prop.color_bg);
+    }
+#else
+    px_gfx_xy_t     i;
+    px_gfx_xy_t     j;
+    uint8_t         mask;
+    const uint8_t * data = img->data;
+
+    // Repeat for each row
+    for(j = 0; j < img->height; j++)
+    {
+        // Start at most significant bit
+        mask = 1<<7;
+        // Repeat for each pixel in row
+        for(i = 0; i < img->width; i++)
+        {
+            if(*data & mask)
+            {
+                // Foreground color pixel
+                px_gfx_vp_draw_pixel(x + i, y + j, px_gfx.draw_prop.color_fg);
+            }
+            else
+            {
+                // Does pixel need to be drawn?
+                if(px_gfx.draw_prop.color_bg != PX_GFX_COLOR_TRANSPARENT)
+                {
+                    // Background color pixel
+                    px_gfx_vp_draw_pixel(x + i, y + j, px_gfx.draw_prop.color_bg);
+                }                
+            }
+            // Next bit
+            mask >>= 1;
+            // Finished with byte?
+            if(mask == 0x00)
+            {
+                // Next byte
+                data++;
+                // Start again at most significant bit
+                mask = 1<<7;
+            }
+        }
+        // Ended on 8-bit boundary?
+        if(mask != (1 << 7))
+        {
+            // No. Ignore rest of bits in byte
+            data++;
+        }
+    }   
+#endif
+}
+
 /* _____GLOBAL FUNCTIONS_____________________________________________________ */
 void px_gfx_init(void)
 {
 	px_gfx_draw_prop_reset();
+    px_gfx_clip_reset();
+    px_gfx_update_stats_reset();
     px_gfx_buf_clear();
 }
 
 void px_gfx_buf_clear(void)
 {
     px_gfx_update_area_reset();
-    px_gfx_update_area(0, 0, PX_GFX_X_MAX, PX_GFX_DISP_SIZE_Y);
+    px_gfx_update_area_add(&px_gfx_area_disp);
     px_gfx_disp_buf_clear();
 }
 
 void px_gfx_draw(void)
 {
-    px_gfx_update_area(0, 0, PX_GFX_X_MAX, PX_GFX_DISP_SIZE_Y);
-    px_gfx_disp_update(&px_gfx.update_area);
     px_gfx_update_area_reset();
+    px_gfx_update_area_add(&px_gfx_area_disp);
+    px_gfx_update_areas_send();
 }
 
 void px_gfx_draw_update(void)
 {
     if(px_gfx_update_area_is_set())
     {
-        px_gfx_disp_update(&px_gfx.update_area);
-        px_gfx_update_area_reset();
+        px_gfx_update_areas_send();
     }
 }
 
 bool px_gfx_update_area_get(px_gfx_area_t * area)
 {
-    memcpy(area, &px_gfx.update_area, sizeof(px_gfx_area_t));
+    uint8_t i;
+
+    // Return bounding rectangle of all areas
+    area->x1 = PX_GFX_X_MAX + 1;
+    area->x2 = PX_GFX_X_MIN - 1;
+    area->y1 = PX_GFX_Y_MAX + 1;
+    area->y2 = PX_GFX_Y_MIN - 1;
+    for(i = 0; i < px_gfx.nr_of_update_areas; i++)
+    {
+        px_gfx_update_area_merge(area, &px_gfx.update_area[i]);
+    }
 
     return px_gfx_update_area_is_set();
 }
 
+const px_gfx_update_stats_t * px_gfx_update_stats_get(void)
+{
+    return &px_gfx.update_stats;
+}
+
+void px_gfx_update_stats_reset(void)
+{
+    memset(&px_gfx.update_stats, 0, sizeof(px_gfx.update_stats));
+}
+
 void px_gfx_draw_prop_reset(void)
 {
     memcpy(&px_gfx.draw_prop, &px_gfx_draw_prop_default, sizeof(px_gfx.draw_prop));
@@ -255,6 +545,41 @@ void px_gfx_view_port_reset(void)
 	px_gfx.draw_prop.vp_active = false;
 }
 
+void px_gfx_area_get(px_gfx_xy_t     x,
+                     px_gfx_xy_t     y,
+                     px_gfx_xy_t     width,
+                     px_gfx_xy_t     height,
+                     px_gfx_area_t * area)
+{
+    // Adjust coordinates relative to viewport
+    area->x1 = px_gfx_vp_adjust_x(x);
+    area->y1 = px_gfx_vp_adjust_y(y);
+    area->x2 = area->x1 + width  - 1;
+    area->y2 = area->y1 + height - 1;
+}
+
+bool px_gfx_clip_set(const px_gfx_area_t * area)
+{
+    // Clip to display area
+    px_gfx.clip = *area;
+    if(px_gfx.clip.x1 < PX_GFX_X_MIN) px_gfx.clip.x1 = PX_GFX_X_MIN;
+    if(px_gfx.clip.x2 > PX_GFX_X_MAX) px_gfx.clip.x2 = PX_GFX_X_MAX;
+    if(px_gfx.clip.y1 < PX_GFX_Y_MIN) px_gfx.clip.y1 = PX_GFX_Y_MIN;
+    if(px_gfx.clip.y2 > PX_GFX_Y_MAX) px_gfx.clip.y2 = PX_GFX_Y_MAX;
+
+    return (px_gfx.clip.x1 <= px_gfx.clip.x2) && (px_gfx.clip.y1 <= px_gfx.clip.y2);
+}
+
+void px_gfx_clip_get(px_gfx_area_t * area)
+{
+    *area = px_gfx.clip;
+}
+
+void px_gfx_clip_reset(void)
+{
+    px_gfx.clip = px_gfx_area_disp;
+}
+
 const px_gfx_font_t * px_gfx_font_set(const px_gfx_font_t * font)
 {
     const px_gfx_font_t * old = px_gfx.draw_prop.font;
@@ -403,36 +728,24 @@ void px_gfx_draw_line(px_gfx_xy_t x1, px_gfx_xy_t y1, px_gfx_xy_t x2, px_gfx_xy_
 
 void px_gfx_draw_line_hor(px_gfx_xy_t x, px_gfx_xy_t y, px_gfx_xy_t width)
 {
-    px_gfx_xy_t i;
-
     // Adjust coordinates relative to viewport
     x = px_gfx_vp_adjust_x(x);
     y = px_gfx_vp_adjust_y(y);
     // Update dirty area
     px_gfx_update_area(x, y, x + width - 1, y);
     // Draw horizontal line
-    for(i = 0; i < width; i++)
-    {
-        px_gfx_vp_draw_pixel(x, y, px_gfx.draw_prop.color_fg);
-        x++;
-    }
+    px_gfx_vp_draw_fill(x, y, width, 1, px_gfx.draw_prop.color_fg);
 }
 
 void px_gfx_draw_line_ver(px_gfx_xy_t x, px_gfx_xy_t y, px_gfx_xy_t height)
 {
-    px_gfx_xy_t j;
-
     // Adjust coordinates relative to viewport
     x = px_gfx_vp_adjust_x(x);
     y = px_gfx_vp_adjust_y(y);
     // Update dirty area
     px_gfx_update_area(x, y, x, y + height - 1);
     // Draw vertical line
-    for(j = 0; j < height; j++)
-    {
-        px_gfx_vp_draw_pixel(x, y, px_gfx.draw_prop.color_fg);
-        y++;
-    }
+    px_gfx_vp_draw_fill(x, y, 1, height, px_gfx.draw_prop.color_fg);
 }
 
 void px_gfx_draw_rect(px_gfx_xy_t x, px_gfx_xy_t y, px_gfx_xy_t width, px_gfx_xy_t height)
@@ -445,40 +758,24 @@ void px_gfx_draw_rect(px_gfx_xy_t x, px_gfx_xy_t y, px_gfx_xy_t width, px_gfx_xy
 
 void px_gfx_draw_fill_fg(px_gfx_xy_t x, px_gfx_xy_t y, px_gfx_xy_t width, px_gfx_xy_t height)
 {
-    px_gfx_xy_t i, j;
-
     // Adjust coordinates relative to viewport
     x = px_gfx_vp_adjust_x(x);
     y = px_gfx_vp_adjust_y(y);
     // Update dirty area
     px_gfx_update_area(x, y, x + width - 1, y + height - 1);
     // Draw fill
-    for(j = y; j < y + height; j++)
-    {
-        for(i = x; i < x + width; i++)
-        {
-            px_gfx_vp_draw_pixel(i, j, px_gfx.draw_prop.color_fg);
-        }
-    }    
+    px_gfx_vp_draw_fill(x, y, width, height, px_gfx.draw_prop.color_fg);
 }
 
 void px_gfx_draw_fill_bg(px_gfx_xy_t x, px_gfx_xy_t y, px_gfx_xy_t width, px_gfx_xy_t height)
 {
-    px_gfx_xy_t i, j;
-
     // Adjust coordinates relative to viewport
     x = px_gfx_vp_adjust_x(x);
     y = px_gfx_vp_adjust_y(y);
     // Update dirty area
     px_gfx_update_area(x, y, x + width - 1, y + height - 1);
     // Draw fill
-    for(j = y; j < y + height; j++)
-    {
-        for(i = x; i < x + width; i++)
-        {
-            px_gfx_vp_draw_pixel(i, j, px_gfx.draw_prop.color_bg);
-        }
-    }    
+    px_gfx_vp_draw_fill(x, y, width, height, px_gfx.draw_prop.color_bg);
 }
 
 void px_gfx_draw_circ(px_gfx_xy_t x, px_gfx_xy_t y, px_gfx_xy_t radius)
@@ -536,11 +833,6 @@ void px_gfx_draw_circ(px_gfx_xy_t x, px_gfx_xy_t y, px_gfx_xy_t radius)
 
 void px_gfx_draw_img(px_gfx_xy_t x, px_gfx_xy_t y, const px_gfx_img_t * img)
 {
-    px_gfx_xy_t     i;
-    px_gfx_xy_t     j;
-    uint8_t         mask;
-	const uint8_t * data = img->data;
-
     // Set alignment
     if(px_gfx.draw_prop.align & PX_GFX_ALIGN_H_MID)
     {
@@ -563,46 +855,8 @@ void px_gfx_draw_img(px_gfx_xy_t x, px_gfx_xy_t y, const px_gfx_img_t * img)
     y = px_gfx_vp_adjust_y(y);
     // Update dirty area
     px_gfx_update_area(x, y, x + img->width - 1, y + img->height - 1);
-    // Repeat for each row
-    for(j = 0; j < img->height; j++)
-    {
-        // Start at most significant bit
-        mask = 1<<7;
-        // Repeat for each pixel in row
-        for(i = 0; i < img->width; i++)
-        {
-            if(*data & mask)
-            {
-                // Foreground color pixel
-                px_gfx_vp_draw_pixel(x + i, y + j, px_gfx.draw_prop.color_fg);
-            }
-            else
-            {
-                // Does pixel need to be drawn?
-                if(px_gfx.draw_prop.color_bg != PX_GFX_COLOR_TRANSPARENT)
-                {
-                    // Background color pixel
-                    px_gfx_vp_draw_pixel(x + i, y + j, px_gfx.draw_prop.color_bg);
-                }                
-            }
-            // Next bit
-            mask >>= 1;
-            // Finished with byte?
-            if(mask == 0x00)
-            {
-                // Next byte
-                data++;
-                // Start again at most significant bit
-                mask = 1<<7;
-            }
-        }
-        // Ended on 8-bit boundary?
-        if(mask != (1 << 7))
-        {
-            // No. Ignore rest of bits in byte
-            data++;
-        }
-    }   
+    // Draw image
+    px_gfx_vp_draw_img(x, y, img);
 }
 
 void px_gfx_draw_char(px_gfx_xy_t x, px_gfx_xy_t y, char glyph)
@@ -610,18 +864,53 @@ void px_gfx_draw_char(px_gfx_xy_t x, px_gfx_xy_t y, char glyph)
     px_gfx_img_t          img;
     const px_gfx_font_t * font        = px_gfx.draw_prop.font;
     const uint8_t *       data        = font->data;
-	int                   width_bytes = (font->width + 7) / 8;
+    int                   width_bytes = (font->width + 7) / 8;
+    size_t                glyph_size  = (width_bytes * font->height) + 1;
+    uint8_t               index;
+
+    // Number of glyphs known?
+    if((font->nr_of_chars != 0) && (glyph != 0x00))
+    {
+        // Index of glyph if glyphs are consecutive
+        index = (uint8_t)glyph - data[0];
+        if(index < font->nr_of_chars)
+        {
+            data = &font->data[index * glyph_size];
+        }
+        // Match?
+        if(*data == (uint8_t)glyph)
+        {
+            // Advance to start of glyph data
+            data++;
+            // Set image parameters
+            img.width  = font->width;
+            img.height = font->height;
+            img.data   = data;
+            // Draw glyph
+            px_gfx_draw_img(x, y, &img);
+            return;
+        }
+        // Glyphs consecutive (last glyph in expected position)?
+        data = &font->data[(font->nr_of_chars - 1) * glyph_size];
+        if(*data == (uint8_t)(font->data[0] + font->nr_of_chars - 1))
+        {
+            // Not in font
+            return;
+        }
+        // Fall back to linear search
+        data = font->data;
+    }
 
     // Find glyph
     while(*data != 0x00)
     {
         // Match?
-        if(*data == glyph)
+        if(*data == (uint8_t)glyph)
         {
             break;
         }
         // Next glyph
-        data += (width_bytes * font->height) + 1;
+        data += glyph_size;
     }
     // Not found?
     if(*data == 0x00)
@@ -677,6 +966,72 @@ void px_gfx_draw_str(px_gfx_xy_t  x, px_gfx_xy_t  y, const char * str)
     px_gfx.draw_prop.align = align;
 }
 
+bool px_gfx_str_area_get(px_gfx_xy_t     x,
+                         px_gfx_xy_t     y,
+                         const char *    str,
+                         px_gfx_area_t * area)
+{
+    const px_gfx_font_t * font = px_gfx.draw_prop.font;
+    px_gfx_xy_t           width;
+
+    // No string?
+    if((str == NULL) || (strlen(str) == 0))
+    {
+        return false;
+    }
+    // Same alignment as px_gfx_draw_str()
+    width = font->width * (px_gfx_xy_t)strlen(str);
+    if(px_gfx.draw_prop.align & PX_GFX_ALIGN_H_MID)
+    {
+        x -= width / 2;
+    }
+    if(px_gfx.draw_prop.align & PX_GFX_ALIGN_H_RIGHT)
+    {
+        x -= width - 2;
+    }
+    if(px_gfx.draw_prop.align & PX_GFX_ALIGN_V_MID)
+    {
+        y -= (font->height - 1) / 2;
+    }
+    if(px_gfx.draw_prop.align & PX_GFX_ALIGN_V_BOT)
+    {
+        y -= font->height - 2;
+    }
+    // Adjust coordinates relative to viewport
+    area->x1 = px_gfx_vp_adjust_x(x);
+    area->y1 = px_gfx_vp_adjust_y(y);
+    area->x2 = area->x1 + width - 1;
+    area->y2 = area->y1 + font->height - 1;
+
+    return true;
+}
+
+void px_gfx_scroll_left(px_gfx_xy_t x,
+                        px_gfx_xy_t y,
+                        px_gfx_xy_t width,
+                        px_gfx_xy_t height,
+                        px_gfx_xy_t nr_of_cols)
+{
+    px_gfx_area_t area;
+
+    // Adjust coordinates relative to viewport
+    area.x1 = px_gfx_vp_adjust_x(x);
+    area.y1 = px_gfx_vp_adjust_y(y);
+    area.x2 = area.x1 + width  - 1;
+    area.y2 = area.y1 + height - 1;
+    // Clip to view port and clip area; anything left to move?
+    if(  (!px_gfx_vp_clip(&area))
+       ||(nr_of_cols <= 0)
+       ||(nr_of_cols > area.x2 - area.x1)  )
+    {
+        return;
+    }
+    // Update dirty area
+    px_gfx_update_area(area.x1, area.y1, area.x2, area.y2);
+    // Move pixels
+    px_gfx_disp_buf_scroll_left(&area, nr_of_cols);
+}
+
 void px_gfx_printf(px_gfx_xy_t x, px_gfx_xy_t y, const char * format, ...)
 {
     va_list args;
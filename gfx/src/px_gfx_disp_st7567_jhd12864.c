@@ -17,6 +17,7 @@
 ============================================================================= */
 
 /* _____STANDARD INCLUDES____________________________________________________ */
+#include <string.h>
 
 /* _____PROJECT INCLUDES_____________________________________________________ */
 #include "px_gfx_disp.h"
@@ -37,6 +38,79 @@ static uint8_t px_gfx_frame_buf[PX_GFX_DISP_SIZE_Y / 8][PX_GFX_DISP_SIZE_X];
 /* _____LOCAL FUNCTION DECLARATIONS__________________________________________ */
 
 /* _____LOCAL FUNCTIONS______________________________________________________ */
+/// Return mask of rows in page that fall inside area
+static uint8_t px_gfx_disp_page_mask(const px_gfx_area_t * area, uint8_t page)
+{
+    uint8_t mask = 0xff;
+
+    // First page?
+    if(page == area->y1 / 8)
+    {
+        mask &= (uint8_t)(0xff << (area->y1 % 8));
+    }
+    // Last page?
+    if(page == area->y2 / 8)
+    {
+        mask &= (uint8_t)(0xff >> (7 - area->y2 % 8));
+    }
+    return mask;
+}
+
+#if PX_GFX_CFG_SPAN
+/// Apply color to bits in mask of a span of frame buffer bytes
+static void px_gfx_disp_span(uint8_t *      data,
+                             px_gfx_xy_t    nr_of_bytes,
+                             uint8_t        mask,
+                             px_gfx_color_t color)
+{
+    switch(color)
+    {
+    case PX_GFX_COLOR_ON:
+        if(mask == 0xff)
+        {
+            memset(data, 0xff, nr_of_bytes);
+            break;
+        }
+        while(nr_of_bytes-- != 0)
+        {
+            *data++ |= mask;
+        }
+        break;
+    case PX_GFX_COLOR_OFF:
+        if(mask == 0xff)
+        {
+            memset(data, 0x00, nr_of_bytes);
+            break;
+        }
+        mask = ~mask;
+        while(nr_of_bytes-- != 0)
+        {
+            *data++ &= mask;
+        }
+        break;
+    case PX_GFX_COLOR_INVERT:
+        while(nr_of_bytes-- != 0)
+        {
+            *data++ ^= mask;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+/// Apply color to bits in mask of a frame buffer byte
+static inline void px_gfx_disp_byte(uint8_t * data, uint8_t mask, px_gfx_color_t color)
+{
+    switch(color)
+    {
+    case PX_GFX_COLOR_ON:       *data |= mask;  break;
+    case PX_GFX_COLOR_OFF:      *data &= ~mask; break;
+    case PX_GFX_COLOR_INVERT:   *data ^= mask;  break;
+    default:                                    break;
+    }
+}
+#endif
 
 /* _____GLOBAL FUNCTIONS_____________________________________________________ */
 void px_gfx_disp_buf_clear(void)
@@ -70,9 +144,111 @@ void px_gfx_disp_buf_pixel(px_gfx_xy_t    x,
     }
 }
 
-void px_gfx_disp_update(const px_gfx_area_t * area)
+#if PX_GFX_CFG_SPAN
+void px_gfx_disp_buf_fill(const px_gfx_area_t * area,
+                          px_gfx_color_t        color)
+{
+    uint8_t page;
+
+    // Repeat for each page (8 rows) and fill span of columns
+    for(page = area->y1 / 8; page <= (area->y2 / 8); page++)
+    {
+        px_gfx_disp_span(&px_gfx_frame_buf[page][area->x1],
+                         area->x2 - area->x1 + 1,
+                         px_gfx_disp_page_mask(area, page),
+                         color);
+    }
+}
+
+void px_gfx_disp_buf_img(const px_gfx_area_t * area,
+                         px_gfx_xy_t           x,
+                         px_gfx_xy_t           y,
+                         const px_gfx_img_t *  img,
+                         px_gfx_color_t        color_fg,
+                         px_gfx_color_t        color_bg)
+{
+    uint8_t         fg[PX_GFX_DISP_SIZE_X];
+    uint8_t         page;
+    uint8_t         mask;
+    uint8_t         row_mask;
+    uint8_t         img_mask_start;
+    uint8_t         img_mask;
+    px_gfx_xy_t     i;
+    px_gfx_xy_t     j;
+    px_gfx_xy_t     j_last;
+    px_gfx_xy_t     img_width_bytes = (img->width + 7) / 8;
+    const uint8_t * img_data_start;
+    const uint8_t * img_data;
+
+    // Offset of first column in image row and bit mask of first pixel
+    img_data_start = img->data + (area->x1 - x) / 8;
+    img_mask_start = 0x80 >> ((area->x1 - x) % 8);
+    // Repeat for each page (8 rows)
+    for(page = area->y1 / 8; page <= (area->y2 / 8); page++)
+    {
+        // Collect foreground pixels of column bytes in page
+        memset(&fg[area->x1], 0, area->x2 - area->x1 + 1);
+        j      = page * 8;
+        j_last = page * 8 + 7;
+        if(j < area->y1)      j      = area->y1;
+        if(j_last > area->y2) j_last = area->y2;
+        for(; j <= j_last; j++)
+        {
+            row_mask = 1 << (j % 8);
+            img_data = img_data_start + (j - y) * img_width_bytes;
+            img_mask = img_mask_start;
+            for(i = area->x1; i <= area->x2; i++)
+            {
+                if(*img_data & img_mask)
+                {
+                    fg[i] |= row_mask;
+                }
+                // Next bit
+                img_mask >>= 1;
+                if(img_mask == 0)
+                {
+                    img_data++;
+                    img_mask = 0x80;
+                }
+            }
+        }
+        // Write foreground and background pixels
+        mask = px_gfx_disp_page_mask(area, page);
+        for(i = area->x1; i <= area->x2; i++)
+        {
+            px_gfx_disp_byte(&px_gfx_frame_buf[page][i], fg[i], color_fg);
+            px_gfx_disp_byte(&px_gfx_frame_buf[page][i], mask & ~fg[i], color_bg);
+        }
+    }
+}
+#endif
+
+void px_gfx_disp_buf_scroll_left(const px_gfx_area_t * area,
+                                 px_gfx_xy_t           nr_of_cols)
+{
+    uint8_t     page;
+    uint8_t     mask;
+    uint8_t *   data;
+    px_gfx_xy_t i;
+
+    // Repeat for each page (8 rows)
+    for(page = area->y1 / 8; page <= (area->y2 / 8); page++)
+    {
+        // Move rows in page that fall inside area; rightmost columns stay as is
+        mask = px_gfx_disp_page_mask(area, page);
+        data = &px_gfx_frame_buf[page][area->x1];
+        for(i = area->x1; i <= area->x2 - nr_of_cols; i++)
+        {
+            *data = (*data & ~mask) | (data[nr_of_cols] & mask);
+            data++;
+        }
+    }
+}
+
+size_t px_gfx_disp_update(const px_gfx_area_t * area)
 {
     uint8_t page;
+    size_t  nr_of_bytes = 0;
 
     // Update specified area of display
     for(page = area->y1 / 8; page <= (area->y2 / 8); page++)
@@ -80,7 +256,11 @@ void px_gfx_disp_update(const px_gfx_area_t * area)
         px_lcd_sel_page(page);
         px_lcd_sel_col(area->x1);
         px_lcd_wr_disp_data(&px_gfx_frame_buf[page][area->x1], area->x2 - area->x1 + 1);
+        // Page select (1), column select (2) and data bytes
+        nr_of_bytes += 3 + (area->x2 - area->x1 + 1);
     }
+
+    return nr_of_bytes;
 }
 
 void px_gfx_disp_log_report_buf(void)
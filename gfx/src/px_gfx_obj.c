@@ -31,10 +31,319 @@ PX_LOG_NAME("px_gfx_obj");
 /* _____GLOBAL VARIABLES_____________________________________________________ */
 
 /* _____LOCAL VARIABLES______________________________________________________ */
+/// Root object of tree that is being drawn
+static px_gfx_obj_t * px_gfx_obj_root;
 
 /* _____LOCAL FUNCTION DECLARATIONS__________________________________________ */
-
 /* _____LOCAL FUNCTIONS______________________________________________________ */
+/// Set area to be empty
+static void px_gfx_obj_area_clear(px_gfx_area_t * area)
+{
+    area->x1 = 0;
+    area->y1 = 0;
+    area->x2 = -1;
+    area->y2 = -1;
+}
+
+/// Is area empty?
+static bool px_gfx_obj_area_is_empty(const px_gfx_area_t * area)
+{
+    return (area->x1 > area->x2) || (area->y1 > area->y2);
+}
+
+/// Intersection of area a and b; return false if empty
+static bool px_gfx_obj_area_intersect(px_gfx_area_t *       area,
+                                      const px_gfx_area_t * a,
+                                      const px_gfx_area_t * b)
+{
+    area->x1 = (a->x1 > b->x1) ? a->x1 : b->x1;
+    area->y1 = (a->y1 > b->y1) ? a->y1 : b->y1;
+    area->x2 = (a->x2 < b->x2) ? a->x2 : b->x2;
+    area->y2 = (a->y2 < b->y2) ? a->y2 : b->y2;
+
+    return !px_gfx_obj_area_is_empty(area);
+}
+
+/// Extend area to also cover area b
+static void px_gfx_obj_area_union(px_gfx_area_t * area, const px_gfx_area_t * b)
+{
+    if(px_gfx_obj_area_is_empty(b))
+    {
+        return;
+    }
+    if(px_gfx_obj_area_is_empty(area))
+    {
+        *area = *b;
+        return;
+    }
+    if(area->x1 > b->x1) area->x1 = b->x1;
+    if(area->y1 > b->y1) area->y1 = b->y1;
+    if(area->x2 < b->x2) area->x2 = b->x2;
+    if(area->y2 < b->y2) area->y2 = b->y2;
+}
+
+/// Does area a contain area b?
+static bool px_gfx_obj_area_contains(const px_gfx_area_t * a, const px_gfx_area_t * b)
+{
+    return    (a->x1 <= b->x1) && (a->x2 >= b->x2)
+           && (a->y1 <= b->y1) && (a->y2 >= b->y2);
+}
+
+/// Do area a and b overlap?
+static bool px_gfx_obj_area_overlaps(const px_gfx_area_t * a, const px_gfx_area_t * b)
+{
+    px_gfx_area_t area;
+
+    return px_gfx_obj_area_intersect(&area, a, b);
+}
+
+/// Set view port of object (area of closest parent with view port flag set)
+static void px_gfx_obj_view_port_set(const px_gfx_obj_t * obj)
+{
+    const px_gfx_obj_t * obj_parent;
+
+    for(obj_parent = obj->obj_parent; obj_parent != NULL; obj_parent = obj_parent->obj_parent)
+    {
+        if(obj_parent->view_port)
+        {
+            // Object coordinates are relative to parent
+            px_gfx_view_port_set(obj_parent->area.x1,
+                                 obj_parent->area.y1,
+                                 obj_parent->area.x2 - obj_parent->area.x1 + 1,
+                                 obj_parent->area.y2 - obj_parent->area.y1 + 1,
+                                 PX_GFX_XY_REF_REL);
+            return;
+        }
+    }
+    // Object coordinates are absolute
+    px_gfx_view_port_reset();
+}
+
+/// Get new area of updated objects and add it to the invalidated area
+static void px_gfx_obj_area_update(px_gfx_obj_t * obj)
+{
+    px_gfx_obj_t * obj_child;
+
+    if(obj->update)
+    {
+        px_gfx_obj_area_clear(&obj->area);
+        if(obj->event_handler)
+        {
+            px_gfx_obj_view_port_set(obj);
+            (*obj->event_handler)(obj, PX_GFX_OBJ_EVENT_AREA, &obj->area);
+        }
+        px_gfx_obj_area_union(&obj->inval, &obj->area);
+    }
+    for(obj_child = obj->obj_child_first; obj_child != NULL; obj_child = obj_child->obj_next)
+    {
+        // Child coordinates relative to updated object (that may have moved)?
+        if(obj->update && obj->view_port)
+        {
+            px_gfx_obj_update_set(obj_child, true);
+        }
+        px_gfx_obj_area_update(obj_child);
+    }
+}
+
+/// Reset update flags and invalidated areas of object and its children
+static void px_gfx_obj_update_reset(px_gfx_obj_t * obj)
+{
+    px_gfx_obj_t * obj_child;
+
+    obj->update       = false;
+    obj->update_child = false;
+    px_gfx_obj_area_clear(&obj->inval);
+    for(obj_child = obj->obj_child_first; obj_child != NULL; obj_child = obj_child->obj_next)
+    {
+        px_gfx_obj_update_reset(obj_child);
+    }
+}
+
+/// Get damaged area of object and its children; return false if none
+static bool px_gfx_obj_damage_get(const px_gfx_obj_t * obj, px_gfx_area_t * area)
+{
+    const px_gfx_obj_t * obj_child;
+    px_gfx_area_t        area_child;
+
+    // Object updated?
+    if(obj->update)
+    {
+        *area = obj->inval;
+        return !px_gfx_obj_area_is_empty(area);
+    }
+    px_gfx_obj_area_clear(area);
+    // Visible child updated?
+    if((!obj->update_child) || (!obj->visible))
+    {
+        return false;
+    }
+    for(obj_child = obj->obj_child_first; obj_child != NULL; obj_child = obj_child->obj_next)
+    {
+        if(px_gfx_obj_damage_get(obj_child, &area_child))
+        {
+            px_gfx_obj_area_union(area, &area_child);
+        }
+    }
+    // Children are clipped to parent
+    return px_gfx_obj_area_intersect(area, area, &obj->area);
+}
+
+/// Is area of object hidden by an opaque sibling drawn on top of it?
+static bool px_gfx_obj_occluded(const px_gfx_obj_t * obj, const px_gfx_area_t * area)
+{
+    const px_gfx_obj_t * obj_sibling;
+
+    for(obj_sibling = obj->obj_next; obj_sibling != NULL; obj_sibling = obj_sibling->obj_next)
+    {
+        if(  (obj_sibling->visible)
+           &&(obj_sibling->opaque)
+           &&(px_gfx_obj_area_contains(&obj_sibling->area, area))  )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// Is object (or was it when last drawn) on top of area?
+static bool px_gfx_obj_on_top(const px_gfx_obj_t * obj, const px_gfx_area_t * area)
+{
+    // Visible and overlapping area?
+    if(obj->visible && px_gfx_obj_area_overlaps(&obj->area, area))
+    {
+        return true;
+    }
+    // Updated and previously drawn over area?
+    return obj->update && px_gfx_obj_area_overlaps(&obj->inval, area);
+}
+
+/// Is any object drawn (or was it drawn) on top of object?
+static bool px_gfx_obj_overlapped(const px_gfx_obj_t * obj)
+{
+    const px_gfx_obj_t * obj_parent;
+    const px_gfx_obj_t * obj_sibling;
+
+    // Child on top?
+    for(obj_sibling = obj->obj_child_first; obj_sibling != NULL; obj_sibling = obj_sibling->obj_next)
+    {
+        if(px_gfx_obj_on_top(obj_sibling, &obj->area))
+        {
+            return true;
+        }
+    }
+    // Sibling of object (or of its parents) on top?
+    for(obj_parent = obj;
+        (obj_parent != NULL) && (obj_parent != px_gfx_obj_root);
+        obj_parent = obj_parent->obj_parent)
+    {
+        for(obj_sibling = obj_parent->obj_next; obj_sibling != NULL; obj_sibling = obj_sibling->obj_next)
+        {
+            if(px_gfx_obj_on_top(obj_sibling, &obj->area))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/// Draw object and its children inside clip area
+static void px_gfx_obj_redraw(px_gfx_obj_t *        obj,
+                              const px_gfx_area_t * clip,
+                              bool                  incremental)
+{
+    px_gfx_obj_t *     obj_child;
+    px_gfx_area_t      area;
+    px_gfx_area_t      area_child;
+    px_gfx_obj_event_t event;
+
+    // Object visible and inside clip area?
+    if(  (!obj->visible)
+       ||(!px_gfx_obj_area_intersect(&area, clip, &obj->area))  )
+    {
+        return;
+    }
+    if(obj->event_handler)
+    {
+        // Whole object drawn and nothing on top of it?
+        if(  (incremental)
+           &&(px_gfx_obj_area_contains(&area, &obj->area))
+           &&(!px_gfx_obj_overlapped(obj))                    )
+        {
+            // Object may reuse pixels drawn previously
+            event = PX_GFX_OBJ_EVENT_DRAW_UPDATE;
+        }
+        else
+        {
+            event = PX_GFX_OBJ_EVENT_DRAW;
+        }
+        // Draw object clipped to area
+        px_gfx_obj_view_port_set(obj);
+        px_gfx_clip_set(&area);
+        (*obj->event_handler)(obj, event, NULL);
+    }
+    // Draw children on top, clipped to object
+    for(obj_child = obj->obj_child_first; obj_child != NULL; obj_child = obj_child->obj_next)
+    {
+        // Child visible and not hidden by an opaque sibling?
+        if(  (obj_child->visible)
+           &&(px_gfx_obj_area_intersect(&area_child, &area, &obj_child->area))
+           &&(!px_gfx_obj_occluded(obj_child, &area_child))                     )
+        {
+            px_gfx_obj_redraw(obj_child, &area, false);
+        }
+    }
+}
+
+/// Repair damaged areas of children inside clip area
+static void px_gfx_obj_repair(px_gfx_obj_t * obj, const px_gfx_area_t * clip)
+{
+    px_gfx_obj_t * obj_child;
+    px_gfx_obj_t * obj_sibling;
+    px_gfx_area_t  damage;
+
+    for(obj_child = obj->obj_child_first; obj_child != NULL; obj_child = obj_child->obj_next)
+    {
+        // Child (or its children) damaged inside clip area?
+        if(  (!px_gfx_obj_damage_get(obj_child, &damage))
+           ||(!px_gfx_obj_area_intersect(&damage, &damage, clip))  )
+        {
+            continue;
+        }
+        // Hidden by an opaque sibling?
+        if(px_gfx_obj_occluded(obj_child, &damage))
+        {
+            continue;
+        }
+        if(obj_child->update)
+        {
+            // Does visible opaque child cover damaged area?
+            if(  (obj_child->visible)
+               &&(obj_child->opaque)
+               &&(px_gfx_obj_area_contains(&obj_child->area, &damage))  )
+            {
+                // Only redraw child
+                px_gfx_obj_redraw(obj_child, &damage, true);
+            }
+            else
+            {
+                // Redraw everything inside damaged area (starting at root)
+                px_gfx_obj_redraw(px_gfx_obj_root, &damage, false);
+                continue;
+            }
+        }
+        else
+        {
+            // Only repair damaged children of child
+            px_gfx_obj_repair(obj_child, &damage);
+        }
+        // Redraw siblings on top that overlap damaged area
+        for(obj_sibling = obj_child->obj_next; obj_sibling != NULL; obj_sibling = obj_sibling->obj_next)
+        {
+            px_gfx_obj_redraw(obj_sibling, &damage, false);
+        }
+    }
+}
 
 /* _____GLOBAL FUNCTIONS_____________________________________________________ */
 px_gfx_obj_handle_t _px_gfx_obj_create(px_gfx_obj_type_t          obj_type,
@@ -53,6 +362,8 @@ px_gfx_obj_handle_t _px_gfx_obj_create(px_gfx_obj_type_t          obj_type,
     // Set defaults
     obj->visible = true;
     obj->update  = true;
+    px_gfx_obj_area_clear(&obj->area);
+    px_gfx_obj_area_clear(&obj->inval);
     // Set pointer to object event handler function
     obj->event_handler = event_handler;
 
@@ -70,7 +381,13 @@ void px_gfx_obj_visible_set(px_gfx_obj_handle_t obj,  bool flag)
 {
     PX_LOG_ASSERT(obj != NULL);
 
-    obj->visible = flag;
+    // Changed?
+    if(obj->visible != flag)
+    {
+        obj->visible = flag;
+        // Area occupied by object must be redrawn
+        px_gfx_obj_update_set(obj, true);
+    }
 }
 
 bool px_gfx_obj_update_get(px_gfx_obj_handle_t obj)
@@ -82,18 +399,79 @@ bool px_gfx_obj_update_get(px_gfx_obj_handle_t obj)
 
 void px_gfx_obj_update_set(px_gfx_obj_handle_t obj,  bool flag)
 {
+    px_gfx_obj_t * obj_parent;
+
     PX_LOG_ASSERT(obj != NULL);
 
-    obj->update = true;
+    obj->update = flag;
+    if(!flag)
+    {
+        px_gfx_obj_area_clear(&obj->inval);
+        return;
+    }
+    // Area that object occupied when it was last drawn must be redrawn
+    px_gfx_obj_area_union(&obj->inval, &obj->area);
+    // Notify parents that a child has been updated
+    for(obj_parent = obj->obj_parent; obj_parent != NULL; obj_parent = obj_parent->obj_parent)
+    {
+        obj_parent->update_child = true;
+    }
+}
+
+void px_gfx_obj_add_child(px_gfx_obj_handle_t obj_parent,
+                          px_gfx_obj_handle_t obj_child)
+{
+    px_gfx_obj_t * obj_next;
+
+    // Sanity checks
+    PX_LOG_ASSERT(obj_parent             != NULL);
+    PX_LOG_ASSERT(obj_child              != NULL);
+    PX_LOG_ASSERT(obj_child->obj_parent  == NULL);
+    // Set parent
+    obj_child->obj_parent = obj_parent;
+    // List empty?
+    if(obj_parent->obj_child_first == NULL)
+    {
+        // Add first child
+        obj_parent->obj_child_first = obj_child;
+    }
+    else
+    {
+        // Find last object in list
+        obj_next = obj_parent->obj_child_first;
+        while(obj_next->obj_next != NULL)
+        {
+            obj_next = obj_next->obj_next;
+        }
+        // Add child to end of list
+        obj_next->obj_next = obj_child;
+    }
+    // Child must be drawn
+    px_gfx_obj_update_set(obj_child, true);
 }
 
 void px_gfx_obj_draw(px_gfx_obj_handle_t obj)
 {
     PX_LOG_ASSERT(obj != NULL);
 
-    if(obj->visible && obj->event_handler)
+    // Object is root of tree to draw
+    px_gfx_obj_root = obj;
+    px_gfx_view_port_reset();
+    // Get new area of updated objects
+    px_gfx_obj_area_update(obj);
+    // Object updated?
+    if(obj->update)
+    {
+        // Redraw object and children
+        px_gfx_obj_redraw(obj, &obj->inval, true);
+    }
+    else if(obj->update_child && obj->visible)
     {
-        (*obj->event_handler)(obj, PX_GFX_OBJ_EVENT_DRAW, NULL);
-        obj->update = false;
+        // Only repair damaged areas of children
+        px_gfx_obj_repair(obj, &obj->area);
     }
+    // Reset update flags
+    px_gfx_obj_update_reset(obj);
+    px_gfx_clip_reset();
+    px_gfx_view_port_reset();
 }
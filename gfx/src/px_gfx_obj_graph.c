@@ -41,14 +41,61 @@ static px_gfx_xy_t px_gfx_obj_graph_scale_y(const px_gfx_obj_graph_prop_t * prop
     return (prop->height - y - 1);
 }
 
+/// Draw background and line segments of columns x1 to x2 (relative to graph)
+static void px_gfx_obj_graph_draw_cols(const px_gfx_obj_graph_prop_t * prop,
+                                       px_gfx_xy_t                     x1,
+                                       px_gfx_xy_t                     x2)
+{
+    px_gfx_xy_t         x;
+    const px_gfx_xy_t * data_y = prop->data_y;
+
+    if(prop->color_bg != PX_GFX_COLOR_TRANSPARENT)
+    {
+        // Draw graph background fill
+        px_gfx_color_bg_set(prop->color_bg);
+        px_gfx_draw_fill_bg(prop->x + x1,
+                            prop->y,
+                            x2 - x1 + 1,
+                            prop->height);
+    }
+    // Draw line segments that end in or start in columns (clipped to graph area)
+    px_gfx_color_fg_set(prop->color_fg);
+    x = (x1 > 0) ? (x1 - 1) : 0;
+    for(; (x <= x2) && (x < (prop->width - 1)); x++)
+    {
+        px_gfx_draw_line(prop->x + x,     prop->y + px_gfx_obj_graph_scale_y(prop, data_y[x]), 
+                         prop->x + x + 1, prop->y + px_gfx_obj_graph_scale_y(prop, data_y[x + 1]));
+    }
+}
+
+/// Update scroll state after graph has been drawn inside clip area
+static void px_gfx_obj_graph_drawn(px_gfx_obj_graph_t * obj_graph)
+{
+    const px_gfx_area_t * area = &obj_graph->obj.area;
+    px_gfx_area_t         clip;
+
+    // Whole graph drawn?
+    px_gfx_clip_get(&clip);
+    if(  (clip.x1 <= area->x1) && (clip.x2 >= area->x2)
+       &&(clip.y1 <= area->y1) && (clip.y2 >= area->y2)  )
+    {
+        obj_graph->scroll_cols = 0;
+        obj_graph->redraw_full = false;
+    }
+    else if(obj_graph->scroll_cols != 0)
+    {
+        // Part drawn with scrolled data; pixels can not be scrolled anymore
+        obj_graph->redraw_full = true;
+    }
+}
+
 static void px_gfx_obj_graph_event_handler(px_gfx_obj_handle_t obj, 
                                            px_gfx_obj_event_t  event,
                                            void *              data)
 {
     px_gfx_obj_graph_t *            obj_graph = (px_gfx_obj_graph_t *)obj;
     const px_gfx_obj_graph_prop_t * prop;
-    px_gfx_xy_t                     x;
-    const px_gfx_xy_t *             data_y;    
+    px_gfx_xy_t                     n;
 
     // Sanity checks
     PX_LOG_ASSERT(obj             != NULL);
@@ -57,42 +104,39 @@ static void px_gfx_obj_graph_event_handler(px_gfx_obj_handle_t obj,
     // Get pointer to properties
     prop = obj_graph->prop;
     PX_LOG_ASSERT(prop != NULL);
-    // Get pointer to Y data
-    data_y = obj_graph->prop->data_y;
     // Handle event
     switch(event)
     {
-    case PX_GFX_OBJ_EVENT_DRAW:
-        // Update flag set?
-        if(obj->update)
+    case PX_GFX_OBJ_EVENT_DRAW_UPDATE:
+        // Only scrolled since graph was drawn?
+        n = obj_graph->scroll_cols;
+        if(  (!obj_graph->redraw_full)
+           &&(n > 0)
+           &&(n < (prop->width - 2))  )
         {
-            // Reset flag
-            obj->update = false;
-            if(prop->color_bg != PX_GFX_COLOR_TRANSPARENT)
-            {
-                // Draw graph background fill
-                px_gfx_color_bg_set(prop->color_bg);
-                px_gfx_draw_fill_bg(prop->x,
-                                    prop->y,
-                                    prop->width,
-                                    prop->height);
-            }
-            // Set clipping view port
-            px_gfx_view_port_set(prop->x,
-                                 prop->y,
-                                 prop->width,
-                                 prop->height,
-                                 PX_GFX_XY_REF_REL);
-            // Draw graph
-            px_gfx_color_fg_set(prop->color_fg);
-            for(x = 0; x < (prop->width - 1); x++)
-            {
-                px_gfx_draw_line(x,     px_gfx_obj_graph_scale_y(prop, data_y[x]), 
-                                 x + 1, px_gfx_obj_graph_scale_y(prop, data_y[x + 1]));
-            }
-            // Reset view port
-            px_gfx_view_port_reset();
+            // Move existing pixels left
+            px_gfx_scroll_left(prop->x, prop->y, prop->width, prop->height, n);
+            // Redraw first column (segment that ended there has scrolled out)
+            px_gfx_obj_graph_draw_cols(prop, 0, 0);
+            // Draw new columns
+            px_gfx_obj_graph_draw_cols(prop, prop->width - n, prop->width - 1);
         }
+        else
+        {
+            // Draw whole graph
+            px_gfx_obj_graph_draw_cols(prop, 0, prop->width - 1);
+        }
+        px_gfx_obj_graph_drawn(obj_graph);
+        break;
+    case PX_GFX_OBJ_EVENT_DRAW:
+        // Draw whole graph (clipped)
+        px_gfx_obj_graph_draw_cols(prop, 0, prop->width - 1);
+        px_gfx_obj_graph_drawn(obj_graph);
+        break;
+    case PX_GFX_OBJ_EVENT_AREA:
+        // Report graph area
+        px_gfx_area_get(prop->x, prop->y, prop->width, prop->height, (px_gfx_area_t *)data);
+        obj->opaque = (prop->color_bg != PX_GFX_COLOR_TRANSPARENT);
         break;
     }
 }
@@ -135,6 +179,29 @@ void px_gfx_obj_graph_prop_set(px_gfx_obj_handle_t             obj,
     PX_LOG_ASSERT(obj           != NULL);
     PX_LOG_ASSERT(obj->obj_type == PX_GFX_OBJ_TYPE_GRAPH);
 
-    obj_graph->prop = prop;
+    obj_graph->prop        = prop;
+    // Graph must be redrawn completely
+    obj_graph->redraw_full = true;
+    px_gfx_obj_update_set(obj, true);
+}
+
+void px_gfx_obj_graph_scroll(px_gfx_obj_handle_t obj,
+                             px_gfx_xy_t         nr_of_samples)
+{
+    px_gfx_obj_graph_t * obj_graph = (px_gfx_obj_graph_t *)obj;
+
+    // Sanity checks
+    PX_LOG_ASSERT(obj           != NULL);
+    PX_LOG_ASSERT(obj->obj_type == PX_GFX_OBJ_TYPE_GRAPH);
+    PX_LOG_ASSERT(nr_of_samples >= 0);
+
+    // Accumulate number of columns to scroll when graph is drawn
+    obj_graph->scroll_cols += nr_of_samples;
+    if(obj_graph->scroll_cols > obj_graph->prop->width)
+    {
+        obj_graph->scroll_cols = obj_graph->prop->width;
+    }
+    // Graph must be redrawn
+    px_gfx_obj_update_set(obj, true);
 }
 
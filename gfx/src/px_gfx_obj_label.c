@@ -54,18 +54,21 @@ static void px_gfx_obj_label_event_handler(px_gfx_obj_handle_t obj,
     switch(event)
     {
     case PX_GFX_OBJ_EVENT_DRAW:
-        // Update flag set?
-        if(obj->update)
-        {
-            // Reset flag
-            obj->update = false;
-            // Draw label
-            px_gfx_font_set(prop->font);
-            px_gfx_color_fg_set(prop->color_fg);
-            px_gfx_color_bg_set(prop->color_bg);
-            px_gfx_align_set(prop->align);
-            px_gfx_draw_str(prop->x, prop->y, prop->str);
-        }
+    case PX_GFX_OBJ_EVENT_DRAW_UPDATE:
+        // Draw label
+        px_gfx_font_set(prop->font);
+        px_gfx_color_fg_set(prop->color_fg);
+        px_gfx_color_bg_set(prop->color_bg);
+        px_gfx_align_set(prop->align);
+        px_gfx_draw_str(prop->x, prop->y, prop->str);
+        break;
+    case PX_GFX_OBJ_EVENT_AREA:
+        // Report area occupied by string (empty if no string)
+        px_gfx_font_set(prop->font);
+        px_gfx_align_set(prop->align);
+        px_gfx_str_area_get(prop->x, prop->y, prop->str, (px_gfx_area_t *)data);
+        // Background of each glyph is drawn if color is not transparent
+        obj->opaque = (prop->color_bg != PX_GFX_COLOR_TRANSPARENT);
         break;
     }
 }
@@ -109,5 +112,7 @@ void px_gfx_obj_label_prop_set(px_gfx_obj_handle_t             obj,
     PX_LOG_ASSERT(obj->obj_type == PX_GFX_OBJ_TYPE_LABEL);
 
     obj_label->prop = prop;
+    // Label must be redrawn
+    px_gfx_obj_update_set(obj, true);
 }
 
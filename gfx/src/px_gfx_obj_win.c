@@ -48,7 +48,6 @@ static void px_gfx_obj_win_event_handler(px_gfx_obj_handle_t obj,
 {
     px_gfx_obj_win_t *            obj_win = (px_gfx_obj_win_t *)obj;
     const px_gfx_obj_win_prop_t * prop;
-    px_gfx_obj_t *                obj_child;
 
     // Sanity checks
     PX_LOG_ASSERT(obj           != NULL);
@@ -60,50 +59,21 @@ static void px_gfx_obj_win_event_handler(px_gfx_obj_handle_t obj,
     switch(event)
     {
     case PX_GFX_OBJ_EVENT_DRAW:
-        // Draw flag set?
-        if(obj->update)
+    case PX_GFX_OBJ_EVENT_DRAW_UPDATE:
+        if(prop->color_bg != PX_GFX_COLOR_TRANSPARENT)
         {
-            if(prop->color_bg != PX_GFX_COLOR_TRANSPARENT)
-            {
-                // Draw window background fill
-                px_gfx_color_bg_set(prop->color_bg);
-                px_gfx_draw_fill_bg(prop->x,
-                                    prop->y,
-                                    prop->width,
-                                    prop->height);
-            }
+            // Draw window background fill (children are drawn by px_gfx_obj)
+            px_gfx_color_bg_set(prop->color_bg);
+            px_gfx_draw_fill_bg(prop->x,
+                                prop->y,
+                                prop->width,
+                                prop->height);
         }
-        // View port specified?
-        if(    (prop->x      != 0                 )
-            || (prop->y      != 0                 )
-            || (prop->width  != PX_GFX_DISP_SIZE_X)
-            || (prop->height != PX_GFX_DISP_SIZE_Y)  )
-        {
-            // All object coordinates are relative to window
-            px_gfx_view_port_set(prop->x,
-                                 prop->y,
-                                 prop->width,
-                                 prop->height,
-                                 PX_GFX_XY_REF_REL);
-        }
-        // Start at first child in window list
-        obj_child = obj_win->obj_first;
-        // Repeat until all objects in window list have been drawn
-        while(obj_child != NULL)
-        {
-            // Has window (parent object) been redrawn?
-            if(obj->update)
-            {
-                // Set child object's draw flag
-                obj_child->update = true;
-            }
-            // Draw object
-            px_gfx_obj_draw(obj_child);
-            // Next child in list
-            obj_child = obj_child->obj_next;
-        }
-        // Reset draw flag
-        obj->update = false;
+        break;
+    case PX_GFX_OBJ_EVENT_AREA:
+        // Report window area
+        px_gfx_area_get(prop->x, prop->y, prop->width, prop->height, (px_gfx_area_t *)data);
+        obj->opaque = (prop->color_bg != PX_GFX_COLOR_TRANSPARENT);
         break;
     }
 }
@@ -122,6 +92,8 @@ px_gfx_obj_handle_t px_gfx_obj_win_create(const px_gfx_obj_win_prop_t * prop)
     PX_LOG_ASSERT(prop    != NULL);
     // Set pointer to properties
     obj_win->prop = prop;
+    // Child coordinates are relative to window
+    obj_win->obj.view_port = true;
 
 	return (px_gfx_obj_handle_t)obj_win;
 }
@@ -144,33 +116,19 @@ void px_gfx_obj_win_prop_set(px_gfx_obj_handle_t           obj,
 
     // Sanity checks
     PX_LOG_ASSERT(obj           != NULL);
-    PX_LOG_ASSERT(obj->obj_type == PX_GFX_OBJ_TYPE_LABEL);
+    PX_LOG_ASSERT(obj->obj_type == PX_GFX_OBJ_TYPE_WIN);
 
     obj_win->prop = prop;
+    // Window must be redrawn
+    px_gfx_obj_update_set(obj, true);
 }
 
 void px_gfx_obj_win_add_child(px_gfx_obj_handle_t obj_win, 
                               px_gfx_obj_handle_t obj_child)
 {
-    px_gfx_obj_win_t * obj_parent = (px_gfx_obj_win_t *)obj_win;
-    px_gfx_obj_t *     obj_next;
-
     // Sanity checks
     PX_LOG_ASSERT(obj_win           != NULL);
     PX_LOG_ASSERT(obj_win->obj_type == PX_GFX_OBJ_TYPE_WIN);
-    // List empty?
-    if(obj_parent->obj_first == NULL)
-    {
-        // Add first child
-        obj_parent->obj_first = obj_child;
-        return;
-    }
-    // Find last object in list
-    obj_next = obj_parent->obj_first;
-    while(obj_next->obj_next != NULL)
-    {
-        obj_next = obj_next->obj_next;
-    }
     // Add child to end of list
-    obj_next->obj_next = obj_child;
+    px_gfx_obj_add_child(obj_win, obj_child);
 }
@@ -0,0 +1,674 @@
+/*
+ *  Host test and benchmark for px_gfx rendering. Build and run with:
+ *
+ *      make -C tools/px_host_test run
+ *
+ *  px_gfx and the ST7567 JHD12864 display driver (page organised frame buffer)
+ *  draw to a headless LCD (tools/px_host_test/px_lcd_st7567_jhd12864.c).
+ *  tools/px_host_test/Makefile builds one executable with span rendering
+ *  (PX_GFX_CFG_SPAN = 1) and 4 tracked update areas, one that draws pixel by
+ *  pixel (PX_GFX_CFG_SPAN = 0) and one that tracks a single bounding
+ *  rectangle (PX_GFX_CFG_UPDATE_AREAS = 1).
+ *
+ *  1. Random fills (fg and bg), horizontal and vertical lines, rectangles,
+ *     images, strings and left scrolls with random positions (partially or
+ *     completely off the display), colors (on, off, invert; transparent
+ *     background), view ports (absolute and relative) and clip areas are
+ *     drawn. After each primitive only the
+ *     changed areas are sent to the LCD (px_gfx_draw_update()) and the LCD is
+ *     compared with a simple pixel model. The number of bytes that the LCD
+ *     received must match the update statistics.
+ *  2. Every character code (1 to 255) is drawn with each font, once with
+ *     indexed glyph lookup and once with a copy of the font with
+ *     nr_of_chars = 0 (linear search). Both frames must match. The 3x5 font
+ *     is also checked with a gap (missing glyph) in the data.
+ *  3. Bytes sent to the LCD per update for typical screen changes (e.g. a
+ *     clock in the top left corner and an icon in the bottom right corner).
+ *  4. Pixels per second for each primitive, and strings drawn with indexed
+ *     glyph lookup vs linear search (worst case at the end of the font).
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "px_gfx.h"
+#include "px_gfx_fonts.h"
+#include "px_gfx_img_hero_logo.h"
+#include "px_lcd_st7567_jhd12864.h"
+#include "px_host_bench.h"
+
+/// Number of random primitives drawn and checked
+#define BENCH_NR_OF_OPS         20000
+/// Maximum random image size
+#define BENCH_IMG_SIZE_MAX      40
+/// Maximum glyph data size (3x5 font with a gap)
+#define BENCH_GLYPH_DATA_SIZE   1024
+/// Number of updates per update scenario
+#define BENCH_UPDATES           16
+/// Number of pixels drawn for each timing measurement
+#define BENCH_TIMING_PIXELS     (1ul << 25)
+
+/// Pixel model [y][x]
+static bool bench_model[PX_GFX_DISP_SIZE_Y][PX_GFX_DISP_SIZE_X];
+
+/// Model drawing properties
+static px_gfx_color_t     bench_color_fg;
+static px_gfx_color_t     bench_color_bg;
+static bool               bench_vp_active;
+static px_gfx_view_port_t bench_vp;
+static px_gfx_area_t      bench_clip;
+
+/// Random image
+static uint8_t      bench_img_data[BENCH_IMG_SIZE_MAX * ((BENCH_IMG_SIZE_MAX + 7) / 8)];
+static px_gfx_img_t bench_img;
+
+/// Copy of 3x5 font data with a glyph removed
+static uint8_t bench_font_gap_data[BENCH_GLYPH_DATA_SIZE];
+
+static uint32_t bench_seed = 1;
+
+/// Simple xorshift PRNG
+static uint32_t bench_rand(uint32_t * state)
+{
+    uint32_t x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+
+    return x;
+}
+
+/// Random number in range [min, max]
+static int bench_rand_range(int min, int max)
+{
+    return min + (int)(bench_rand(&bench_seed) % (uint32_t)(max - min + 1));
+}
+
+static void bench_model_pixel(px_gfx_xy_t x, px_gfx_xy_t y, px_gfx_color_t color)
+{
+    if(bench_vp_active)
+    {
+        if(  (x < bench_vp.x) || (x >= bench_vp.x + bench_vp.width )
+           ||(y < bench_vp.y) || (y >= bench_vp.y + bench_vp.height)  )
+        {
+            return;
+        }
+    }
+    if((x < 0) || (x >= PX_GFX_DISP_SIZE_X) || (y < 0) || (y >= PX_GFX_DISP_SIZE_Y))
+    {
+        return;
+    }
+    if(  (x < bench_clip.x1) || (x > bench_clip.x2)
+       ||(y < bench_clip.y1) || (y > bench_clip.y2)  )
+    {
+        return;
+    }
+    switch(color)
+    {
+    case PX_GFX_COLOR_ON:     bench_model[y][x] = true;               break;
+    case PX_GFX_COLOR_OFF:    bench_model[y][x] = false;              break;
+    case PX_GFX_COLOR_INVERT: bench_model[y][x] = !bench_model[y][x]; break;
+    default:                                                          break;
+    }
+}
+
+/// Adjust coordinate relative to view port
+static px_gfx_xy_t bench_model_adjust(px_gfx_xy_t xy, px_gfx_xy_t vp_xy)
+{
+    if(bench_vp_active && (bench_vp.xy_ref == PX_GFX_XY_REF_REL))
+    {
+        return xy + vp_xy;
+    }
+    return xy;
+}
+
+static void bench_model_fill(px_gfx_xy_t x, px_gfx_xy_t y,
+                             px_gfx_xy_t width, px_gfx_xy_t height,
+                             px_gfx_color_t color)
+{
+    px_gfx_xy_t i;
+    px_gfx_xy_t j;
+
+    x = bench_model_adjust(x, bench_vp.x);
+    y = bench_model_adjust(y, bench_vp.y);
+    for(j = 0; j < height; j++)
+    {
+        for(i = 0; i < width; i++)
+        {
+            bench_model_pixel(x + i, y + j, color);
+        }
+    }
+}
+
+static void bench_model_img(px_gfx_xy_t x, px_gfx_xy_t y, const px_gfx_img_t * img)
+{
+    px_gfx_xy_t i;
+    px_gfx_xy_t j;
+    int         width_bytes = (img->width + 7) / 8;
+
+    x = bench_model_adjust(x, bench_vp.x);
+    y = bench_model_adjust(y, bench_vp.y);
+    for(j = 0; j < img->height; j++)
+    {
+        for(i = 0; i < img->width; i++)
+        {
+            if(img->data[j * width_bytes + i / 8] & (0x80 >> (i % 8)))
+            {
+                bench_model_pixel(x + i, y + j, bench_color_fg);
+            }
+            else
+            {
+                bench_model_pixel(x + i, y + j, bench_color_bg);
+            }
+        }
+    }
+}
+
+static void bench_model_scroll_left(px_gfx_xy_t x, px_gfx_xy_t y,
+                                    px_gfx_xy_t width, px_gfx_xy_t height,
+                                    px_gfx_xy_t nr_of_cols)
+{
+    px_gfx_area_t area;
+    px_gfx_xy_t   i;
+    px_gfx_xy_t   j;
+
+    area.x1 = bench_model_adjust(x, bench_vp.x);
+    area.y1 = bench_model_adjust(y, bench_vp.y);
+    area.x2 = area.x1 + width  - 1;
+    area.y2 = area.y1 + height - 1;
+    if(bench_vp_active)
+    {
+        if(area.x1 < bench_vp.x)                       area.x1 = bench_vp.x;
+        if(area.y1 < bench_vp.y)                       area.y1 = bench_vp.y;
+        if(area.x2 > bench_vp.x + bench_vp.width  - 1) area.x2 = bench_vp.x + bench_vp.width  - 1;
+        if(area.y2 > bench_vp.y + bench_vp.height - 1) area.y2 = bench_vp.y + bench_vp.height - 1;
+    }
+    if(area.x1 < bench_clip.x1) area.x1 = bench_clip.x1;
+    if(area.y1 < bench_clip.y1) area.y1 = bench_clip.y1;
+    if(area.x2 > bench_clip.x2) area.x2 = bench_clip.x2;
+    if(area.y2 > bench_clip.y2) area.y2 = bench_clip.y2;
+    if((area.y1 > area.y2) || (nr_of_cols <= 0) || (nr_of_cols > area.x2 - area.x1))
+    {
+        return;
+    }
+    for(j = area.y1; j <= area.y2; j++)
+    {
+        for(i = area.x1; i <= area.x2 - nr_of_cols; i++)
+        {
+            bench_model[j][i] = bench_model[j][i + nr_of_cols];
+        }
+    }
+}
+
+/// Find glyph image in font (same format as px_gfx_draw_char())
+static bool bench_glyph_get(const px_gfx_font_t * font, char glyph, px_gfx_img_t * img)
+{
+    const uint8_t * data        = font->data;
+    int             width_bytes = (font->width + 7) / 8;
+
+    while(*data != 0x00)
+    {
+        if(*data == glyph)
+        {
+            img->width  = font->width;
+            img->height = font->height;
+            img->data   = data + 1;
+            return true;
+        }
+        data += (width_bytes * font->height) + 1;
+    }
+    return false;
+}
+
+static void bench_model_str(px_gfx_xy_t x, px_gfx_xy_t y, const char * str)
+{
+    px_gfx_img_t img;
+
+    while(*str != '\0')
+    {
+        if(bench_glyph_get(&px_gfx_font_5x7, *str, &img))
+        {
+            bench_model_img(x, y, &img);
+        }
+        x += px_gfx_font_5x7.width;
+        str++;
+    }
+}
+
+/// Return number of bytes received by LCD
+static uint32_t bench_lcd_bytes(void)
+{
+    return px_lcd_stats.nr_of_data_bytes + px_lcd_stats.nr_of_cmd_bytes;
+}
+
+/// Send changed areas to LCD and check that statistics match bytes received
+static bool bench_update_check(void)
+{
+    const px_gfx_update_stats_t * stats         = px_gfx_update_stats_get();
+    uint32_t                      nr_of_updates = stats->nr_of_updates;
+    uint32_t                      lcd_bytes     = bench_lcd_bytes();
+
+    px_gfx_draw_update();
+    lcd_bytes = bench_lcd_bytes() - lcd_bytes;
+    if(stats->nr_of_updates == nr_of_updates)
+    {
+        // Nothing changed; nothing may be sent
+        if(lcd_bytes != 0)
+        {
+            printf("%u bytes sent without update\n", (unsigned)lcd_bytes);
+            return false;
+        }
+    }
+    else if(lcd_bytes != stats->nr_of_bytes_last)
+    {
+        printf("LCD received %u bytes; statistics report %u bytes\n",
+               (unsigned)lcd_bytes, (unsigned)stats->nr_of_bytes_last);
+        return false;
+    }
+    return true;
+}
+
+/// Send changed areas to LCD and compare with model
+static bool bench_frame_check(void)
+{
+    px_gfx_xy_t x;
+    px_gfx_xy_t y;
+
+    if(!bench_update_check())
+    {
+        return false;
+    }
+    for(y = 0; y < PX_GFX_DISP_SIZE_Y; y++)
+    {
+        for(x = 0; x < PX_GFX_DISP_SIZE_X; x++)
+        {
+            if(px_lcd_get_pixel(x, y) != bench_model[y][x])
+            {
+                printf("Mismatch at x=%d y=%d\n", x, y);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static void bench_img_random(void)
+{
+    size_t i;
+
+    bench_img.width  = bench_rand_range(1, BENCH_IMG_SIZE_MAX);
+    bench_img.height = bench_rand_range(1, BENCH_IMG_SIZE_MAX);
+    bench_img.data   = bench_img_data;
+    for(i = 0; i < sizeof(bench_img_data); i++)
+    {
+        bench_img_data[i] = (uint8_t)bench_rand(&bench_seed);
+    }
+}
+
+static px_gfx_color_t bench_color_random(bool transparent)
+{
+    return (px_gfx_color_t)bench_rand_range(0, transparent ? 3 : 2);
+}
+
+static void bench_random_check(void)
+{
+    static const char bench_chars[] = "0123456789 AZaz!.:~";
+    char              str[8];
+    px_gfx_xy_t       x;
+    px_gfx_xy_t       y;
+    px_gfx_xy_t       w;
+    px_gfx_xy_t       h;
+    int               op;
+    int               i;
+
+    px_gfx_init();
+    memset(bench_model, 0, sizeof(bench_model));
+    bench_color_fg  = PX_GFX_COLOR_ON;
+    bench_color_bg  = PX_GFX_COLOR_OFF;
+    bench_vp_active = false;
+    px_gfx_clip_get(&bench_clip);
+    PX_HOST_CHECK(bench_frame_check());
+
+    for(op = 0; op < BENCH_NR_OF_OPS; op++)
+    {
+        // Change colors and view port sometimes
+        if(bench_rand_range(0, 7) == 0)
+        {
+            bench_color_fg = bench_color_random(false);
+            bench_color_bg = bench_color_random(true);
+            px_gfx_color_fg_set(bench_color_fg);
+            px_gfx_color_bg_set(bench_color_bg);
+        }
+        if(bench_rand_range(0, 15) == 0)
+        {
+            if(bench_rand_range(0, 2) == 0)
+            {
+                bench_vp_active = false;
+                px_gfx_view_port_reset();
+            }
+            else
+            {
+                bench_vp_active = true;
+                bench_vp.x      = bench_rand_range(-20, PX_GFX_DISP_SIZE_X);
+                bench_vp.y      = bench_rand_range(-20, PX_GFX_DISP_SIZE_Y);
+                bench_vp.width  = bench_rand_range(0, PX_GFX_DISP_SIZE_X);
+                bench_vp.height = bench_rand_range(0, PX_GFX_DISP_SIZE_Y);
+                bench_vp.xy_ref = bench_rand_range(0, 1) ? PX_GFX_XY_REF_ABS : PX_GFX_XY_REF_REL;
+                px_gfx_view_port_set(bench_vp.x, bench_vp.y, bench_vp.width, bench_vp.height, bench_vp.xy_ref);
+            }
+        }
+        if(bench_rand_range(0, 15) == 0)
+        {
+            if(bench_rand_range(0, 2) == 0)
+            {
+                px_gfx_clip_reset();
+            }
+            else
+            {
+                bench_clip.x1 = bench_rand_range(-20, PX_GFX_DISP_SIZE_X);
+                bench_clip.y1 = bench_rand_range(-20, PX_GFX_DISP_SIZE_Y);
+                bench_clip.x2 = bench_clip.x1 + bench_rand_range(-1, PX_GFX_DISP_SIZE_X);
+                bench_clip.y2 = bench_clip.y1 + bench_rand_range(-1, PX_GFX_DISP_SIZE_Y);
+                px_gfx_clip_set(&bench_clip);
+            }
+            // Clip area is limited to display
+            px_gfx_clip_get(&bench_clip);
+        }
+
+        x = bench_rand_range(-40, PX_GFX_DISP_SIZE_X + 8);
+        y = bench_rand_range(-40, PX_GFX_DISP_SIZE_Y + 8);
+        w = bench_rand_range(0, PX_GFX_DISP_SIZE_X + 16);
+        h = bench_rand_range(0, PX_GFX_DISP_SIZE_Y + 16);
+        switch(bench_rand_range(0, 7))
+        {
+        case 0:
+            px_gfx_draw_fill_fg(x, y, w, h);
+            bench_model_fill(x, y, w, h, bench_color_fg);
+            break;
+        case 1:
+            px_gfx_draw_fill_bg(x, y, w, h);
+            bench_model_fill(x, y, w, h, bench_color_bg);
+            break;
+        case 2:
+            px_gfx_draw_line_hor(x, y, w);
+            bench_model_fill(x, y, w, 1, bench_color_fg);
+            break;
+        case 3:
+            px_gfx_draw_line_ver(x, y, h);
+            bench_model_fill(x, y, 1, h, bench_color_fg);
+            break;
+        case 4:
+            if((w < 2) || (h < 2))
+            {
+                break;
+            }
+            px_gfx_draw_rect(x, y, w, h);
+            bench_model_fill(x,         y,         w, 1, bench_color_fg);
+            bench_model_fill(x,         y + h - 1, w, 1, bench_color_fg);
+            bench_model_fill(x,         y,         1, h, bench_color_fg);
+            bench_model_fill(x + w - 1, y,         1, h, bench_color_fg);
+            break;
+        case 5:
+            bench_img_random();
+            px_gfx_draw_img(x, y, &bench_img);
+            bench_model_img(x, y, &bench_img);
+            break;
+        case 6:
+            i = bench_rand_range(-1, PX_GFX_DISP_SIZE_X / 2);
+            px_gfx_scroll_left(x, y, w, h, i);
+            bench_model_scroll_left(x, y, w, h, i);
+            break;
+        default:
+            for(i = 0; i < (int)sizeof(str) - 1; i++)
+            {
+                str[i] = bench_chars[bench_rand_range(0, sizeof(bench_chars) - 2)];
+            }
+            str[i] = '\0';
+            px_gfx_draw_str(x, y, str);
+            bench_model_str(x, y, str);
+            break;
+        }
+        PX_HOST_CHECK(bench_frame_check());
+    }
+    px_gfx_draw_prop_reset();
+    px_gfx_clip_reset();
+}
+
+/// Draw all character codes and return copy of LCD RAM
+static void bench_chars_draw(const px_gfx_font_t * font,
+                             uint8_t               ram[PX_LCD_NR_OF_PAGES][PX_LCD_NR_OF_COLS])
+{
+    px_gfx_xy_t x = 0;
+    px_gfx_xy_t y = 0;
+    int         c;
+
+    px_gfx_buf_clear();
+    px_gfx_font_set(font);
+    for(c = 1; c <= 255; c++)
+    {
+        // Glyphs overlap; caller sets colors (invert) so that all are compared
+        px_gfx_draw_char(x, y, (char)c);
+        x += 7;
+        if(x >= PX_GFX_DISP_SIZE_X)
+        {
+            x  = 0;
+            y += 3;
+        }
+    }
+    px_gfx_draw();
+    memcpy(ram, px_lcd_ram, sizeof(px_lcd_ram));
+}
+
+/// Compare indexed glyph lookup with linear search
+static bool bench_glyph_check(const px_gfx_font_t * font)
+{
+    static uint8_t ram_indexed[PX_LCD_NR_OF_PAGES][PX_LCD_NR_OF_COLS];
+    static uint8_t ram_linear[PX_LCD_NR_OF_PAGES][PX_LCD_NR_OF_COLS];
+    px_gfx_font_t  font_linear = *font;
+
+    font_linear.nr_of_chars = 0;
+    px_gfx_color_fg_set(PX_GFX_COLOR_INVERT);
+    px_gfx_color_bg_set(PX_GFX_COLOR_TRANSPARENT);
+    bench_chars_draw(font,         ram_indexed);
+    bench_chars_draw(&font_linear, ram_linear);
+    px_gfx_draw_prop_reset();
+
+    return memcmp(ram_indexed, ram_linear, sizeof(ram_indexed)) == 0;
+}
+
+static void bench_glyph_lookup_check(void)
+{
+    px_gfx_font_t font_gap   = px_gfx_font_3x5;
+    size_t        glyph_size = ((font_gap.width + 7) / 8) * font_gap.height + 1;
+    size_t        size;
+
+    px_gfx_init();
+    PX_HOST_CHECK(bench_glyph_check(&px_gfx_font_3x5));
+    PX_HOST_CHECK(bench_glyph_check(&px_gfx_font_5x7));
+    PX_HOST_CHECK(bench_glyph_check(&px_gfx_font_11x14));
+
+    // Copy 3x5 font data without glyph 'A'
+    size = font_gap.nr_of_chars * glyph_size + 1;
+    PX_HOST_CHECK(size <= sizeof(bench_font_gap_data));
+    PX_HOST_CHECK(font_gap.data[('A' - ' ') * glyph_size] == 'A');
+    memcpy(bench_font_gap_data, font_gap.data, ('A' - ' ') * glyph_size);
+    memcpy(&bench_font_gap_data[('A' - ' ') * glyph_size],
+           &font_gap.data[('A' - ' ' + 1) * glyph_size],
+           size - ('A' - ' ' + 1) * glyph_size);
+    font_gap.data = bench_font_gap_data;
+    font_gap.nr_of_chars--;
+    PX_HOST_CHECK(bench_glyph_check(&font_gap));
+}
+
+/// Draw screen change of update scenario
+static void bench_update_scenario_draw(int scenario, uint32_t k)
+{
+    char str[16];
+    int  i;
+
+    switch(scenario)
+    {
+    case 0:
+        // Clock top left, status icon bottom right
+        sprintf(str, "12:%02u", (unsigned)(k % 60));
+        px_gfx_draw_str(0, 0, str);
+        px_gfx_draw_img(PX_GFX_X_MAX - 9, PX_GFX_Y_MAX - 9, &px_gfx_img_hero_logo);
+        break;
+    case 1:
+        // Clock only
+        sprintf(str, "12:%02u", (unsigned)(k % 60));
+        px_gfx_draw_str(0, 0, str);
+        break;
+    case 2:
+        // Marker in each corner
+        px_gfx_draw_fill_fg(0,                 0,                 4, 4);
+        px_gfx_draw_fill_fg(PX_GFX_X_MAX - 3,  0,                 4, 4);
+        px_gfx_draw_fill_fg(0,                 PX_GFX_Y_MAX - 3,  4, 4);
+        px_gfx_draw_fill_fg(PX_GFX_X_MAX - 3,  PX_GFX_Y_MAX - 3,  4, 4);
+        break;
+    case 3:
+        // Cross hair (horizontal and vertical line)
+        px_gfx_draw_line_hor(0, 33, PX_GFX_DISP_SIZE_X);
+        px_gfx_draw_line_ver(70, 0, PX_GFX_DISP_SIZE_Y);
+        break;
+    default:
+        // Eight values scattered over the display
+        for(i = 0; i < 8; i++)
+        {
+            sprintf(str, "%u", (unsigned)((k + i) % 10));
+            px_gfx_draw_str((i * 37) % 122, (i * 23) % 56, str);
+        }
+        break;
+    }
+}
+
+static void bench_update_scenarios(void)
+{
+    static const char * const names[] =
+    {
+        "Clock top left + icon bottom right",
+        "Clock only",
+        "Marker in each corner",
+        "Cross hair",
+        "Eight scattered values",
+    };
+    static uint8_t                ram[PX_LCD_NR_OF_PAGES][PX_LCD_NR_OF_COLS];
+    const px_gfx_update_stats_t * stats = px_gfx_update_stats_get();
+    uint32_t                      frame_bytes;
+    uint32_t                      nr_of_areas;
+    uint32_t                      nr_of_bytes;
+    uint32_t                      k;
+    int                           scenario;
+
+    px_gfx_init();
+    px_gfx_draw();
+    frame_bytes = stats->nr_of_bytes_last;
+    printf("%-34s %10s %12s %12s\n", "Update", "areas", "bytes", "% of frame");
+    for(scenario = 0; scenario < (int)(sizeof(names) / sizeof(names[0])); scenario++)
+    {
+        nr_of_areas = 0;
+        nr_of_bytes = 0;
+        for(k = 0; k < BENCH_UPDATES; k++)
+        {
+            px_gfx_color_fg_set((k & 1) ? PX_GFX_COLOR_OFF : PX_GFX_COLOR_ON);
+            bench_update_scenario_draw(scenario, k);
+            px_gfx_update_stats_reset();
+            PX_HOST_CHECK(bench_update_check());
+            nr_of_areas += stats->nr_of_areas;
+            nr_of_bytes += stats->nr_of_bytes;
+            // LCD must be the same after sending the whole frame buffer
+            memcpy(ram, px_lcd_ram, sizeof(ram));
+            px_gfx_draw();
+            PX_HOST_CHECK(memcmp(ram, px_lcd_ram, sizeof(ram)) == 0);
+        }
+        printf("%-34s %10.1f %12.1f %12.1f\n", names[scenario],
+               (double)nr_of_areas / BENCH_UPDATES,
+               (double)nr_of_bytes / BENCH_UPDATES,
+               100.0 * nr_of_bytes / BENCH_UPDATES / frame_bytes);
+    }
+    px_gfx_draw_prop_reset();
+}
+
+/// Time primitive (drawn n times, each with the specified number of pixels)
+static void bench_timing_row(const char * name, int prim, uint32_t pixels)
+{
+    static const char str[] = "Hello World! 0123456";
+    uint32_t          n     = BENCH_TIMING_PIXELS / pixels;
+    uint32_t          k;
+    uint64_t          start_us;
+    uint64_t          time_us;
+
+    start_us = px_host_bench_time_us();
+    for(k = 0; k < n; k++)
+    {
+        px_gfx_color_fg_set((k & 1) ? PX_GFX_COLOR_OFF : PX_GFX_COLOR_ON);
+        switch(prim)
+        {
+        case 0: px_gfx_draw_fill_fg(0, 0, PX_GFX_DISP_SIZE_X, PX_GFX_DISP_SIZE_Y); break;
+        case 1: px_gfx_draw_fill_fg(13, 5, 37, 21);                                break;
+        case 2: px_gfx_draw_line_hor(0, k % PX_GFX_DISP_SIZE_Y, PX_GFX_DISP_SIZE_X); break;
+        case 3: px_gfx_draw_line_ver(k % PX_GFX_DISP_SIZE_X, 0, PX_GFX_DISP_SIZE_Y); break;
+        case 4: px_gfx_draw_img(k % 64, 3, &px_gfx_img_hero_logo);                 break;
+        case 6: px_gfx_draw_str(0, k % 50, "xyz{|}~xyz");                          break;
+        default: px_gfx_draw_str(0, k % 56, str);                                  break;
+        }
+    }
+    time_us = px_host_bench_time_us() - start_us;
+    px_gfx_color_fg_set(PX_GFX_COLOR_ON);
+
+    printf("%-34s %10lu %12.1f %12.2f\n", name, (unsigned long)pixels,
+           (double)time_us * 1000.0 / n,
+           px_host_bench_per_sec((uint64_t)n * pixels, time_us) / 1e6);
+}
+
+static void bench_timing(void)
+{
+    px_gfx_init();
+    px_gfx_color_bg_set(PX_GFX_COLOR_OFF);
+    printf("%-34s %10s %12s %12s\n", "Primitive", "pixels", "ns/call", "Mpixels/s");
+    bench_timing_row("Fill screen 128x64",          0, PX_GFX_DISP_SIZE_X * PX_GFX_DISP_SIZE_Y);
+    bench_timing_row("Fill 37x21 (partial pages)",  1, 37 * 21);
+    bench_timing_row("Horizontal line 128",         2, PX_GFX_DISP_SIZE_X);
+    bench_timing_row("Vertical line 64",            3, PX_GFX_DISP_SIZE_Y);
+    bench_timing_row("Image 64x42 (hero logo)",     4, 64 * 42);
+    bench_timing_row("String 20 chars (5x7 font)",  5, 20 * 6 * 8);
+}
+
+static void bench_timing_glyph(void)
+{
+    px_gfx_font_t font_linear = px_gfx_font_11x14;
+
+    font_linear.nr_of_chars = 0;
+    px_gfx_init();
+    px_gfx_color_bg_set(PX_GFX_COLOR_OFF);
+    printf("%-34s %10s %12s %12s\n", "String \"xyz{|}~xyz\" (11x14 font)", "pixels", "ns/call", "Mpixels/s");
+    px_gfx_font_set(&font_linear);
+    bench_timing_row("Linear search",  6, 10 * 12 * 15);
+    px_gfx_font_set(&px_gfx_font_11x14);
+    bench_timing_row("Indexed",        6, 10 * 12 * 15);
+}
+
+int main(void)
+{
+    printf("px_gfx host test: %dx%d page organised frame buffer, %s\n\n",
+           PX_GFX_DISP_SIZE_X, PX_GFX_DISP_SIZE_Y,
+           PX_GFX_CFG_SPAN ? "span rendering" : "pixel by pixel rendering");
+
+    px_lcd_init();
+
+    bench_random_check();
+    printf("Random primitive check (%d primitives): OK\n\n", BENCH_NR_OF_OPS);
+
+    bench_glyph_lookup_check();
+    printf("Glyph lookup check (indexed vs linear search): OK\n\n");
+
+    bench_update_scenarios();
+    printf("\n");
+
+    bench_timing();
+    printf("\n");
+    bench_timing_glyph();
+
+    return 0;
+}
@@ -0,0 +1,454 @@
+/*
+ *  Host test and benchmark for the px_gfx_obj object tree. Build and run with:
+ *
+ *      make -C tools/px_host_test run
+ *
+ *  px_gfx_obj, px_gfx and the ST7567 JHD12864 display driver draw to a
+ *  headless LCD (tools/px_host_test/px_lcd_st7567_jhd12864.c).
+ *
+ *  The scene is a full display window with a scrolling graph, a clock label,
+ *  a value label and unit label in a (nested) panel window that moves, an
+ *  alarm label on top of the graph that is shown and hidden, and a label that
+ *  is hidden behind an opaque cover label. Coordinates of panel labels are
+ *  relative to the panel window.
+ *
+ *  1. Random changes are made to the scene (graph scrolled by 0 to 3 samples,
+ *     label strings with different lengths, visibility, property changes)
+ *     and only the damaged areas are redrawn with px_gfx_obj_draw(). After
+ *     the changed areas have been sent to the LCD, the LCD must be the same
+ *     as a complete redraw of the scene.
+ *  2. Redraw cost per frame (time in px_gfx_obj_draw(), number of update
+ *     areas and bytes sent to the LCD) for typical changes, compared with a
+ *     complete redraw.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "px_gfx.h"
+#include "px_gfx_objects.h"
+#include "px_gfx_fonts.h"
+#include "px_lcd_st7567_jhd12864.h"
+#include "px_host_bench.h"
+
+/// Number of random frames drawn and checked
+#define BENCH_NR_OF_FRAMES      20000
+/// Number of frames per cost measurement
+#define BENCH_COST_FRAMES       4096
+/// Graph height
+#define BENCH_GRAPH_HEIGHT      40
+
+static px_gfx_obj_handle_t obj_win;
+static px_gfx_obj_handle_t obj_graph;
+static px_gfx_obj_handle_t obj_label_clock;
+static px_gfx_obj_handle_t obj_panel;
+static px_gfx_obj_handle_t obj_label_val;
+static px_gfx_obj_handle_t obj_label_unit;
+static px_gfx_obj_handle_t obj_label_alarm;
+static px_gfx_obj_handle_t obj_label_hidden;
+static px_gfx_obj_handle_t obj_label_cover;
+
+static px_gfx_xy_t bench_graph_data_y[PX_GFX_DISP_SIZE_X];
+static char        bench_clock_str[16];
+static char        bench_val_str[16];
+static char        bench_hidden_str[16];
+
+static uint32_t bench_seed = 1;
+
+static const px_gfx_obj_graph_prop_t obj_graph_prop =
+{
+    .x        = 0,
+    .y        = PX_GFX_DISP_SIZE_Y - BENCH_GRAPH_HEIGHT,
+    .width    = PX_GFX_DISP_SIZE_X,
+    .height   = BENCH_GRAPH_HEIGHT,
+    .color_fg = PX_GFX_COLOR_ON,
+    .color_bg = PX_GFX_COLOR_OFF,
+    .data_y   = bench_graph_data_y,
+};
+
+static const px_gfx_obj_label_prop_t obj_label_prop_clock =
+{
+    .x        = 0,
+    .y        = 0,
+    .str      = bench_clock_str,
+    .font     = &px_gfx_font_5x7,
+    .color_fg = PX_GFX_COLOR_ON,
+    .color_bg = PX_GFX_COLOR_OFF,
+    .align    = PX_GFX_ALIGN_TOP_LEFT,
+};
+
+static const px_gfx_obj_win_prop_t obj_panel_prop =
+{
+    .x        = 72,
+    .y        = 0,
+    .width    = 56,
+    .height   = 22,
+    .color_bg = PX_GFX_COLOR_OFF,
+};
+
+static const px_gfx_obj_win_prop_t obj_panel_prop_moved =
+{
+    .x        = 64,
+    .y        = 2,
+    .width    = 56,
+    .height   = 22,
+    .color_bg = PX_GFX_COLOR_OFF,
+};
+
+static const px_gfx_obj_label_prop_t obj_label_prop_val =
+{
+    .x        = 42,
+    .y        = 16,
+    .str      = bench_val_str,
+    .font     = &px_gfx_font_11x14,
+    .color_fg = PX_GFX_COLOR_ON,
+    .color_bg = PX_GFX_COLOR_OFF,
+    .align    = PX_GFX_ALIGN_BOT_RIGHT,
+};
+
+static const px_gfx_obj_label_prop_t obj_label_prop_unit =
+{
+    .x        = 44,
+    .y        = 16,
+    .str      = "C",
+    .font     = &px_gfx_font_11x14,
+    .color_fg = PX_GFX_COLOR_ON,
+    .color_bg = PX_GFX_COLOR_TRANSPARENT,
+    .align    = PX_GFX_ALIGN_BOT_LEFT,
+};
+
+static const px_gfx_obj_label_prop_t obj_label_prop_alarm =
+{
+    .x        = 64,
+    .y        = 40,
+    .str      = "ALARM",
+    .font     = &px_gfx_font_5x7,
+    .color_fg = PX_GFX_COLOR_OFF,
+    .color_bg = PX_GFX_COLOR_ON,
+    .align    = PX_GFX_ALIGN_MID,
+};
+
+static const px_gfx_obj_label_prop_t obj_label_prop_alarm_moved =
+{
+    .x        = 20,
+    .y        = 30,
+    .str      = "ALARM",
+    .font     = &px_gfx_font_5x7,
+    .color_fg = PX_GFX_COLOR_OFF,
+    .color_bg = PX_GFX_COLOR_ON,
+    .align    = PX_GFX_ALIGN_TOP_LEFT,
+};
+
+static const px_gfx_obj_label_prop_t obj_label_prop_hidden =
+{
+    .x        = 2,
+    .y        = 12,
+    .str      = bench_hidden_str,
+    .font     = &px_gfx_font_3x5,
+    .color_fg = PX_GFX_COLOR_ON,
+    .color_bg = PX_GFX_COLOR_TRANSPARENT,
+    .align    = PX_GFX_ALIGN_TOP_LEFT,
+};
+
+static const px_gfx_obj_label_prop_t obj_label_prop_cover =
+{
+    .x        = 0,
+    .y        = 10,
+    .str      = "########",
+    .font     = &px_gfx_font_5x7,
+    .color_fg = PX_GFX_COLOR_ON,
+    .color_bg = PX_GFX_COLOR_OFF,
+    .align    = PX_GFX_ALIGN_TOP_LEFT,
+};
+
+/// Simple xorshift PRNG
+static uint32_t bench_rand(uint32_t * state)
+{
+    uint32_t x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+
+    return x;
+}
+
+/// Random number in range [min, max]
+static int bench_rand_range(int min, int max)
+{
+    return min + (int)(bench_rand(&bench_seed) % (uint32_t)(max - min + 1));
+}
+
+static void bench_scene_create(void)
+{
+    int i;
+
+    px_gfx_init();
+    for(i = 0; i < PX_GFX_DISP_SIZE_X; i++)
+    {
+        bench_graph_data_y[i] = (px_gfx_xy_t)(i % BENCH_GRAPH_HEIGHT);
+    }
+    strcpy(bench_clock_str,  "12:00");
+    strcpy(bench_val_str,    "20.0");
+    strcpy(bench_hidden_str, "hid");
+
+    obj_win          = px_gfx_obj_win_create(&px_gfx_obj_win_prop_full_disp);
+    obj_graph        = px_gfx_obj_graph_create(&obj_graph_prop);
+    obj_label_clock  = px_gfx_obj_label_create(&obj_label_prop_clock);
+    obj_panel        = px_gfx_obj_win_create(&obj_panel_prop);
+    obj_label_val    = px_gfx_obj_label_create(&obj_label_prop_val);
+    obj_label_unit   = px_gfx_obj_label_create(&obj_label_prop_unit);
+    obj_label_alarm  = px_gfx_obj_label_create(&obj_label_prop_alarm);
+    obj_label_hidden = px_gfx_obj_label_create(&obj_label_prop_hidden);
+    obj_label_cover  = px_gfx_obj_label_create(&obj_label_prop_cover);
+
+    px_gfx_obj_win_add_child(obj_win,   obj_graph);
+    px_gfx_obj_win_add_child(obj_win,   obj_label_clock);
+    px_gfx_obj_win_add_child(obj_win,   obj_panel);
+    px_gfx_obj_win_add_child(obj_panel, obj_label_val);
+    px_gfx_obj_win_add_child(obj_panel, obj_label_unit);
+    px_gfx_obj_win_add_child(obj_win,   obj_label_alarm);
+    px_gfx_obj_win_add_child(obj_win,   obj_label_hidden);
+    px_gfx_obj_win_add_child(obj_win,   obj_label_cover);
+
+    px_gfx_obj_visible_set(obj_label_alarm, false);
+    px_gfx_obj_draw(obj_win);
+    px_gfx_draw();
+}
+
+/// Move graph data left and append samples
+static void bench_graph_scroll(int nr_of_samples)
+{
+    int i;
+
+    for(i = 0; i < nr_of_samples; i++)
+    {
+        memmove(&bench_graph_data_y[0], &bench_graph_data_y[1],
+                sizeof(bench_graph_data_y) - sizeof(bench_graph_data_y[0]));
+        bench_graph_data_y[PX_GFX_DISP_SIZE_X - 1] =
+            (px_gfx_xy_t)bench_rand_range(0, BENCH_GRAPH_HEIGHT - 1);
+    }
+    px_gfx_obj_graph_scroll(obj_graph, nr_of_samples);
+}
+
+static void bench_clock_change(uint32_t k)
+{
+    sprintf(bench_clock_str, "%02u:%02u", (unsigned)((k / 60) % 24), (unsigned)(k % 60));
+    px_gfx_obj_update_set(obj_label_clock, true);
+}
+
+static void bench_val_change(void)
+{
+    sprintf(bench_val_str, "%d.%d", bench_rand_range(-99, 999), bench_rand_range(0, 9));
+    px_gfx_obj_update_set(obj_label_val, true);
+}
+
+/// Make random changes to scene
+static void bench_scene_change_random(uint32_t k)
+{
+    int n;
+
+    if(bench_rand_range(0, 3) != 0)
+    {
+        bench_graph_scroll(bench_rand_range(0, 3));
+    }
+    if(bench_rand_range(0, 1) == 0)
+    {
+        bench_clock_change(k);
+    }
+    if(bench_rand_range(0, 2) == 0)
+    {
+        bench_val_change();
+    }
+    if(bench_rand_range(0, 7) == 0)
+    {
+        px_gfx_obj_visible_set(obj_label_alarm, !px_gfx_obj_visible_get(obj_label_alarm));
+    }
+    if(bench_rand_range(0, 15) == 0)
+    {
+        px_gfx_obj_label_prop_set(obj_label_alarm,
+                                  bench_rand_range(0, 1) ? &obj_label_prop_alarm
+                                                         : &obj_label_prop_alarm_moved);
+    }
+    if(bench_rand_range(0, 3) == 0)
+    {
+        // Hidden label changes length (and is always covered)
+        n = bench_rand_range(0, 4);
+        memset(bench_hidden_str, 'a' + (k % 26), n);
+        bench_hidden_str[n] = '\0';
+        px_gfx_obj_update_set(obj_label_hidden, true);
+    }
+    if(bench_rand_range(0, 31) == 0)
+    {
+        px_gfx_obj_visible_set(obj_label_unit, !px_gfx_obj_visible_get(obj_label_unit));
+    }
+    if(bench_rand_range(0, 63) == 0)
+    {
+        px_gfx_obj_graph_prop_set(obj_graph, &obj_graph_prop);
+    }
+    if(bench_rand_range(0, 63) == 0)
+    {
+        px_gfx_obj_update_set(obj_panel, true);
+    }
+    if(bench_rand_range(0, 63) == 0)
+    {
+        // Panel labels move with panel
+        px_gfx_obj_win_prop_set(obj_panel,
+                                bench_rand_range(0, 1) ? &obj_panel_prop
+                                                       : &obj_panel_prop_moved);
+    }
+}
+
+/// Redraw damaged areas, send changed areas and compare with complete redraw
+static bool bench_frame_check(void)
+{
+    static uint8_t                ram[PX_LCD_NR_OF_PAGES][PX_LCD_NR_OF_COLS];
+    const px_gfx_update_stats_t * stats     = px_gfx_update_stats_get();
+    uint32_t                      lcd_bytes = px_lcd_stats.nr_of_data_bytes + px_lcd_stats.nr_of_cmd_bytes;
+    uint32_t                      nr_of_updates = stats->nr_of_updates;
+
+    // Redraw damaged areas and send changed areas
+    px_gfx_obj_draw(obj_win);
+    px_gfx_draw_update();
+    lcd_bytes = px_lcd_stats.nr_of_data_bytes + px_lcd_stats.nr_of_cmd_bytes - lcd_bytes;
+    if((stats->nr_of_updates != nr_of_updates) && (lcd_bytes != stats->nr_of_bytes_last))
+    {
+        printf("LCD received %u bytes; statistics report %u bytes\n",
+               (unsigned)lcd_bytes, (unsigned)stats->nr_of_bytes_last);
+        return false;
+    }
+    memcpy(ram, px_lcd_ram, sizeof(ram));
+    // Redraw complete scene from cleared frame buffer
+    px_gfx_buf_clear();
+    px_gfx_obj_update_set(obj_win, true);
+    px_gfx_obj_draw(obj_win);
+    px_gfx_draw();
+
+    return memcmp(ram, px_lcd_ram, sizeof(ram)) == 0;
+}
+
+static void bench_random_check(void)
+{
+    uint32_t k;
+
+    bench_scene_create();
+    for(k = 0; k < BENCH_NR_OF_FRAMES; k++)
+    {
+        bench_scene_change_random(k);
+        if(!bench_frame_check())
+        {
+            printf("Mismatch in frame %u\n", (unsigned)k);
+            PX_HOST_CHECK(false);
+        }
+    }
+}
+
+/// Panel labels must be drawn relative to panel window
+static void bench_view_port_check(void)
+{
+    const px_gfx_obj_win_prop_t * prop[] = {&obj_panel_prop_moved, &obj_panel_prop};
+    int                           i;
+
+    bench_scene_create();
+    for(i = 0; i < 2; i++)
+    {
+        px_gfx_obj_win_prop_set(obj_panel, prop[i]);
+        PX_HOST_CHECK(bench_frame_check());
+        PX_HOST_CHECK(obj_label_unit->area.x1 == prop[i]->x + obj_label_prop_unit.x);
+        PX_HOST_CHECK(obj_label_unit->area.y2 == prop[i]->y + obj_label_prop_unit.y + 1);
+    }
+}
+
+/// Measure redraw cost of a typical change
+static void bench_cost_row(const char * name, int change, uint32_t frame_bytes)
+{
+    const px_gfx_update_stats_t * stats = px_gfx_update_stats_get();
+    uint64_t                      start_ns;
+    uint64_t                      time_ns = 0;
+    uint32_t                      k;
+
+    bench_scene_create();
+    px_gfx_update_stats_reset();
+    for(k = 0; k < BENCH_COST_FRAMES; k++)
+    {
+        switch(change)
+        {
+        case 0:
+            bench_clock_change(k);
+            break;
+        case 1:
+            bench_val_change();
+            break;
+        case 2:
+            bench_graph_scroll(1);
+            break;
+        case 3:
+            // Graph redrawn completely
+            bench_graph_scroll(1);
+            px_gfx_obj_graph_prop_set(obj_graph, &obj_graph_prop);
+            break;
+        case 4:
+            // Alarm on top of graph: graph can not scroll its pixels
+            px_gfx_obj_visible_set(obj_label_alarm, true);
+            bench_graph_scroll(1);
+            break;
+        case 5:
+            bench_graph_scroll(1);
+            bench_clock_change(k);
+            bench_val_change();
+            break;
+        default:
+            bench_graph_scroll(1);
+            bench_clock_change(k);
+            bench_val_change();
+            px_gfx_obj_update_set(obj_win, true);
+            break;
+        }
+        start_ns = px_host_bench_time_ns();
+        px_gfx_obj_draw(obj_win);
+        time_ns += px_host_bench_time_ns() - start_ns;
+        px_gfx_draw_update();
+    }
+    printf("%-34s %10.1f %8.1f %10.1f %10.1f\n", name,
+           (double)time_ns / BENCH_COST_FRAMES / 1000.0,
+           (double)stats->nr_of_areas / stats->nr_of_updates,
+           (double)stats->nr_of_bytes / BENCH_COST_FRAMES,
+           100.0 * stats->nr_of_bytes / BENCH_COST_FRAMES / frame_bytes);
+}
+
+static void bench_cost(void)
+{
+    const px_gfx_update_stats_t * stats = px_gfx_update_stats_get();
+    uint32_t                      frame_bytes;
+
+    px_gfx_init();
+    px_gfx_draw();
+    frame_bytes = stats->nr_of_bytes_last;
+    printf("%-34s %10s %8s %10s %10s\n", "Change per frame", "draw us", "areas", "bytes", "% of frame");
+    bench_cost_row("Clock",                              0, frame_bytes);
+    bench_cost_row("Value (panel window)",               1, frame_bytes);
+    bench_cost_row("Graph +1 sample (scroll)",           2, frame_bytes);
+    bench_cost_row("Graph +1 sample (complete graph)",   3, frame_bytes);
+    bench_cost_row("Graph +1 sample (alarm on top)",     4, frame_bytes);
+    bench_cost_row("Graph + clock + value",              5, frame_bytes);
+    bench_cost_row("Graph + clock + value (complete)",   6, frame_bytes);
+}
+
+int main(void)
+{
+    printf("px_gfx_obj host test: %dx%d page organised frame buffer, %s\n\n",
+           PX_GFX_DISP_SIZE_X, PX_GFX_DISP_SIZE_Y,
+           PX_GFX_CFG_SPAN ? "span rendering" : "pixel by pixel rendering");
+
+    px_lcd_init();
+
+    bench_view_port_check();
+    printf("Window view port check: OK\n");
+    bench_random_check();
+    printf("Random scene check (%d frames, damage repair vs complete redraw): OK\n\n",
+           BENCH_NR_OF_FRAMES);
+
+    bench_cost();
+
+    return 0;
+}
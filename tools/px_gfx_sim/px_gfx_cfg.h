@@ -35,6 +35,15 @@
 /// Default font
 #define PX_GFX_CFG_DEFAULT_FONT     px_gfx_font_5x7
 
+/// Draw pixel by pixel (simulated display driver does not implement spans)
+#define PX_GFX_CFG_SPAN             0
+
+/// Maximum number of changed areas tracked
+#define PX_GFX_CFG_UPDATE_AREAS     4
+
+/// Simulated frame buffer is row organised
+#define PX_GFX_CFG_UPDATE_ALIGN_Y   1
+
 /* _____DEFINITIONS__________________________________________________________ */
 
 #endif
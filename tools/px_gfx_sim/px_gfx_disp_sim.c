@@ -71,9 +71,26 @@ void px_gfx_disp_buf_pixel(px_gfx_xy_t    x,
     }
 }
 
-void px_gfx_disp_update(const px_gfx_area_t * area)
+void px_gfx_disp_buf_scroll_left(const px_gfx_area_t * area,
+                                 px_gfx_xy_t           nr_of_cols)
+{
+    px_gfx_xy_t y;
+
+    // Move each row; rightmost columns stay as is
+    for(y = area->y1; y <= area->y2; y++)
+    {
+        memmove(&px_gfx_frame_buf[y][area->x1],
+                &px_gfx_frame_buf[y][area->x1 + nr_of_cols],
+                area->x2 - area->x1 + 1 - nr_of_cols);
+    }
+}
+
+size_t px_gfx_disp_update(const px_gfx_area_t * area)
 {
     px_gfx_disp_sim_draw(area);
+
+    // Number of bytes if sent to a 1 bit per pixel display
+    return (area->y2 - area->y1 + 1) * ((area->x2 - area->x1 + 8) / 8);
 }
 
 void px_gfx_disp_log_report_buf(void)
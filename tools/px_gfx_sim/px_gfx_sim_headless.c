@@ -0,0 +1,440 @@
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_gfx_sim_headless.c : Headless (command line) graphics simulator
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/*
+ *  Command line replacement for the MFC dialog (pxGfxSimDlg.cpp) so that the
+ *  px_gfx_test.c scene can be run on a Linux (or any POSIX) host. Build and run
+ *  with:
+ *
+ *      make -C tools/px_gfx_sim run
+ *
+ *  Usage: px_gfx_sim [-n nr_of_frames] [-o out_dir] [-g golden_dir] [-u]
+ *
+ *  1. px_gfx_test_start() is called once and px_gfx_test_update() once per
+ *     frame. The simulated display only receives the areas that px_gfx sends
+ *     with px_gfx_disp_update(), so each frame is checked to be equal to the
+ *     frame buffer (nothing that changed was missed).
+ *  2. Each frame is written to out_dir as a binary PBM image (frame_NNN.pbm)
+ *     and compared with the golden image in golden_dir. A frame that differs
+ *     is reported with the number of pixels and an XOR image
+ *     (frame_NNN_diff.pbm). "-u" writes the frames to golden_dir instead.
+ *  3. The scene only redraws the damaged areas of its object tree. After each
+ *     frame the complete scene is redrawn (px_gfx_test_redraw()) and must
+ *     be the same.
+ *  4. The time per frame, the number of bytes sent to the display
+ *     (px_gfx_update_stats_get()) and the time of a complete redraw are
+ *     reported, followed by the time and bytes per primitive.
+ *
+ *  PBM images can be viewed or converted to PNG with most image tools, e.g.
+ *  "convert frame_000.pbm frame_000.png" (ImageMagick) or "pnmtopng".
+ */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_gfx.h"
+#include "px_gfx_resources.h"
+#include "px_gfx_disp_sim.h"
+#include "px_gfx_test.h"
+#include "px_host_bench.h"
+
+/* _____LOCAL DEFINITIONS____________________________________________________ */
+/// Default number of frames
+#define PX_GFX_SIM_NR_OF_FRAMES     20
+
+/// Maximum path length
+#define PX_GFX_SIM_PATH_SIZE_MAX    256
+
+/// Number of calls for each primitive timing measurement
+#define PX_GFX_SIM_TIMING_CALLS     2000
+
+/* _____MACROS_______________________________________________________________ */
+
+/* _____GLOBAL VARIABLES_____________________________________________________ */
+
+/* _____LOCAL VARIABLES______________________________________________________ */
+/// Simulated display [row(y)][col(x)]; only changed by px_gfx_disp_sim_draw()
+static uint8_t px_gfx_sim_disp[PX_GFX_DISP_SIZE_Y][PX_GFX_DISP_SIZE_X];
+
+/// Golden image read from file
+static uint8_t px_gfx_sim_golden[PX_GFX_DISP_SIZE_Y][PX_GFX_DISP_SIZE_X];
+
+/* _____LOCAL FUNCTION DECLARATIONS__________________________________________ */
+
+/* _____LOCAL FUNCTIONS______________________________________________________ */
+/// Write image as binary PBM (P4); return false if file could not be written
+static bool px_gfx_sim_pbm_wr(const char * path,
+                              uint8_t      img[PX_GFX_DISP_SIZE_Y][PX_GFX_DISP_SIZE_X])
+{
+    FILE *      file;
+    px_gfx_xy_t x;
+    px_gfx_xy_t y;
+    uint8_t     data;
+
+    file = fopen(path, "wb");
+    if(file == NULL)
+    {
+        return false;
+    }
+    fprintf(file, "P4\n%d %d\n", PX_GFX_DISP_SIZE_X, PX_GFX_DISP_SIZE_Y);
+    for(y = 0; y < PX_GFX_DISP_SIZE_Y; y++)
+    {
+        // Rows are padded to whole bytes; MSB is leftmost pixel; 1 is black
+        data = 0;
+        for(x = 0; x < PX_GFX_DISP_SIZE_X; x++)
+        {
+            data <<= 1;
+            if(img[y][x] != 0)
+            {
+                data |= 1;
+            }
+            if((x % 8) == 7)
+            {
+                fputc(data, file);
+                data = 0;
+            }
+        }
+        if((x % 8) != 0)
+        {
+            fputc(data << (8 - (x % 8)), file);
+        }
+    }
+
+    return fclose(file) == 0;
+}
+
+/// Read binary PBM (P4) image; return false if file does not exist or is invalid
+static bool px_gfx_sim_pbm_rd(const char * path,
+                              uint8_t      img[PX_GFX_DISP_SIZE_Y][PX_GFX_DISP_SIZE_X])
+{
+    FILE *      file;
+    int         width;
+    int         height;
+    int         data = 0;
+    px_gfx_xy_t x;
+    px_gfx_xy_t y;
+
+    file = fopen(path, "rb");
+    if(file == NULL)
+    {
+        return false;
+    }
+    // Header (single white space character after height)
+    if(  (fscanf(file, "P4 %d %d", &width, &height) != 2)
+       ||(width != PX_GFX_DISP_SIZE_X) || (height != PX_GFX_DISP_SIZE_Y)
+       ||(fgetc(file) == EOF)  )
+    {
+        fclose(file);
+        return false;
+    }
+    for(y = 0; y < PX_GFX_DISP_SIZE_Y; y++)
+    {
+        for(x = 0; x < PX_GFX_DISP_SIZE_X; x++)
+        {
+            if((x % 8) == 0)
+            {
+                data = fgetc(file);
+                if(data == EOF)
+                {
+                    fclose(file);
+                    return false;
+                }
+            }
+            img[y][x] = (data & (0x80 >> (x % 8))) ? 1 : 0;
+        }
+    }
+    fclose(file);
+
+    return true;
+}
+
+/// Compare frame with golden image; return number of pixels that differ
+static uint32_t px_gfx_sim_diff(uint8_t diff[PX_GFX_DISP_SIZE_Y][PX_GFX_DISP_SIZE_X])
+{
+    px_gfx_xy_t x;
+    px_gfx_xy_t y;
+    uint32_t    nr_of_pixels = 0;
+
+    for(y = 0; y < PX_GFX_DISP_SIZE_Y; y++)
+    {
+        for(x = 0; x < PX_GFX_DISP_SIZE_X; x++)
+        {
+            diff[y][x] = (px_gfx_sim_disp[y][x] != 0) ^ (px_gfx_sim_golden[y][x] != 0);
+            if(diff[y][x])
+            {
+                nr_of_pixels++;
+            }
+        }
+    }
+
+    return nr_of_pixels;
+}
+
+/// Run scene, write frames and compare with golden images; return number of failed frames
+static unsigned px_gfx_sim_run_frames(unsigned     nr_of_frames,
+                                      const char * out_dir,
+                                      const char * golden_dir,
+                                      bool         golden_update)
+{
+    static uint8_t                diff[PX_GFX_DISP_SIZE_Y][PX_GFX_DISP_SIZE_X];
+    static uint8_t                frame_buf[PX_GFX_DISP_SIZE_Y][PX_GFX_DISP_SIZE_X];
+    const px_gfx_update_stats_t * stats = px_gfx_update_stats_get();
+    char                          path[PX_GFX_SIM_PATH_SIZE_MAX];
+    char                          result[PX_GFX_SIM_PATH_SIZE_MAX + 64];
+    unsigned                      nr_of_failed = 0;
+    unsigned                      frame;
+    uint64_t                      time_ns;
+    uint64_t                      redraw_ns;
+    uint32_t                      nr_of_pixels;
+    uint32_t                      nr_of_areas;
+    uint32_t                      frame_bytes;
+    uint32_t                      nr_of_bytes     = 0;
+    uint64_t                      total_ns        = 0;
+    uint64_t                      total_redraw_ns = 0;
+
+    printf("%-6s %10s %8s %8s %10s  %s\n", "Frame", "us", "areas", "bytes", "redraw us", "Result");
+    px_gfx_test_start();
+    for(frame = 0; frame < nr_of_frames; frame++)
+    {
+        // Draw frame
+        px_gfx_update_stats_reset();
+        time_ns   = px_host_bench_time_ns();
+        px_gfx_test_update();
+        time_ns   = px_host_bench_time_ns() - time_ns;
+        total_ns += time_ns;
+        nr_of_areas  = stats->nr_of_areas;
+        frame_bytes  = stats->nr_of_bytes;
+        nr_of_bytes += frame_bytes;
+        // Complete redraw must be the same
+        memcpy(frame_buf, px_gfx_frame_buf, sizeof(frame_buf));
+        redraw_ns        = px_host_bench_time_ns();
+        px_gfx_test_redraw();
+        redraw_ns        = px_host_bench_time_ns() - redraw_ns;
+        total_redraw_ns += redraw_ns;
+
+        // Display must be the same as the frame buffer
+        snprintf(path, sizeof(path), "%s/frame_%03u.pbm", golden_dir, frame);
+        if(memcmp(px_gfx_sim_disp, px_gfx_frame_buf, sizeof(px_gfx_sim_disp)) != 0)
+        {
+            strcpy(result, "FAIL (display not updated)");
+            nr_of_failed++;
+        }
+        else if(memcmp(frame_buf, px_gfx_frame_buf, sizeof(frame_buf)) != 0)
+        {
+            strcpy(result, "FAIL (complete redraw differs)");
+            nr_of_failed++;
+        }
+        else if(golden_update)
+        {
+            if(px_gfx_sim_pbm_wr(path, px_gfx_sim_disp))
+            {
+                strcpy(result, "golden written");
+            }
+            else
+            {
+                strcpy(result, "FAIL (golden not written)");
+                nr_of_failed++;
+            }
+        }
+        else if(!px_gfx_sim_pbm_rd(path, px_gfx_sim_golden))
+        {
+            strcpy(result, "FAIL (no golden)");
+            nr_of_failed++;
+        }
+        else
+        {
+            nr_of_pixels = px_gfx_sim_diff(diff);
+            if(nr_of_pixels == 0)
+            {
+                strcpy(result, "OK");
+            }
+            else
+            {
+                snprintf(path, sizeof(path), "%s/frame_%03u_diff.pbm", out_dir, frame);
+                px_gfx_sim_pbm_wr(path, diff);
+                snprintf(result, sizeof(result), "FAIL (%u pixels differ; see %s)",
+                         (unsigned)nr_of_pixels, path);
+                nr_of_failed++;
+            }
+        }
+        // Write frame
+        snprintf(path, sizeof(path), "%s/frame_%03u.pbm", out_dir, frame);
+        if(!px_gfx_sim_pbm_wr(path, px_gfx_sim_disp))
+        {
+            printf("Could not write %s\n", path);
+            nr_of_failed++;
+        }
+        printf("%-6u %10.1f %8u %8u %10.1f  %s\n", frame, (double)time_ns / 1000.0,
+               (unsigned)nr_of_areas, (unsigned)frame_bytes,
+               (double)redraw_ns / 1000.0, result);
+    }
+    printf("%-6s %10.1f %8s %8.1f %10.1f\n\n", "Avg",
+           (double)total_ns / 1000.0 / nr_of_frames, "",
+           (double)nr_of_bytes / nr_of_frames,
+           (double)total_redraw_ns / 1000.0 / nr_of_frames);
+
+    return nr_of_failed;
+}
+
+/// Draw primitive
+static void px_gfx_sim_prim_draw(int prim, unsigned k)
+{
+    px_gfx_xy_t offset = (px_gfx_xy_t)(k % 16);
+
+    switch(prim)
+    {
+    case 0: px_gfx_draw_fill_fg(0, 0, PX_GFX_DISP_SIZE_X, PX_GFX_DISP_SIZE_Y);            break;
+    case 1: px_gfx_draw_line_hor(0, offset, PX_GFX_DISP_SIZE_X);                          break;
+    case 2: px_gfx_draw_line_ver(offset, 0, PX_GFX_DISP_SIZE_Y);                          break;
+    case 3: px_gfx_draw_line(offset, 0, PX_GFX_X_MAX - offset, PX_GFX_Y_MAX);             break;
+    case 4: px_gfx_draw_rect(offset, offset, 64, 32);                                     break;
+    case 5: px_gfx_draw_circ(PX_GFX_X_MID, PX_GFX_Y_MID, 20 + offset);                    break;
+    case 6: px_gfx_draw_img(offset, 0, &px_gfx_img_dino);                                 break;
+    case 7: px_gfx_font_set(&px_gfx_font_5x7);
+            px_gfx_draw_str(offset, 0, "Hello World!");                                   break;
+    default:
+            px_gfx_font_set(&px_gfx_font_11x14);
+            px_gfx_draw_str(offset, 0, "12:34:56");                                       break;
+    }
+}
+
+/// Report time and bytes sent to display per primitive
+static void px_gfx_sim_run_prims(void)
+{
+    static const char * const names[] =
+    {
+        "Fill screen",
+        "Horizontal line",
+        "Vertical line",
+        "Diagonal line",
+        "Rectangle 64x32",
+        "Circle r=20..35",
+        "Image (dino)",
+        "String 12 chars (5x7)",
+        "String 8 chars (11x14)",
+    };
+    const px_gfx_update_stats_t * stats = px_gfx_update_stats_get();
+    int                           prim;
+    unsigned                      k;
+    uint64_t                      draw_ns;
+    uint64_t                      update_ns;
+    uint64_t                      time_ns;
+    uint32_t                      nr_of_bytes;
+
+    printf("%-24s %10s %10s %10s\n", "Primitive", "draw ns", "update ns", "bytes");
+    for(prim = 0; prim < (int)(sizeof(names) / sizeof(names[0])); prim++)
+    {
+        px_gfx_init();
+        px_gfx_draw();
+        px_gfx_update_stats_reset();
+        draw_ns   = 0;
+        update_ns = 0;
+        for(k = 0; k < PX_GFX_SIM_TIMING_CALLS; k++)
+        {
+            px_gfx_color_fg_set((k & 1) ? PX_GFX_COLOR_OFF : PX_GFX_COLOR_ON);
+            time_ns    = px_host_bench_time_ns();
+            px_gfx_sim_prim_draw(prim, k);
+            draw_ns   += px_host_bench_time_ns() - time_ns;
+            time_ns    = px_host_bench_time_ns();
+            px_gfx_draw_update();
+            update_ns += px_host_bench_time_ns() - time_ns;
+        }
+        nr_of_bytes = stats->nr_of_bytes;
+        printf("%-24s %10.1f %10.1f %10.1f\n", names[prim],
+               (double)draw_ns   / PX_GFX_SIM_TIMING_CALLS,
+               (double)update_ns / PX_GFX_SIM_TIMING_CALLS,
+               (double)nr_of_bytes / PX_GFX_SIM_TIMING_CALLS);
+    }
+    px_gfx_draw_prop_reset();
+}
+
+static void px_gfx_sim_usage(void)
+{
+    printf("Usage: px_gfx_sim [-n nr_of_frames] [-o out_dir] [-g golden_dir] [-u]\n"
+           "  -n  Number of frames (default %u)\n"
+           "  -o  Output directory for frames (default \"frames\")\n"
+           "  -g  Directory with golden images (default \"golden\")\n"
+           "  -u  Write golden images instead of comparing\n",
+           PX_GFX_SIM_NR_OF_FRAMES);
+}
+
+/* _____GLOBAL FUNCTIONS_____________________________________________________ */
+void px_gfx_disp_sim_draw(const px_gfx_area_t * area)
+{
+    px_gfx_xy_t y;
+
+    // Copy area of frame buffer to display
+    for(y = area->y1; y <= area->y2; y++)
+    {
+        memcpy(&px_gfx_sim_disp[y][area->x1],
+               &px_gfx_frame_buf[y][area->x1],
+               area->x2 - area->x1 + 1);
+    }
+}
+
+int main(int argc, char * argv[])
+{
+    unsigned     nr_of_frames  = PX_GFX_SIM_NR_OF_FRAMES;
+    const char * out_dir       = "frames";
+    const char * golden_dir    = "golden";
+    bool         golden_update = false;
+    unsigned     nr_of_failed;
+    int          opt;
+
+    while((opt = getopt(argc, argv, "n:o:g:uh")) != -1)
+    {
+        switch(opt)
+        {
+        case 'n': nr_of_frames  = (unsigned)atoi(optarg); break;
+        case 'o': out_dir       = optarg;                 break;
+        case 'g': golden_dir    = optarg;                 break;
+        case 'u': golden_update = true;                   break;
+        default:
+            px_gfx_sim_usage();
+            return 2;
+        }
+    }
+    if(nr_of_frames == 0)
+    {
+        px_gfx_sim_usage();
+        return 2;
+    }
+    mkdir(out_dir, 0777);
+    if(golden_update)
+    {
+        mkdir(golden_dir, 0777);
+    }
+
+    printf("px_gfx headless simulator: %dx%d, %u frames\n\n",
+           PX_GFX_DISP_SIZE_X, PX_GFX_DISP_SIZE_Y, nr_of_frames);
+    nr_of_failed = px_gfx_sim_run_frames(nr_of_frames, out_dir, golden_dir, golden_update);
+    px_gfx_sim_run_prims();
+
+    if(nr_of_failed != 0)
+    {
+        printf("\n%u frame(s) FAILED\n", nr_of_failed);
+        return 1;
+    }
+
+    return 0;
+}
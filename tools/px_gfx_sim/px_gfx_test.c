@@ -7,18 +7,19 @@
 
 px_gfx_obj_handle_t obj_win;
 px_gfx_obj_handle_t obj_graph;
-px_gfx_xy_t         obj_graph_data_y[128];
+px_gfx_xy_t         obj_graph_data_y[PX_GFX_DISP_SIZE_X];
 px_gfx_obj_handle_t obj_label_val;
 px_gfx_obj_handle_t obj_label_unit;
 char                obj_label_val_str[16];
 float               temp_deg;
+px_gfx_xy_t         sample;
 
 static const px_gfx_obj_graph_prop_t obj_graph_prop = 
 {
     .x        = 0,
-    .y        = 14,
+    .y        = 22,
     .width    = PX_GFX_DISP_SIZE_X,
-    .height   = 50,
+    .height   = 42,
     .color_fg = PX_GFX_COLOR_ON,
     .color_bg = PX_GFX_COLOR_OFF,
     .data_y   = obj_graph_data_y,
@@ -57,6 +58,7 @@ void px_gfx_test_start(void)
     memset(obj_graph_data_y, 0, sizeof(obj_graph_data_y));
     obj_graph_data_y[10] = 10;
     obj_graph_data_y[20] = 20;
+    sample   = 0;
     temp_deg = 0.0;
     sprintf(obj_label_val_str, "%2.1f", temp_deg);
     obj_label_val  = px_gfx_obj_label_create(&obj_label_prop_val);
@@ -72,8 +74,23 @@ void px_gfx_test_update(void)
     // Update value label
     temp_deg += 0.1f;
     sprintf(obj_label_val_str, "%2.1f", temp_deg);
-    px_gfx_obj_update_set(obj_label_val);
-    // Draw window
+    px_gfx_obj_update_set(obj_label_val, true);
+    // Scroll in new graph sample (triangle wave)
+    memmove(&obj_graph_data_y[0], &obj_graph_data_y[1],
+            sizeof(obj_graph_data_y) - sizeof(obj_graph_data_y[0]));
+    sample = (sample + 3) % 80;
+    obj_graph_data_y[PX_GFX_DISP_SIZE_X - 1] = (sample < 40) ? sample : (80 - sample);
+    px_gfx_obj_graph_scroll(obj_graph, 1);
+    // Draw window (only damaged areas are redrawn)
+    px_gfx_obj_draw(obj_win);
+    // Update display
+    px_gfx_draw_update();
+}
+
+void px_gfx_test_redraw(void)
+{
+    // Redraw complete window
+    px_gfx_obj_update_set(obj_win, true);
     px_gfx_obj_draw(obj_win);
     // Update display
     px_gfx_draw_update();
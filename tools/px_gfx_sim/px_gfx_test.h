@@ -10,6 +10,7 @@ extern "C"
 
 void px_gfx_test_start(void);
 void px_gfx_test_update(void);
+void px_gfx_test_redraw(void);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,54 @@
+#ifndef __PX_CRC16_CFG_H__
+#define __PX_CRC16_CFG_H__
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_crc16_cfg.h : 16-bit CRC calculator configuration (host)
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/** 
+ *  @addtogroup PX_CRC16
+ *
+ *  @{
+ */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_defs.h"
+
+/* _____DEFINITIONS__________________________________________________________ */
+#ifndef PX_CRC16_RAM_TABLE
+/// Generate table in RAM to speed up CRC calculation
+#define PX_CRC16_RAM_TABLE  0
+#endif
+
+#ifndef PX_CRC16_ROM_TABLE
+/// Use table in ROM to speed up CRC calculation
+#define PX_CRC16_ROM_TABLE  0
+#endif
+
+#ifndef PX_CRC16_NIBBLE_TABLE
+/// Use 16 entry table in ROM (32 bytes) to process 4 bits at a time
+#define PX_CRC16_NIBBLE_TABLE   0
+#endif
+
+#ifndef PX_CRC16_SLICE_BY
+/// Number of bytes processed per iteration by px_crc16_update_data(): 1, 4 or 8
+#define PX_CRC16_SLICE_BY       1
+#endif
+
+/// @}
+#endif
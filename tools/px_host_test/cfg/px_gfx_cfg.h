@@ -0,0 +1,53 @@
+#ifndef __PX_GFX_CFG_H__
+#define __PX_GFX_CFG_H__
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_gfx_cfg.h : Simple monochrome graphics library config (host)
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_defs.h"
+
+/// Display size X in pixels
+#define PX_GFX_DISP_SIZE_X          128
+
+/// Display size Y in pixels
+#define PX_GFX_DISP_SIZE_Y          64
+
+/// Maximum allocated string size
+#define PX_GFX_CFG_STR_BUFFER_SIZE  32
+
+/// Default font
+#define PX_GFX_CFG_DEFAULT_FONT     px_gfx_font_5x7
+
+#ifndef PX_GFX_CFG_SPAN
+/// Draw fills, lines and images with spans (1) or pixel by pixel (0)
+#define PX_GFX_CFG_SPAN             1
+#endif
+
+#ifndef PX_GFX_CFG_UPDATE_AREAS
+/// Maximum number of changed areas tracked
+#define PX_GFX_CFG_UPDATE_AREAS     4
+#endif
+
+/// Align changed areas to pages of 8 rows
+#define PX_GFX_CFG_UPDATE_ALIGN_Y   8
+
+/* _____DEFINITIONS__________________________________________________________ */
+
+#endif
@@ -0,0 +1,84 @@
+#ifndef __PX_LOG_FS_CFG_H__
+#define __PX_LOG_FS_CFG_H__
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_log_fs_cfg.h : Log file system configuration (host)
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/**
+ *  @addtogroup PX_LOG_FS
+ *
+ *  @{
+ */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_defs.h"
+
+/* _____DEFINITIONS__________________________________________________________ */
+/// Config version
+#define PX_LOG_FS_CFG_VER               2
+
+/// Page size for file system (same as AT25S)
+#define PX_LOG_FS_CFG_PAGE_SIZE         256
+
+/// Erase block size (in pages) for file system (same as AT25S 4 KB block)
+#define PX_LOG_FS_CFG_ERASE_BLOCK_SIZE  8
+
+/// Record data size (total record size = PX_LOG_FS_CFG_REC_DATA_SIZE + 3 bytes overhead)
+#ifndef PX_LOG_FS_CFG_REC_DATA_SIZE
+#define PX_LOG_FS_CFG_REC_DATA_SIZE     13
+#endif
+
+/// Stop writing when full (1) or erase oldest records and continue writing (0)
+#define PX_LOG_FS_CFG_STOP_WR_WHEN_FULL 0
+
+/// Locate first and last page with binary search during px_log_fs_init() (1) or always read all page headers (0)
+#ifndef PX_LOG_FS_CFG_INIT_BIN_SEARCH
+#define PX_LOG_FS_CFG_INIT_BIN_SEARCH   1
+#endif
+
+/// Cache records in RAM and write a page of records at a time (1) or write each record immediately (0)
+#ifndef PX_LOG_FS_CFG_WR_CACHE
+#define PX_LOG_FS_CFG_WR_CACHE          0
+#endif
+
+/// Maximum number of cached records before they are written (0 = cache a whole page of records)
+#ifndef PX_LOG_FS_CFG_WR_CACHE_MAX_REC
+#define PX_LOG_FS_CFG_WR_CACHE_MAX_REC  0
+#endif
+
+/// Store variable size records (1) or fixed size records (0). PX_LOG_FS_CFG_REC_DATA_SIZE is then the maximum record data size
+#ifndef PX_LOG_FS_CFG_REC_VAR_SIZE
+#define PX_LOG_FS_CFG_REC_VAR_SIZE      0
+#endif
+
+/// Store key of first record in each page header to support px_log_fs_rd_seek() (1) or not (0)
+#ifndef PX_LOG_FS_CFG_REC_KEY
+#define PX_LOG_FS_CFG_REC_KEY           0
+#endif
+
+/// Offset of key (px_log_fs_key_t) in record data
+#define PX_LOG_FS_CFG_REC_KEY_OFFSET    0
+
+/// Store erase count of each erase block in header of first page in block (1) or not (0)
+#ifndef PX_LOG_FS_CFG_ERASE_CNT
+#define PX_LOG_FS_CFG_ERASE_CNT         0
+#endif
+
+/// @}
+#endif
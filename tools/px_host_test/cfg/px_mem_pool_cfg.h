@@ -0,0 +1,59 @@
+#ifndef __PX_MEM_POOL_CFG_H__
+#define __PX_MEM_POOL_CFG_H__
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_mem_pool_cfg.h : Memory pool allocator configuration (host)
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/**
+ *  @addtogroup PX_MEM_POOL
+ *
+ *  @{
+ */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+#include <sched.h>
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_defs.h"
+
+/* _____DEFINITIONS__________________________________________________________ */
+#ifndef PX_MEM_POOL_HOST_LOCK
+/// Protect pools with a spin lock so that they can be shared between threads (1) or not (0)
+#define PX_MEM_POOL_HOST_LOCK 1
+#endif
+
+#if PX_MEM_POOL_HOST_LOCK
+/// Spin lock (defined by host test)
+extern volatile bool px_mem_pool_host_lock;
+
+/// Enter critical section before a pool is modified (acquire spin lock)
+#define PX_MEM_POOL_CFG_CRITICAL_ENTER() \
+    while(__atomic_test_and_set(&px_mem_pool_host_lock, __ATOMIC_ACQUIRE)) {sched_yield();}
+
+/// Exit critical section after a pool is modified (release spin lock)
+#define PX_MEM_POOL_CFG_CRITICAL_EXIT() \
+    __atomic_clear(&px_mem_pool_host_lock, __ATOMIC_RELEASE)
+#else
+/// Enter critical section before a pool is modified (nothing to do)
+#define PX_MEM_POOL_CFG_CRITICAL_ENTER()
+
+/// Exit critical section after a pool is modified (nothing to do)
+#define PX_MEM_POOL_CFG_CRITICAL_EXIT()
+#endif
+
+/// @}
+#endif
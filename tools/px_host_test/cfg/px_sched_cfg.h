@@ -0,0 +1,67 @@
+#ifndef __PX_SCHED_CFG_H__
+#define __PX_SCHED_CFG_H__
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_sched_cfg.h : Tickless cooperative scheduler configuration (host)
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/**
+ *  @addtogroup PX_SCHED
+ *
+ *  @{
+ */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_defs.h"
+#include "px_sysclk.h"
+
+/* _____DEFINITIONS__________________________________________________________ */
+/// Minimum number of idle ticks to enter low power mode with PX_SCHED_CFG_SLEEP(); else PX_SCHED_CFG_WAIT() is used
+#define PX_SCHED_CFG_IDLE_TICKS_MIN     2
+
+/// Maximum number of ticks that PX_SCHED_CFG_SLEEP() can sleep
+#define PX_SCHED_CFG_IDLE_TICKS_MAX     (60ul * PX_SYSCLK_CFG_TICKS_PER_SEC)
+
+/// Simulated sleep: advances the tick counter (implemented by the test)
+#define PX_SCHED_CFG_SLEEP(ticks)       px_sched_host_sleep(ticks)
+
+/// Simulated wait for next tick: advances the tick counter (implemented by the test)
+#define PX_SCHED_CFG_WAIT()             px_sched_host_wait()
+
+/// No interrupts on the host
+#define PX_SCHED_CFG_CRITICAL_ENTER()   do { ; } while(0)
+
+/// No interrupts on the host
+#define PX_SCHED_CFG_CRITICAL_EXIT()    do { ; } while(0)
+
+/// Support for RTC alarm tasks (1) or not (0)
+#define PX_SCHED_CFG_RTC                1
+
+/// Simulated RTC derived from the tick counter (implemented by the test)
+#define PX_SCHED_CFG_RTC_SEC_RD()       px_sched_host_rtc_sec_rd()
+
+/// Interval in ticks to poll the RTC during the second before an alarm
+#define PX_SCHED_CFG_RTC_POLL_TICKS     125
+
+/* _____GLOBAL FUNCTION DECLARATIONS_________________________________________ */
+void     px_sched_host_sleep(px_sysclk_ticks_t ticks);
+void     px_sched_host_wait(void);
+uint32_t px_sched_host_rtc_sec_rd(void);
+
+/// @}
+#endif
@@ -0,0 +1,44 @@
+#ifndef __PX_TMR_WHEEL_CFG_H__
+#define __PX_TMR_WHEEL_CFG_H__
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_tmr_wheel_cfg.h : Hierarchical timer wheel configuration (host)
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/**
+ *  @addtogroup PX_TMR_WHEEL
+ *
+ *  @{
+ */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_defs.h"
+
+/* _____DEFINITIONS__________________________________________________________ */
+#ifndef PX_TMR_WHEEL_CFG_SLOT_BITS
+/// Number of bits of the tick counter per level (2^bits slots per level)
+#define PX_TMR_WHEEL_CFG_SLOT_BITS  6
+#endif
+
+#ifndef PX_TMR_WHEEL_CFG_LEVELS
+/// Number of levels (wheels); timers further away are kept in an overflow list
+#define PX_TMR_WHEEL_CFG_LEVELS     4
+#endif
+
+/// @}
+#endif
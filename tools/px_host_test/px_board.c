@@ -0,0 +1,48 @@
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_board.h : Board support (host simulation)
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+#include <time.h>
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_board.h"
+
+/* _____LOCAL FUNCTIONS______________________________________________________ */
+static void px_board_sleep_ns(uint64_t delay_ns)
+{
+    struct timespec ts;
+
+    ts.tv_sec  = delay_ns / 1000000000ull;
+    ts.tv_nsec = delay_ns % 1000000000ull;
+    nanosleep(&ts, NULL);
+}
+
+/* _____GLOBAL FUNCTIONS_____________________________________________________ */
+void px_board_init(void)
+{
+}
+
+void px_board_delay_us(uint16_t delay_us)
+{
+    px_board_sleep_ns((uint64_t)delay_us * 1000ull);
+}
+
+void px_board_delay_ms(uint16_t delay_ms)
+{
+    px_board_sleep_ns((uint64_t)delay_ms * 1000000ull);
+}
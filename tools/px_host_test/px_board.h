@@ -0,0 +1,48 @@
+#ifndef __PX_BOARD_H__
+#define __PX_BOARD_H__
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_board.h : Board support (host simulation)
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/**
+ *  Minimal board support for host (PC) tests of modules that call board
+ *  functions (e.g. px_vt100_init() calls px_board_delay_ms()).
+ */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_defs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/* _____GLOBAL FUNCTION DECLARATIONS_________________________________________ */
+/// Initialise board (nothing to do on host)
+void px_board_init(void);
+
+/// Blocking delay for specified number of microseconds
+void px_board_delay_us(uint16_t delay_us);
+
+/// Blocking delay for specified number of milliseconds
+void px_board_delay_ms(uint16_t delay_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
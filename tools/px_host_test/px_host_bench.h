@@ -0,0 +1,106 @@
+#ifndef __PX_HOST_BENCH_H__
+#define __PX_HOST_BENCH_H__
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_host_bench.h : Host benchmark and test helpers
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/**
+ *  Minimal helpers shared by the host (PC) test and benchmark executables that
+ *  are built with tools/px_host_test/Makefile.
+ */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_defs.h"
+
+/* _____DEFINITIONS__________________________________________________________ */
+
+/* _____MACROS_______________________________________________________________ */
+/// Report failure and exit if expression is false
+#define PX_HOST_CHECK(expression) \
+    do \
+    { \
+        if(!(expression)) \
+        { \
+            printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #expression); \
+            exit(1); \
+        } \
+    } \
+    while(0)
+
+/* _____GLOBAL FUNCTIONS_____________________________________________________ */
+/// Return monotonic time in microseconds
+static inline uint64_t px_host_bench_time_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ull + (uint64_t)ts.tv_nsec / 1000ull;
+}
+
+/// Return monotonic time in nanoseconds
+static inline uint64_t px_host_bench_time_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/// Busy wait for specified number of microseconds
+static inline void px_host_bench_delay_us(uint32_t delay_us)
+{
+    uint64_t start = px_host_bench_time_us();
+
+    while((px_host_bench_time_us() - start) < delay_us)
+    {
+        ;
+    }
+}
+
+/// Return rate per second (0 if no time elapsed)
+static inline double px_host_bench_per_sec(uint64_t count, uint64_t time_us)
+{
+    if(time_us == 0)
+    {
+        return 0.0;
+    }
+    return (double)count * 1000000.0 / (double)time_us;
+}
+
+/// True if px_host_bench_cycles() returns a CPU cycle count
+#if defined(__x86_64__) || defined(__i386__)
+#define PX_HOST_BENCH_HAS_CYCLES 1
+#else
+#define PX_HOST_BENCH_HAS_CYCLES 0
+#endif
+
+/// Return CPU time stamp counter (0 if not supported)
+static inline uint64_t px_host_bench_cycles(void)
+{
+#if PX_HOST_BENCH_HAS_CYCLES
+    return __builtin_ia32_rdtsc();
+#else
+    return 0;
+#endif
+}
+
+#endif
@@ -0,0 +1,82 @@
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_lcd_st7567_jhd12864.h : Headless ST7567 LCD (host simulation)
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+#include <string.h>
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_lcd_st7567_jhd12864.h"
+
+/* _____GLOBAL VARIABLES_____________________________________________________ */
+uint8_t        px_lcd_ram[PX_LCD_NR_OF_PAGES][PX_LCD_NR_OF_COLS];
+px_lcd_stats_t px_lcd_stats;
+
+/* _____LOCAL VARIABLES______________________________________________________ */
+static uint8_t px_lcd_page;
+static uint8_t px_lcd_col;
+
+/* _____GLOBAL FUNCTIONS_____________________________________________________ */
+void px_lcd_init(void)
+{
+    px_lcd_clr();
+    memset(&px_lcd_stats, 0, sizeof(px_lcd_stats));
+}
+
+void px_lcd_clr(void)
+{
+    memset(px_lcd_ram, 0, sizeof(px_lcd_ram));
+    px_lcd_page = 0;
+    px_lcd_col  = 0;
+}
+
+void px_lcd_sel_page(uint8_t page)
+{
+    px_lcd_page = page % PX_LCD_NR_OF_PAGES;
+    px_lcd_stats.nr_of_cmd_bytes += 1;
+}
+
+void px_lcd_sel_col(uint8_t col)
+{
+    px_lcd_col = col;
+    px_lcd_stats.nr_of_cmd_bytes += 2;
+}
+
+void px_lcd_wr_disp_u8(uint8_t data)
+{
+    px_lcd_wr_disp_data(&data, 1);
+}
+
+void px_lcd_wr_disp_data(uint8_t * data, size_t nr_of_bytes)
+{
+    px_lcd_stats.nr_of_wr++;
+    px_lcd_stats.nr_of_data_bytes += nr_of_bytes;
+    while(nr_of_bytes-- != 0)
+    {
+        // Column address stops at last column
+        if(px_lcd_col < PX_LCD_NR_OF_COLS)
+        {
+            px_lcd_ram[px_lcd_page][px_lcd_col++] = *data;
+        }
+        data++;
+    }
+}
+
+bool px_lcd_get_pixel(uint8_t x, uint8_t y)
+{
+    return (px_lcd_ram[y / 8][x] & (1 << (y % 8))) != 0;
+}
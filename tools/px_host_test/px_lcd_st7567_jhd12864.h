@@ -0,0 +1,86 @@
+#ifndef __PX_LCD_ST7567_JHD12864_H__
+#define __PX_LCD_ST7567_JHD12864_H__
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_lcd_st7567_jhd12864.h : Headless ST7567 LCD (host simulation)
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/**
+ *  Headless stand-in for the ST7567 JHD12864 LCD driver so that px_gfx and
+ *  its ST7567 display driver can be tested on a host (PC). Display data is
+ *  written to a simulated display RAM (page organised; 8 vertical pixels per
+ *  byte, LSB at the top) instead of the SPI bus. The number of bytes and
+ *  commands written are counted.
+ */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_defs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/* _____DEFINITIONS__________________________________________________________ */
+/// Number of columns
+#define PX_LCD_NR_OF_COLS        128
+/// Number of rows
+#define PX_LCD_NR_OF_ROWS        64
+/// Number of pages
+#define PX_LCD_NR_OF_PAGES       (PX_LCD_NR_OF_ROWS / 8)
+
+/* _____TYPE DEFINITIONS_____________________________________________________ */
+/// Statistics
+typedef struct
+{
+    uint32_t nr_of_data_bytes;          ///< Number of display data bytes written
+    uint32_t nr_of_cmd_bytes;           ///< Number of page (1 byte) and column (2 bytes) select command bytes
+    uint32_t nr_of_wr;                  ///< Number of display data transfers
+} px_lcd_stats_t;
+
+/* _____GLOBAL VARIABLES_____________________________________________________ */
+/// Simulated display RAM [page][col]
+extern uint8_t        px_lcd_ram[PX_LCD_NR_OF_PAGES][PX_LCD_NR_OF_COLS];
+/// Statistics
+extern px_lcd_stats_t px_lcd_stats;
+
+/* _____GLOBAL FUNCTION DECLARATIONS_________________________________________ */
+/// Initialise simulated LCD (clear display RAM and statistics)
+void px_lcd_init(void);
+
+/// Clear display RAM
+void px_lcd_clr(void);
+
+/// Select page (row of 8 pixels)
+void px_lcd_sel_page(uint8_t page);
+
+/// Select column
+void px_lcd_sel_col(uint8_t col);
+
+/// Write byte to display RAM at current page and column (column advances)
+void px_lcd_wr_disp_u8(uint8_t data);
+
+/// Write bytes to display RAM at current page and column (column advances)
+void px_lcd_wr_disp_data(uint8_t * data, size_t nr_of_bytes);
+
+/// Return pixel in display RAM (true = on)
+bool px_lcd_get_pixel(uint8_t x, uint8_t y);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
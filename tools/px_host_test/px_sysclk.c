@@ -0,0 +1,52 @@
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_sysclk.h : System Clock (host simulation)
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_sysclk.h"
+
+/* _____LOCAL VARIABLES______________________________________________________ */
+/// Simulated clock tick counter
+static px_sysclk_ticks_t px_sysclk_tick_count;
+
+/* _____GLOBAL FUNCTIONS_____________________________________________________ */
+void px_sysclk_init(void)
+{
+    px_sysclk_tick_count = 0;
+}
+
+px_sysclk_ticks_t px_sysclk_get_tick_count(void)
+{
+    return px_sysclk_tick_count;
+}
+
+void px_sysclk_reset_tick_count(void)
+{
+    px_sysclk_tick_count = 0;
+}
+
+void px_sysclk_host_set_tick_count(px_sysclk_ticks_t tick_count)
+{
+    px_sysclk_tick_count = tick_count;
+}
+
+void px_sysclk_host_advance(px_sysclk_ticks_t ticks)
+{
+    px_sysclk_tick_count += ticks;
+}
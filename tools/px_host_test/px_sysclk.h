@@ -0,0 +1,62 @@
+#ifndef __PX_SYSCLK_H__
+#define __PX_SYSCLK_H__
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_sysclk.h : System Clock (host simulation)
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/**
+ *  Simulated system clock for host (PC) tests. The tick counter does not
+ *  advance by itself; a test advances it with px_sysclk_host_advance().
+ */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_defs.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/* _____DEFINITIONS__________________________________________________________ */
+/// The number of system clock ticks per second
+#define PX_SYSCLK_CFG_TICKS_PER_SEC 1000ul
+
+/* _____TYPE DEFINITIONS_____________________________________________________ */
+/// Size definition of the tick counter
+typedef uint32_t px_sysclk_ticks_t;
+
+/* _____GLOBAL FUNCTION DECLARATIONS_________________________________________ */
+/// Start system clock (tick count is reset to 0)
+void px_sysclk_init(void);
+
+/// Return number of ticks since system clock started
+px_sysclk_ticks_t px_sysclk_get_tick_count(void);
+
+/// Reset tick count
+void px_sysclk_reset_tick_count(void);
+
+/// Set tick count (e.g. just before roll-over)
+void px_sysclk_host_set_tick_count(px_sysclk_ticks_t tick_count);
+
+/// Advance tick count by specified number of ticks
+void px_sysclk_host_advance(px_sysclk_ticks_t ticks);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
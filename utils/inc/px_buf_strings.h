@@ -46,6 +46,10 @@
 extern "C" {
 #endif
 /* _____DEFINITIONS__________________________________________________________ */
+#ifndef PX_BUF_STRINGS_CFG_MEM_POOL
+/// px_buf_strings_malloc() allocates buffer from memory pools with px_mem_pool_malloc() (1) or from heap with malloc() (0)
+#define PX_BUF_STRINGS_CFG_MEM_POOL 0
+#endif
 
 /* _____TYPE DEFINITIONS_____________________________________________________ */
 typedef struct
@@ -71,6 +75,9 @@ void px_buf_strings_init(px_buf_strings_t * buf_strings, char * buf, uint16_t bu
 /**
  *  Allocate character buffer on heap and initialise object
  *
+ *  If PX_BUF_STRINGS_CFG_MEM_POOL = 1 then the buffer is allocated from the
+ *  memory pools registered with px_mem_pool_heap_init() instead of the heap.
+ *
  *  @param buf_strings     Pointer to object
  *  @param buf_size        Size of character buffer
  *
@@ -80,7 +87,7 @@ void px_buf_strings_init(px_buf_strings_t * buf_strings, char * buf, uint16_t bu
 bool px_buf_strings_malloc(px_buf_strings_t * buf_strings, uint16_t buf_size);
 
 /**
- *  Free character buffer on heap and clear object
+ *  Free character buffer on heap (or return it to memory pool) and clear object
  *
  *  @param buf_strings     Pointer to object
  */
@@ -37,6 +37,20 @@
  *  Note that the polynomial value is bit reversed and a right shift operator is
  *  used during the calculation.
  *
+ *  Flash (or RAM) can be traded for speed with the following options in
+ *  'px_crc16_cfg.h':
+ *  - No table: 8 shift and XOR steps per byte (smallest)
+ *  - #PX_CRC16_NIBBLE_TABLE: two lookups per byte in a 32 byte ROM table
+ *  - #PX_CRC16_RAM_TABLE or #PX_CRC16_ROM_TABLE: one lookup in a 512 byte
+ *    table per byte
+ *  - #PX_CRC16_SLICE_BY = 4 or 8 (with a RAM or ROM table):
+ *    px_crc16_update_data() processes 4 or 8 bytes per iteration with
+ *    independent lookups in 4 or 8 tables (2 KB or 4 KB).
+ *
+ *  Use px_crc16_update_data() over a whole buffer instead of calling
+ *  px_crc16_update_u8() for each byte so that the faster options apply.
+ *  The host benchmark comms/test/px_hdlc_bench.c compares the options.
+ *
  *  @{
  */
 
@@ -55,8 +69,26 @@
 #error "One or more options not defined in 'px_crc16_cfg.h'"
 #endif
 
-#if (PX_CRC16_RAM_TABLE + PX_CRC16_ROM_TABLE > 1)
-#error "Use either RAM or ROM table option, not both"
+#ifndef PX_CRC16_NIBBLE_TABLE
+/// Use 16 entry table in ROM (32 bytes) to process 4 bits at a time
+#define PX_CRC16_NIBBLE_TABLE   0
+#endif
+
+#ifndef PX_CRC16_SLICE_BY
+/// Number of bytes processed per iteration by px_crc16_update_data(): 1, 4 or 8 (4 and 8 need a RAM or ROM table)
+#define PX_CRC16_SLICE_BY       1
+#endif
+
+#if (PX_CRC16_RAM_TABLE + PX_CRC16_ROM_TABLE + PX_CRC16_NIBBLE_TABLE > 1)
+#error "Use only one of the RAM, ROM or NIBBLE table options"
+#endif
+
+#if ((PX_CRC16_SLICE_BY != 1) && (PX_CRC16_SLICE_BY != 4) && (PX_CRC16_SLICE_BY != 8))
+#error "PX_CRC16_SLICE_BY must be 1, 4 or 8"
+#endif
+
+#if ((PX_CRC16_SLICE_BY > 1) && !(PX_CRC16_RAM_TABLE || PX_CRC16_ROM_TABLE))
+#error "PX_CRC16_SLICE_BY > 1 requires RAM or ROM table option"
 #endif
 
 #ifdef __cplusplus
@@ -36,5 +36,11 @@
 /// Use table in ROM to speed up CRC calculation
 #define PX_CRC16_ROM_TABLE  0
 
+/// Use 16 entry table in ROM (32 bytes) to process 4 bits at a time
+#define PX_CRC16_NIBBLE_TABLE   0
+
+/// Number of bytes processed per iteration by px_crc16_update_data(): 1, 4 or 8 (4 and 8 need a RAM or ROM table)
+#define PX_CRC16_SLICE_BY       1
+
 /// @}
 #endif
@@ -37,6 +37,19 @@
  *  Note that the polynomial value is bit reversed and a right shift operator is
  *  used during the calculation.
  *
+ *  Flash (or RAM) can be traded for speed with the following options in
+ *  'px_crc32_cfg.h':
+ *  - No table: 8 shift and XOR steps per byte (smallest)
+ *  - #PX_CRC32_RAM_TABLE or #PX_CRC32_ROM_TABLE: one lookup in a 1 KB table
+ *    per byte
+ *  - #PX_CRC32_SLICE_BY = 4 or 8 (with a RAM or ROM table):
+ *    px_crc32_update_data() processes 4 or 8 bytes per iteration with
+ *    independent lookups in 4 or 8 tables (4 KB or 8 KB). This shortens the
+ *    dependency chain and is 2 to 4 times faster over large blocks on 32-bit
+ *    CPUs with a cache or fast flash.
+ *
+ *  The host benchmark utils/test/px_crc32_bench.c compares the options.
+ *
  *  @{
  */
 
@@ -59,6 +72,19 @@
 #error "Use either RAM or ROM table option, not both"
 #endif
 
+#ifndef PX_CRC32_SLICE_BY
+/// Number of bytes processed per iteration by px_crc32_update_data(): 1, 4 or 8 (4 and 8 need a RAM or ROM table)
+#define PX_CRC32_SLICE_BY   1
+#endif
+
+#if ((PX_CRC32_SLICE_BY != 1) && (PX_CRC32_SLICE_BY != 4) && (PX_CRC32_SLICE_BY != 8))
+#error "PX_CRC32_SLICE_BY must be 1, 4 or 8"
+#endif
+
+#if ((PX_CRC32_SLICE_BY > 1) && !(PX_CRC32_RAM_TABLE || PX_CRC32_ROM_TABLE))
+#error "PX_CRC32_SLICE_BY > 1 requires RAM or ROM table option"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -36,5 +36,8 @@
 /// Use table in ROM to speed up CRC calculation
 #define PX_CRC32_ROM_TABLE  0
 
+/// Number of bytes processed per iteration by px_crc32_update_data(): 1, 4 or 8 (4 and 8 need a RAM or ROM table)
+#define PX_CRC32_SLICE_BY   1
+
 /// @}
 #endif
@@ -28,6 +28,17 @@
  *  - utils/inc/px_link_list.h
  *  - utils/src/px_link_list.c
  *  
+ *  Items are normally allocated statically by the caller. If
+ *  PX_LINK_LIST_CFG_MEM_POOL = 1 then items can also be allocated from the
+ *  memory pools registered with px_mem_pool_heap_init() with
+ *  px_link_list_item_alloc() and released with px_link_list_item_free().
+ *  
+ *  px_link_list_has_item() searches the list, but px_link_list_item_in_list()
+ *  tests the links of the item in constant time. px_link_list_insert_item_sorted()
+ *  keeps the list sorted with a compare function (e.g. timers sorted by expiry
+ *  time). To find and remove items by key in constant time, see
+ *  @ref PX_LINK_LIST_HASH.
+ *  
  *  @see http://en.wikipedia.org/wiki/Linked_list
  *  
  *  Example:
@@ -63,6 +74,10 @@
 extern "C" {
 #endif
 /* _____DEFINITIONS__________________________________________________________ */
+#ifndef PX_LINK_LIST_CFG_MEM_POOL
+/// Add px_link_list_item_alloc() and px_link_list_item_free() to allocate items from memory pools (1) or not (0)
+#define PX_LINK_LIST_CFG_MEM_POOL 0
+#endif
 
 /* _____TYPE DEFINITIONS_____________________________________________________ */
 /// Link structure that must be at the head of each item in the list
@@ -81,6 +96,18 @@ typedef struct
     size_t                       items_max;     ///< Maximum number of items allowed in list; 0 means no limit
 } px_link_list_t;
 
+/**
+ *  Compare function used by px_link_list_insert_item_sorted().
+ *
+ *  @param item_a   Item A
+ *  @param item_b   Item B
+ *
+ *  @return int     < 0 if item A must be before item B; 0 if the items are
+ *                  equal; > 0 if item A must be after item B
+ */
+typedef int (*px_link_list_cmp_t)(const px_link_list_item_t * item_a,
+                                  const px_link_list_item_t * item_b);
+
 /* _____GLOBAL VARIABLES_____________________________________________________ */
 
 /* _____GLOBAL FUNCTION DECLARATIONS_________________________________________ */
@@ -234,6 +261,25 @@ bool px_link_list_insert_item_after(px_link_list_t *      list,
                                     px_link_list_item_t * item,
                                     px_link_list_item_t * item_pos);
 
+/**
+ *  Insert item in a sorted list.
+ *
+ *  The list is searched from the last item backwards, so an item is inserted
+ *  after items that are equal to it and an item that is not smaller than the
+ *  last item (e.g. a timer with a later expiry time) is appended in constant
+ *  time.
+ *
+ *  @param list         Pointer to the linked list
+ *  @param item         Item to be inserted
+ *  @param cmp          Function to compare two items
+ *
+ *  @retval true        Item has been inserted
+ *  @retval false       List is full
+ */
+bool px_link_list_insert_item_sorted(px_link_list_t *      list,
+                                     px_link_list_item_t * item,
+                                     px_link_list_cmp_t    cmp);
+
 /**
  *  Remove first item from the list
  *   
@@ -276,6 +322,49 @@ void px_link_list_remove_item(px_link_list_t *      list,
 bool px_link_list_has_item(px_link_list_t *      list,
                            px_link_list_item_t * item);
 
+/**
+ *  See if item is in the list without searching the list.
+ *
+ *  An item that is not in a list has no links, so the test takes constant
+ *  time. The item must have been initialised with px_link_list_item_init()
+ *  and may not be in another list.
+ *
+ *  @param list     Pointer to the linked list
+ *  @param item     Pointer to specified item
+ *
+ *  @retval true    Item is in the list
+ *  @retval false   Item is not in the list
+ */
+bool px_link_list_item_in_list(px_link_list_t *      list,
+                               px_link_list_item_t * item);
+
+#if PX_LINK_LIST_CFG_MEM_POOL
+/**
+ *  Allocate and initialise an item from the memory pools.
+ *
+ *  The item is allocated with px_mem_pool_malloc() and must start with a
+ *  px_link_list_item_t link structure.
+ *
+ *  @param list                     Pointer to the linked list
+ *  @param item_size                Size of item (including link structure)
+ *
+ *  @returns px_link_list_item_t *  Pointer to item that is not in the list;
+ *                                  NULL if no block is available.
+ */
+px_link_list_item_t * px_link_list_item_alloc(px_link_list_t * list,
+                                              size_t           item_size);
+
+/**
+ *  Remove item from the list (if it is in the list) and return it to the
+ *  memory pools.
+ *
+ *  @param list     Pointer to the linked list
+ *  @param item     Item allocated with px_link_list_item_alloc()
+ */
+void px_link_list_item_free(px_link_list_t *      list,
+                            px_link_list_item_t * item);
+#endif
+
 /* _____MACROS_______________________________________________________________ */
 
 #ifdef __cplusplus
@@ -0,0 +1,226 @@
+#ifndef __PX_LINK_LIST_HASH_H__
+#define __PX_LINK_LIST_HASH_H__
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_link_list_hash.h : Linked List with hash index
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/**
+ *  @ingroup UTILS
+ *  @defgroup PX_LINK_LIST_HASH px_link_list_hash.h : Linked List with hash index
+ *
+ *  A linked list (@ref PX_LINK_LIST) with a small intrusive hash index to find
+ *  and remove items by key in constant time.
+ *
+ *  File(s):
+ *  - utils/inc/px_link_list_hash.h
+ *  - utils/src/px_link_list_hash.c
+ *  - utils/src/px_link_list.c
+ *
+ *  Each item starts with a px_link_list_hash_item_t structure that holds the
+ *  list links, a unique key and a link to the next item in the same hash
+ *  bucket. The caller provides the array of buckets; the number of buckets must
+ *  be a power of two and should be about the same as the maximum number of
+ *  items so that the bucket chains stay short.
+ *
+ *  Items are inserted and removed with the px_link_list_hash functions so that
+ *  the list and index stay in sync. The list (px_link_list_hash_t::list) can be
+ *  walked with the px_link_list functions, e.g. px_link_list_get_item_first()
+ *  and px_link_list_get_item_next(). Items can be kept in insertion order with
+ *  px_link_list_hash_insert_item_end() or sorted (e.g. timers sorted by expiry
+ *  time) with px_link_list_hash_insert_item_sorted().
+ *
+ *  Example:
+ *
+ *  @code{.c}
+ *  typedef struct
+ *  {
+ *      px_link_list_hash_item_t item;  // Must be first
+ *      uint32_t                 expiry;
+ *  } tmr_t;
+ *
+ *  static px_link_list_hash_t        tmr_list;
+ *  static px_link_list_hash_item_t * tmr_buckets[8];
+ *  static tmr_t                      tmr[8];
+ *
+ *  px_link_list_hash_init(&tmr_list, tmr_buckets, 8, 8);
+ *  px_link_list_hash_insert_item_end(&tmr_list, &tmr[0].item, 42);   // Key = 42
+ *  ...
+ *  tmr_t * t = (tmr_t *)px_link_list_hash_remove_key(&tmr_list, 42);
+ *  @endcode
+ *
+ *  @{
+ */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_defs.h"
+#include "px_link_list.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/* _____DEFINITIONS__________________________________________________________ */
+
+/* _____TYPE DEFINITIONS_____________________________________________________ */
+/// Link structure that must be at the head of each item in the list
+typedef struct px_link_list_hash_item_s
+{
+    px_link_list_item_t               list_item;    ///< Links in list
+    struct px_link_list_hash_item_s * bucket_next;  ///< Pointer to next item in the same bucket
+    uint32_t                          key;          ///< Unique key of item
+} px_link_list_hash_item_t;
+
+/// Linked list with hash index structure
+typedef struct
+{
+    px_link_list_t               list;              ///< Linked list of items
+    px_link_list_hash_item_t **  buckets;           ///< Array of buckets (chains of items with the same hash)
+    uint32_t                     bucket_mask;       ///< Number of buckets - 1
+} px_link_list_hash_t;
+
+/* _____GLOBAL VARIABLES_____________________________________________________ */
+
+/* _____GLOBAL FUNCTION DECLARATIONS_________________________________________ */
+/**
+ *  Initialise a linked list with hash index.
+ *
+ *  @param hash             Pointer to the linked list with hash index
+ *  @param buckets          Array of buckets
+ *  @param nr_of_buckets    Number of buckets (must be a power of two)
+ *  @param max_nr_of_items  Maximum number of items allowed in list; 0 means no
+ *                          limit
+ */
+void px_link_list_hash_init(px_link_list_hash_t *       hash,
+                            px_link_list_hash_item_t ** buckets,
+                            size_t                      nr_of_buckets,
+                            size_t                      max_nr_of_items);
+
+/**
+ *  Initialise an item to indicate that it is not in the list.
+ *
+ *  @param hash     Pointer to the linked list with hash index
+ *  @param item     Pointer to specified item
+ */
+void px_link_list_hash_item_init(px_link_list_hash_t *      hash,
+                                 px_link_list_hash_item_t * item);
+
+/**
+ *  Insert item at the end of the list.
+ *
+ *  @param hash     Pointer to the linked list with hash index
+ *  @param item     Item to be inserted
+ *  @param key      Unique key of item
+ *
+ *  @retval true    Item has been inserted
+ *  @retval false   List is full or an item with the same key is in the list
+ */
+bool px_link_list_hash_insert_item_end(px_link_list_hash_t *      hash,
+                                       px_link_list_hash_item_t * item,
+                                       uint32_t                   key);
+
+/**
+ *  Insert item in a sorted list.
+ *
+ *  @see px_link_list_insert_item_sorted()
+ *
+ *  @param hash     Pointer to the linked list with hash index
+ *  @param item     Item to be inserted
+ *  @param key      Unique key of item
+ *  @param cmp      Function to compare two items
+ *
+ *  @retval true    Item has been inserted
+ *  @retval false   List is full or an item with the same key is in the list
+ */
+bool px_link_list_hash_insert_item_sorted(px_link_list_hash_t *      hash,
+                                          px_link_list_hash_item_t * item,
+                                          uint32_t                   key,
+                                          px_link_list_cmp_t         cmp);
+
+/**
+ *  Find item with specified key.
+ *
+ *  @param hash                         Pointer to the linked list with hash index
+ *  @param key                          Key of item
+ *
+ *  @return px_link_list_hash_item_t *  Pointer to item or NULL if the key is
+ *                                      not in the list
+ */
+px_link_list_hash_item_t * px_link_list_hash_find(px_link_list_hash_t * hash,
+                                                  uint32_t              key);
+
+/**
+ *  See if item is in the list (in constant time).
+ *
+ *  @param hash     Pointer to the linked list with hash index
+ *  @param item     Pointer to specified item
+ *
+ *  @retval true    Item is in the list
+ *  @retval false   Item is not in the list
+ */
+bool px_link_list_hash_has_item(px_link_list_hash_t *      hash,
+                                px_link_list_hash_item_t * item);
+
+/**
+ *  Remove item from the list.
+ *
+ *  @param hash     Pointer to the linked list with hash index
+ *  @param item     Item to be removed from the list
+ */
+void px_link_list_hash_remove_item(px_link_list_hash_t *      hash,
+                                   px_link_list_hash_item_t * item);
+
+/**
+ *  Remove item with specified key from the list.
+ *
+ *  @param hash                         Pointer to the linked list with hash index
+ *  @param key                          Key of item
+ *
+ *  @return px_link_list_hash_item_t *  Pointer to removed item or NULL if the
+ *                                      key is not in the list
+ */
+px_link_list_hash_item_t * px_link_list_hash_remove_key(px_link_list_hash_t * hash,
+                                                        uint32_t              key);
+
+/**
+ *  Remove first item from the list (e.g. timer that expires first).
+ *
+ *  @param hash                         Pointer to the linked list with hash index
+ *
+ *  @return px_link_list_hash_item_t *  Pointer to the (old) first item; NULL
+ *                                      will be returned if the list is empty.
+ */
+px_link_list_hash_item_t * px_link_list_hash_remove_item_first(px_link_list_hash_t * hash);
+
+/**
+ *  Remove last item from the list.
+ *
+ *  @param hash                         Pointer to the linked list with hash index
+ *
+ *  @return px_link_list_hash_item_t *  Pointer to the (old) last item; NULL
+ *                                      will be returned if the list is empty.
+ */
+px_link_list_hash_item_t * px_link_list_hash_remove_item_last(px_link_list_hash_t * hash);
+
+/* _____MACROS_______________________________________________________________ */
+
+#ifdef __cplusplus
+}
+#endif
+
+/// @}
+#endif
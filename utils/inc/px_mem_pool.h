@@ -0,0 +1,231 @@
+#ifndef __PX_MEM_POOL_H__
+#define __PX_MEM_POOL_H__
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_mem_pool.h : Fixed-size block memory pool allocator
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/**
+ *  @ingroup UTILS
+ *  @defgroup PX_MEM_POOL px_mem_pool.h : Fixed-size block memory pool allocator
+ *
+ *  Allocates fixed-size blocks from a static arena in constant time.
+ *
+ *  File(s):
+ *  - utils/inc/px_mem_pool.h
+ *  - utils/inc/px_mem_pool_cfg_template.h
+ *  - utils/src/px_mem_pool.c
+ *
+ *  A pool manages a statically allocated arena that is divided into blocks of
+ *  the same size. Free blocks are linked in a list (the link is stored in the
+ *  free block itself), so px_mem_pool_block_alloc() and
+ *  px_mem_pool_block_free() simply remove and add the first block of the list.
+ *  Because all blocks are the same size, the arena can not fragment, unlike
+ *  the heap (malloc() and free()) on a long-running target.
+ *
+ *  Several pools with increasing block sizes (size classes) can be registered
+ *  with px_mem_pool_heap_init(). px_mem_pool_malloc() then allocates a block
+ *  from the smallest size class that fits (or the next larger class if it is
+ *  empty) and px_mem_pool_free() returns it to the pool that owns it. This is
+ *  used by px_sbuf_malloc() (PX_SBUF_CFG_MEM_POOL = 1) and
+ *  px_buf_strings_malloc() (PX_BUF_STRINGS_CFG_MEM_POOL = 1) instead of the
+ *  heap. Linked list items can be allocated from a pool with
+ *  px_link_list_item_alloc().
+ *
+ *  Each pool keeps a count of used blocks, the high-water mark and the number
+ *  of failed allocations to help size the arena.
+ *
+ *  If pools are used by interrupt handlers, define
+ *  PX_MEM_POOL_CFG_CRITICAL_ENTER() and PX_MEM_POOL_CFG_CRITICAL_EXIT() in
+ *  "px_mem_pool_cfg.h" to disable and restore interrupts while a pool is
+ *  modified.
+ *
+ *  Example:
+ *
+ *  @code{.c}
+ *  // 16 blocks of 32 bytes and 4 blocks of 128 bytes
+ *  static PX_MEM_POOL_ARENA_DECLARE(arena_32,  32,  16);
+ *  static PX_MEM_POOL_ARENA_DECLARE(arena_128, 128, 4);
+ *  static px_mem_pool_t pools[2];
+ *
+ *  px_mem_pool_init(&pools[0], arena_32,  32,  16);
+ *  px_mem_pool_init(&pools[1], arena_128, 128, 4);
+ *  px_mem_pool_heap_init(pools, 2);
+ *
+ *  char * str = px_mem_pool_malloc(20);     // 32 byte block
+ *  px_mem_pool_free(str);
+ *  @endcode
+ *
+ *  @{
+ */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+#include <stddef.h>
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_defs.h"
+
+// Include project specific configuration. See "px_mem_pool_cfg_template.h"
+#include "px_mem_pool_cfg.h"
+
+// Check that all project specific options have been specified in "px_mem_pool_cfg.h"
+#if (   !defined(PX_MEM_POOL_CFG_CRITICAL_ENTER) \
+     || !defined(PX_MEM_POOL_CFG_CRITICAL_EXIT )  )
+#error "One or more options not defined in 'px_mem_pool_cfg.h'"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/* _____DEFINITIONS__________________________________________________________ */
+/// Block size rounded up to a multiple of the size of a pointer (alignment and space for free list link)
+#define PX_MEM_POOL_BLOCK_SIZE(size) \
+    ((((size) + sizeof(void *) - 1) / sizeof(void *)) * sizeof(void *))
+
+/// Declare an arena (with pointer alignment) that holds nr_of_blocks blocks of block_size bytes
+#define PX_MEM_POOL_ARENA_DECLARE(name, block_size, nr_of_blocks) \
+    void * name[(PX_MEM_POOL_BLOCK_SIZE(block_size) / sizeof(void *)) * (nr_of_blocks)]
+
+/* _____TYPE DEFINITIONS_____________________________________________________ */
+/// Free block (link is stored in the block itself)
+typedef struct px_mem_pool_block_s
+{
+    struct px_mem_pool_block_s * next;      ///< Pointer to next free block
+} px_mem_pool_block_t;
+
+/// Memory pool structure
+typedef struct
+{
+    px_mem_pool_block_t * free_list;        ///< List of free blocks
+    uint8_t *             arena_start;      ///< Start of arena
+    uint8_t *             arena_end;        ///< End of arena (one past last block)
+    size_t                block_size;       ///< Size of each block
+    size_t                nr_of_blocks;     ///< Number of blocks in arena
+    size_t                blocks_used;      ///< Number of blocks allocated
+    size_t                blocks_used_max;  ///< Maximum number of blocks allocated (high-water mark)
+    size_t                fail_cnt;         ///< Number of allocations that failed
+} px_mem_pool_t;
+
+/* _____GLOBAL VARIABLES_____________________________________________________ */
+
+/* _____GLOBAL FUNCTION DECLARATIONS_________________________________________ */
+/**
+ *  Initialise a memory pool.
+ *
+ *  @param pool         Pointer to memory pool object
+ *  @param arena        Arena with pointer alignment (at least
+ *                      PX_MEM_POOL_BLOCK_SIZE(block_size) * nr_of_blocks
+ *                      bytes). @see PX_MEM_POOL_ARENA_DECLARE()
+ *  @param block_size   Size of each block (rounded up with
+ *                      PX_MEM_POOL_BLOCK_SIZE())
+ *  @param nr_of_blocks Number of blocks in arena
+ */
+void px_mem_pool_init(px_mem_pool_t * pool,
+                      void *          arena,
+                      size_t          block_size,
+                      size_t          nr_of_blocks);
+
+/**
+ *  Allocate a block from a memory pool.
+ *
+ *  @param pool         Pointer to memory pool object
+ *
+ *  @return void *      Pointer to block or NULL if pool is empty
+ */
+void * px_mem_pool_block_alloc(px_mem_pool_t * pool);
+
+/**
+ *  Return a block to a memory pool.
+ *
+ *  @param pool         Pointer to memory pool object
+ *  @param block        Pointer to block returned by px_mem_pool_block_alloc()
+ *                      (NULL is ignored)
+ */
+void px_mem_pool_block_free(px_mem_pool_t * pool,
+                            void *          block);
+
+/**
+ *  See if a pointer is in the arena of a memory pool.
+ *
+ *  @param pool         Pointer to memory pool object
+ *  @param ptr          Pointer to test
+ *
+ *  @retval true        Pointer is in arena
+ *  @retval false       Pointer is not in arena
+ */
+bool px_mem_pool_has_ptr(const px_mem_pool_t * pool,
+                         const void *          ptr);
+
+/**
+ *  Get number of free blocks in a memory pool.
+ *
+ *  @param pool         Pointer to memory pool object
+ *
+ *  @return size_t      Number of free blocks
+ */
+size_t px_mem_pool_get_blocks_free(const px_mem_pool_t * pool);
+
+/**
+ *  Reset high-water mark and failure count of a memory pool.
+ *
+ *  @param pool         Pointer to memory pool object
+ */
+void px_mem_pool_stats_reset(px_mem_pool_t * pool);
+
+/**
+ *  Register memory pools (size classes) used by px_mem_pool_malloc() and
+ *  px_mem_pool_free().
+ *
+ *  @param pools        Array of initialised memory pools, sorted by block size
+ *                      (smallest first)
+ *  @param nr_of_pools  Number of memory pools in array
+ */
+void px_mem_pool_heap_init(px_mem_pool_t * pools,
+                           size_t          nr_of_pools);
+
+/**
+ *  Allocate a block from the smallest registered memory pool that fits.
+ *
+ *  If the pool is empty, the next larger pool is tried. If no block can be
+ *  allocated, the failure count of the smallest pool that fits is incremented.
+ *
+ *  @param size         Number of bytes required
+ *
+ *  @return void *      Pointer to block or NULL if no block is available
+ */
+void * px_mem_pool_malloc(size_t size);
+
+/**
+ *  Return a block allocated with px_mem_pool_malloc() to the registered memory
+ *  pool that owns it.
+ *
+ *  @param ptr          Pointer to block (NULL is ignored)
+ */
+void px_mem_pool_free(void * ptr);
+
+/**
+ *  Report statistics of each registered memory pool.
+ */
+void px_mem_pool_log_report(void);
+
+/* _____MACROS_______________________________________________________________ */
+
+#ifdef __cplusplus
+}
+#endif
+
+/// @}
+#endif
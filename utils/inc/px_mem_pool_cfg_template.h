@@ -0,0 +1,48 @@
+#ifndef __PX_MEM_POOL_CFG_H__
+#define __PX_MEM_POOL_CFG_H__
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_mem_pool_cfg.h : Memory pool allocator configuration
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/**
+ *  @addtogroup PX_MEM_POOL
+ *
+ *  @{
+ */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_defs.h"
+
+/* _____DEFINITIONS__________________________________________________________ */
+/**
+ *  Enter critical section before a pool is modified.
+ *
+ *  Leave empty if pools are not used by interrupt handlers. Example for ARM
+ *  Cortex-M that saves and restores the interrupt state:
+ *
+ *      #define PX_MEM_POOL_CFG_CRITICAL_ENTER() uint32_t primask = __get_PRIMASK(); px_interrupts_disable()
+ *      #define PX_MEM_POOL_CFG_CRITICAL_EXIT()  __set_PRIMASK(primask)
+ */
+#define PX_MEM_POOL_CFG_CRITICAL_ENTER()
+
+/// Exit critical section after a pool is modified
+#define PX_MEM_POOL_CFG_CRITICAL_EXIT()
+
+/// @}
+#endif
@@ -28,6 +28,25 @@
  *  - utils/inc/px_queue.h
  *  - utils/src/px_queue.c
  *  
+ *  Items can be written and read one at a time (px_queue_wr(), px_queue_rd()) or
+ *  in batches (px_queue_wr_n(), px_queue_rd_n()) with at most two memcpy()
+ *  calls per batch. The oldest items can also be processed in place without
+ *  copying: px_queue_peek_ptr() returns a pointer to the oldest item and the
+ *  number of items that are stored contiguously after it, and
+ *  px_queue_drop_n() removes them once they have been processed.
+ *  
+ *  Concurrency (single producer, single consumer):
+ *  
+ *  A queue may be shared without disabling interrupts between one producer
+ *  (e.g. an interrupt handler) and one consumer (e.g. the main loop). The
+ *  producer calls px_queue_wr() and px_queue_wr_n() and only modifies idx_wr
+ *  and count_wr. The consumer calls px_queue_rd(), px_queue_rd_n(),
+ *  px_queue_peek_ptr(), px_queue_drop_n(), px_queue_discard_oldest() and
+ *  px_queue_flush() and only modifies idx_rd and count_rd. The number of
+ *  items stored is the difference between the free-running counters
+ *  (count_wr - count_rd), so there is no shared counter that is modified by
+ *  both sides.
+ *  
  *  @see https://en.wikipedia.org/wiki/Queue_(abstract_data_type)
  *
  *  @{
@@ -57,7 +76,8 @@ typedef struct
     uint8_t *               buf;        ///< Buffer to hold item data
     px_queue_idx_t          idx_rd;     ///< Read index
     px_queue_idx_t          idx_wr;     ///< Write index
-    volatile px_queue_idx_t item_count; ///< Number of items stored in queue
+    volatile px_queue_idx_t count_rd;   ///< Number of items read (free-running)
+    volatile px_queue_idx_t count_wr;   ///< Number of items written (free-running)
     px_queue_idx_t          items_max;  ///< Maximum number of items that can be stored in queue
     px_queue_item_size_t    item_size;  ///< Size of each item
 } px_queue_t;
@@ -88,7 +108,7 @@ void px_queue_init(px_queue_t *         queue,
  */
 inline bool px_queue_is_empty(px_queue_t * queue)
 {
-    return (queue->item_count == 0);
+    return (queue->count_wr == queue->count_rd);
 }
 
 /** 
@@ -101,7 +121,7 @@ inline bool px_queue_is_empty(px_queue_t * queue)
  */
 inline bool px_queue_is_full(px_queue_t * queue)
 {
-    return (queue->item_count == queue->items_max);
+    return ((px_queue_idx_t)(queue->count_wr - queue->count_rd) == queue->items_max);
 }
 
 /** 
@@ -113,7 +133,7 @@ inline bool px_queue_is_full(px_queue_t * queue)
  */
 inline px_queue_idx_t px_queue_get_item_count(px_queue_t * queue)
 {
-    return (queue->item_count);
+    return (px_queue_idx_t)(queue->count_wr - queue->count_rd);
 }
 
 /**
@@ -142,6 +162,70 @@ bool px_queue_wr(px_queue_t * queue, const void * item_data);
  */
 bool px_queue_rd(px_queue_t * queue, void * item_data);
 
+/**
+ *  Write new items to the queue.
+ *  
+ *  The item data is copied into the array.
+ *  
+ *  @param queue            Pointer to a queue object.
+ *  @param item_data        Pointer to array of items.
+ *  @param nr_of_items      Number of items to write.
+ *  
+ *  @return px_queue_idx_t  The number of items added to the queue, which may
+ *                          be less than the number specified, because the
+ *                          queue is full.
+ */
+px_queue_idx_t px_queue_wr_n(px_queue_t *   queue,
+                             const void *   item_data,
+                             px_queue_idx_t nr_of_items);
+
+/**
+ *  Read the oldest items from the queue.
+ *  
+ *  The item data is copied into the specified buffer.
+ *  
+ *  @param queue            Pointer to a queue object.
+ *  @param item_data        Pointer to item data buffer (must be at least
+ *                          nr_of_items * item_size bytes).
+ *  @param nr_of_items      Maximum number of items to read.
+ *  
+ *  @return px_queue_idx_t  The number of items copied and removed from the
+ *                          queue, which may be less than the number
+ *                          specified, because the queue is empty.
+ */
+px_queue_idx_t px_queue_rd_n(px_queue_t *   queue,
+                             void *         item_data,
+                             px_queue_idx_t nr_of_items);
+
+/**
+ *  Get a pointer to the oldest item in the queue, without removing it.
+ *  
+ *  The items are not copied. The pointer and number of contiguous items are
+ *  valid until the items are removed with px_queue_drop_n(). When the items
+ *  wrap past the end of the array, a second call (after px_queue_drop_n())
+ *  returns the items at the start of the array.
+ *  
+ *  @param queue            Pointer to a queue object.
+ *  @param nr_of_items      Number of items stored contiguously from the
+ *                          returned pointer.
+ *  
+ *  @return void *          Pointer to oldest item or NULL if queue is empty
+ */
+void * px_queue_peek_ptr(px_queue_t *     queue,
+                         px_queue_idx_t * nr_of_items);
+
+/**
+ *  Remove the oldest items from the queue.
+ *  
+ *  @param queue            Pointer to a queue object.
+ *  @param nr_of_items      Number of items to remove.
+ *  
+ *  @return px_queue_idx_t  The number of items removed, which may be less than
+ *                          the number specified, because the queue is empty.
+ */
+px_queue_idx_t px_queue_drop_n(px_queue_t *   queue,
+                               px_queue_idx_t nr_of_items);
+
 /**
  *  Remove oldest item from queue.
  *
@@ -38,6 +38,58 @@
  *  one less than the size of the fixed-size buffer, e.g. if the buffer size is
  *  8 bytes, then a maximum of 7 bytes can be stored.
  *  
+ *  Power of two buffer size (PX_RING_BUF_CFG_POW2 = 1):
+ *  
+ *  The buffer size must be a power of two. The read and write indices are
+ *  free-running (they are never wrapped explicitly) and are masked with
+ *  (buf_size - 1) to get the offset in the buffer. There is no compare per
+ *  byte to wrap an index, the number of bytes stored is simply
+ *  (idx_wr - idx_rd) and the whole buffer can be used, e.g. if the buffer size
+ *  is 8 bytes, then a maximum of 8 bytes can be stored. The largest buffer size
+ *  is half the range of px_ring_buf_idx_t, e.g. 32768 bytes with a 16-bit
+ *  index. Note that in this mode idx_wr and idx_rd are not offsets in the
+ *  buffer.
+ *  
+ *  The index size is selected with PX_RING_BUF_CFG_IDX_SIZE (8, 16 or 32 bits),
+ *  e.g. use a 32-bit index for buffers larger than 64 KB. Both options are
+ *  global and are normally defined in the project Makefile, e.g.
+ *  "-DPX_RING_BUF_CFG_POW2=1 -DPX_RING_BUF_CFG_IDX_SIZE=32".
+ *  
+ *  Concurrency (single producer, single consumer):
+ *  
+ *  A ring buffer may be shared without disabling interrupts (or a lock)
+ *  between exactly one producer and one consumer, e.g. an interrupt handler
+ *  and the main loop, or two threads:
+ *  - Only the producer calls px_ring_buf_wr_u8(), px_ring_buf_wr(),
+ *    px_ring_buf_wr_chunk_reserve() and px_ring_buf_wr_chunk_commit(). Only the
+ *    producer modifies the write index.
+ *  - Only the consumer calls px_ring_buf_rd_u8(), px_ring_buf_rd(),
+ *    px_ring_buf_rd_chunk_get(), px_ring_buf_rd_chunk_consume(),
+ *    px_ring_buf_peek() and px_ring_buf_flush(). Only the consumer modifies the
+ *    read index.
+ *  - px_ring_buf_count_used(), px_ring_buf_count_free(),
+ *    px_ring_buf_is_empty() and px_ring_buf_is_full() may be called by either
+ *    side, but the result is only a snapshot.
+ *  - px_ring_buf_init() must be called before the producer and consumer
+ *    start.
+ *  
+ *  The data is written before the write index is updated, and read before the
+ *  read index is updated, with memory barriers (PX_MEM_BARRIER_RELEASE() and
+ *  PX_MEM_BARRIER_ACQUIRE() in px_compiler.h) so that the CPU or compiler does
+ *  not reorder the accesses. An index is read and written in one access, so
+ *  px_ring_buf_idx_t must not be wider than the CPU's native word size.
+ *  
+ *  Zero-copy access:
+ *  
+ *  The producer can get a pointer to the largest linear block of free space
+ *  with px_ring_buf_wr_chunk_reserve(), fill it directly (e.g. with DMA or a
+ *  parser) and then publish it with px_ring_buf_wr_chunk_commit(). In the same
+ *  way the consumer can get a pointer to the largest linear block of data
+ *  with px_ring_buf_rd_chunk_get() and release it with
+ *  px_ring_buf_rd_chunk_consume() after it has been processed. When a block
+ *  ends at the end of the buffer, a second call returns the block at the
+ *  start of the buffer.
+ *  
  *  Reference:
  *  - http://en.wikipedia.org/wiki/Circular_buffer
  *  
@@ -98,8 +150,30 @@
 extern "C" {
 #endif
 /* _____DEFINITIONS__________________________________________________________ */
+/// Buffer size is a power of two and indices are free-running (1) or any buffer size (0)
+#ifndef PX_RING_BUF_CFG_POW2
+#define PX_RING_BUF_CFG_POW2        0
+#endif
+
+/// Size of ring buffer index in bits (8, 16 or 32)
+#ifndef PX_RING_BUF_CFG_IDX_SIZE
+#define PX_RING_BUF_CFG_IDX_SIZE    16
+#endif
+
+#if (PX_RING_BUF_CFG_POW2 != 0) && (PX_RING_BUF_CFG_POW2 != 1)
+#error "PX_RING_BUF_CFG_POW2 must be 0 or 1"
+#endif
+
 /// Ring buffer index size definition
+#if   (PX_RING_BUF_CFG_IDX_SIZE == 8)
+typedef uint8_t px_ring_buf_idx_t;
+#elif (PX_RING_BUF_CFG_IDX_SIZE == 16)
 typedef uint16_t px_ring_buf_idx_t;
+#elif (PX_RING_BUF_CFG_IDX_SIZE == 32)
+typedef uint32_t px_ring_buf_idx_t;
+#else
+#error "PX_RING_BUF_CFG_IDX_SIZE must be 8, 16 or 32"
+#endif
 
 /* _____TYPE DEFINITIONS_____________________________________________________ */
 /// Ring buffer structure
@@ -107,8 +181,8 @@ typedef struct
 {
     uint8_t *                  buf;         ///< Pointer to fixed-size buffer
     px_ring_buf_idx_t          buf_size;    ///< Size of fixed-size buffer
-    volatile px_ring_buf_idx_t idx_wr;      ///< Index that is next open position to write to in the buffer
-    volatile px_ring_buf_idx_t idx_rd;      ///< Index to the next byte to be read from the buffer
+    volatile px_ring_buf_idx_t idx_wr;      ///< Index that is next open position to write to in the buffer (free-running if PX_RING_BUF_CFG_POW2 = 1)
+    volatile px_ring_buf_idx_t idx_rd;      ///< Index to the next byte to be read from the buffer (free-running if PX_RING_BUF_CFG_POW2 = 1)
 } px_ring_buf_t;
 
 /* _____GLOBAL VARIABLES_____________________________________________________ */
@@ -119,7 +193,8 @@ typedef struct
  *  
  *  @param px_ring_buf          Pointer to the ring buffer object
  *  @param buf                  Fixed-size data buffer
- *  @param buf_size             Fixed-size data buffer size
+ *  @param buf_size             Fixed-size data buffer size (a power of two if
+ *                              PX_RING_BUF_CFG_POW2 = 1)
  */
 void px_ring_buf_init(px_ring_buf_t *   px_ring_buf,
                       uint8_t *         buf,
@@ -214,6 +289,31 @@ px_ring_buf_idx_t px_ring_buf_rd(px_ring_buf_t * px_ring_buf,
                                  void *          data,
                                  size_t          nr_of_bytes);
 
+/**
+ *  Reserve linear chunk of free space in the ring buffer (zero-copy write).
+ *
+ *  The producer writes data directly into the chunk and calls
+ *  px_ring_buf_wr_chunk_commit() to make it available to the consumer.
+ *
+ *  @param px_ring_buf           Pointer to the ring buffer object
+ *  @param[in] nr_of_bytes       Size of chunk to reserve. If 0 return max linear chunk
+ *  @param[out] nr_of_bytes      Size of chunk returned (equal or smaller than requested or max linear chunk)
+ *
+ *  @return uint8_t *            Pointer to start of chunk or NULL if full
+ */
+uint8_t * px_ring_buf_wr_chunk_reserve(px_ring_buf_t * px_ring_buf,
+                                       size_t *        nr_of_bytes);
+
+/**
+ *  Commit data written to a chunk reserved with px_ring_buf_wr_chunk_reserve().
+ *
+ *  @param px_ring_buf           Pointer to the ring buffer object
+ *  @param nr_of_bytes           Number of bytes written (equal or smaller than
+ *                               size of reserved chunk)
+ */
+void px_ring_buf_wr_chunk_commit(px_ring_buf_t * px_ring_buf,
+                                 size_t          nr_of_bytes);
+
 /**
  *  Get linear chunk from the ring buffer, without advancing the read pointer.
  *
@@ -226,6 +326,17 @@ px_ring_buf_idx_t px_ring_buf_rd(px_ring_buf_t * px_ring_buf,
 const uint8_t * px_ring_buf_rd_chunk_get(const px_ring_buf_t * px_ring_buf,
                                          size_t *              nr_of_bytes);
 
+/**
+ *  Release data of a chunk returned by px_ring_buf_rd_chunk_get() (advance the
+ *  read pointer).
+ *
+ *  @param px_ring_buf           Pointer to the ring buffer object
+ *  @param nr_of_bytes           Number of bytes processed (equal or smaller
+ *                               than size of chunk)
+ */
+void px_ring_buf_rd_chunk_consume(px_ring_buf_t * px_ring_buf,
+                                  size_t          nr_of_bytes);
+
 /**
  *  Peek data from the ring buffer, without advancing the read pointer.
  *
@@ -252,7 +363,8 @@ px_ring_buf_idx_t px_ring_buf_count_used(px_ring_buf_t * px_ring_buf);
 /**
  *  Get number of free bytes available in buffer.
  *
- *  Note: an empty buffer has one less byte than the buffer size
+ *  Note: an empty buffer has one less byte than the buffer size (the same
+ *  number of bytes if PX_RING_BUF_CFG_POW2 = 1)
  *
  *  @param px_ring_buf          Pointer to the ring buffer object
  *  @return px_ring_buf_idx_t   Number of bytes available in the buffer
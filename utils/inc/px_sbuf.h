@@ -48,6 +48,10 @@
 extern "C" {
 #endif
 /* _____DEFINITIONS__________________________________________________________ */
+#ifndef PX_SBUF_CFG_MEM_POOL
+/// px_sbuf_malloc() allocates buffer from memory pools with px_mem_pool_malloc() (1) or from heap with malloc() (0)
+#define PX_SBUF_CFG_MEM_POOL 0
+#endif
 
 /* _____TYPE DEFINITIONS_____________________________________________________ */
 typedef struct
@@ -72,6 +76,9 @@ void px_sbuf_init(px_sbuf_t * sbuf, char * buf, size_t buf_size);
 /**
  *  Allocate buffer on heap and initialise safe buffer
  *
+ *  If PX_SBUF_CFG_MEM_POOL = 1 then the buffer is allocated from the memory
+ *  pools registered with px_mem_pool_heap_init() instead of the heap.
+ *
  *  @param sbuf     Pointer to safe buffer object
  *  @param buf_size Size of character buffer
  *
@@ -81,7 +88,7 @@ void px_sbuf_init(px_sbuf_t * sbuf, char * buf, size_t buf_size);
 bool px_sbuf_malloc(px_sbuf_t * sbuf, size_t buf_size);
 
 /**
- *  Free buffer on heap and clear safe buffer
+ *  Free buffer on heap (or return it to memory pool) and clear safe buffer
  *
  *  @param sbuf     Pointer to safe buffer object
  */
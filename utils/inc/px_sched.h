@@ -0,0 +1,271 @@
+#ifndef __PX_SCHED_H__
+#define __PX_SCHED_H__
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_sched.h : Tickless cooperative scheduler
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/**
+ *  @ingroup UTILS
+ *  @defgroup PX_SCHED px_sched.h : Tickless cooperative scheduler
+ *
+ *  Runs cooperative tasks and sleeps until the next deadline.
+ *
+ *  File(s):
+ *  - utils/inc/px_sched.h
+ *  - utils/inc/px_sched_cfg_template.h
+ *  - utils/src/px_sched.c
+ *
+ *  A task is a function that runs to completion. It runs when its
+ *  @ref PX_SYSTMR timer expires, when it is signalled (e.g. by an interrupt
+ *  handler with px_sched_task_signal()) or when the RTC reaches its alarm time
+ *  (PX_SCHED_CFG_RTC = 1). A periodic task restarts its own timer, e.g. with
+ *  px_systmr_reset().
+ *
+ *  px_sched_ticks_to_next_deadline() calculates the number of ticks until the
+ *  first task timer, RTC alarm or other application px_systmr_t timer
+ *  registered with px_sched_systmr_register() expires. When no task is ready,
+ *  px_sched_idle() calls PX_SCHED_CFG_SLEEP() to suppress the system clock
+ *  tick interrupt and sleep (e.g. STM32 STOP mode with an LPTIM wake-up) for
+ *  that long. PX_SCHED_CFG_SLEEP() adds the ticks that have elapsed to the
+ *  system clock tick count on wake-up, so that px_systmr timers stay correct.
+ *  See px_sysclk_sleep() of @ref STM32_SYSCLK (PX_SYSCLK_CFG_TICKLESS = 1).
+ *
+ *  The scheduler does not depend on the platform; the sleep, wait, critical
+ *  section and RTC functions are specified in "px_sched_cfg.h". This allows the
+ *  deadline calculation to be tested on a host with a simulated clock.
+ *
+ *  The RTC only has a resolution of one second, so the scheduler sleeps until
+ *  the second before an RTC alarm and then polls the RTC every
+ *  PX_SCHED_CFG_RTC_POLL_TICKS ticks. An alarm task thus runs at most
+ *  PX_SCHED_CFG_RTC_POLL_TICKS ticks after the alarm second has started.
+ *
+ *  Example:
+ *
+ *  @code{.c}
+ *  static px_sched_task_t task_led;
+ *
+ *  static void task_led_fn(px_sched_task_t * task)
+ *  {
+ *      PX_USR_LED_TOGGLE();
+ *      // Run again 500 ms after previous deadline
+ *      px_systmr_reset(&task->tmr);
+ *  }
+ *
+ *  px_sched_init();
+ *  px_sched_task_add(&task_led, task_led_fn, NULL);
+ *  px_sched_task_start(&task_led, PX_SYSTMR_MS_TO_TICKS(500));
+ *  while(true)
+ *  {
+ *      if(!px_sched_run())
+ *      {
+ *          px_sched_idle();
+ *      }
+ *  }
+ *  @endcode
+ *
+ *  @{
+ */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_defs.h"
+#include "px_link_list.h"
+#include "px_systmr.h"
+
+// Include project specific configuration. See "px_sched_cfg_template.h"
+#include "px_sched_cfg.h"
+
+// Check that all project specific options have been specified in "px_sched_cfg.h"
+#if (   !defined(PX_SCHED_CFG_IDLE_TICKS_MIN ) \
+     || !defined(PX_SCHED_CFG_IDLE_TICKS_MAX ) \
+     || !defined(PX_SCHED_CFG_SLEEP          ) \
+     || !defined(PX_SCHED_CFG_WAIT           ) \
+     || !defined(PX_SCHED_CFG_CRITICAL_ENTER ) \
+     || !defined(PX_SCHED_CFG_CRITICAL_EXIT  ) \
+     || !defined(PX_SCHED_CFG_RTC            ) \
+     || !defined(PX_SCHED_CFG_RTC_SEC_RD     ) \
+     || !defined(PX_SCHED_CFG_RTC_POLL_TICKS )  )
+#error "One or more options not defined in 'px_sched_cfg.h'"
+#endif
+
+#if PX_SCHED_CFG_RTC
+#include "px_rtc_util.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/* _____DEFINITIONS__________________________________________________________ */
+/// Value returned by px_sched_ticks_to_next_deadline() if there is no deadline
+#define PX_SCHED_TICKS_INFINITE ((px_systmr_ticks_t)~(px_systmr_ticks_t)0)
+
+/* _____TYPE DEFINITIONS_____________________________________________________ */
+struct px_sched_task_s;
+
+/**
+ *  Task function.
+ *
+ *  @param task     Pointer to task
+ */
+typedef void (*px_sched_task_fn_t)(struct px_sched_task_s * task);
+
+/// Task
+typedef struct px_sched_task_s
+{
+    px_link_list_item_t    list_item;   ///< Link in task list
+    px_sched_task_fn_t     fn;          ///< Task function
+    void *                 arg;         ///< User argument
+    px_systmr_t            tmr;         ///< Task runs when timer expires
+    volatile bool          signal;      ///< Task runs when signalled
+#if PX_SCHED_CFG_RTC
+    bool                   alarm;       ///< RTC alarm enabled
+    px_rtc_sec_since_y2k_t alarm_sec;   ///< Task runs when RTC reaches this time
+#endif
+} px_sched_task_t;
+
+/// Application timer that must wake the scheduler when it expires
+typedef struct
+{
+    px_link_list_item_t list_item;      ///< Link in timer list
+    px_systmr_t *       systmr;         ///< Application timer
+} px_sched_systmr_t;
+
+/* _____GLOBAL VARIABLES_____________________________________________________ */
+
+/* _____GLOBAL FUNCTION DECLARATIONS_________________________________________ */
+/**
+ *  Initialise scheduler.
+ */
+void px_sched_init(void);
+
+/**
+ *  Add a task (timer stopped and not signalled).
+ *
+ *  @param task     Pointer to task
+ *  @param fn       Task function
+ *  @param arg      User argument (task->arg)
+ */
+void px_sched_task_add(px_sched_task_t *  task,
+                       px_sched_task_fn_t fn,
+                       void *             arg);
+
+/**
+ *  Remove a task.
+ *
+ *  @param task     Pointer to task
+ */
+void px_sched_task_remove(px_sched_task_t * task);
+
+/**
+ *  Start task timer; task runs after the specified delay.
+ *
+ *  @param task             Pointer to task
+ *  @param delay_in_ticks   Delay in ticks
+ */
+void px_sched_task_start(px_sched_task_t * task,
+                         px_systmr_ticks_t delay_in_ticks);
+
+/**
+ *  Stop task timer.
+ *
+ *  @param task     Pointer to task
+ */
+void px_sched_task_stop(px_sched_task_t * task);
+
+/**
+ *  Signal a task so that it runs as soon as possible (may be called from an
+ *  interrupt handler).
+ *
+ *  @param task     Pointer to task
+ */
+void px_sched_task_signal(px_sched_task_t * task);
+
+#if PX_SCHED_CFG_RTC
+/**
+ *  Set RTC alarm of a task; task runs when RTC time reaches the alarm time.
+ *
+ *  @param task         Pointer to task
+ *  @param alarm_sec    Alarm time in seconds since Y2K
+ */
+void px_sched_task_alarm_set(px_sched_task_t *      task,
+                             px_rtc_sec_since_y2k_t alarm_sec);
+
+/**
+ *  Clear RTC alarm of a task.
+ *
+ *  @param task     Pointer to task
+ */
+void px_sched_task_alarm_clear(px_sched_task_t * task);
+#endif
+
+/**
+ *  Register an application timer that is polled elsewhere so that the
+ *  scheduler wakes up when it expires.
+ *
+ *  The scheduler wakes up once when the timer expires. While the timer stays
+ *  expired (it is not restarted or stopped after px_systmr_has_expired() has
+ *  returned true), it does not prevent the scheduler from sleeping.
+ *
+ *  @param sched_systmr     Pointer to registration object
+ *  @param systmr           Pointer to application timer
+ */
+void px_sched_systmr_register(px_sched_systmr_t * sched_systmr,
+                              px_systmr_t *       systmr);
+
+/**
+ *  Unregister an application timer.
+ *
+ *  @param sched_systmr     Pointer to registration object
+ */
+void px_sched_systmr_unregister(px_sched_systmr_t * sched_systmr);
+
+/**
+ *  Run each task that is ready once.
+ *
+ *  @retval true    One or more tasks have run
+ *  @retval false   No task was ready
+ */
+bool px_sched_run(void);
+
+/**
+ *  Calculate number of ticks until the next deadline.
+ *
+ *  @return px_systmr_ticks_t   0 if a task is ready (or an application timer
+ *                              has expired); PX_SCHED_TICKS_INFINITE if there
+ *                              is no deadline.
+ */
+px_systmr_ticks_t px_sched_ticks_to_next_deadline(void);
+
+/**
+ *  Sleep until the next deadline or an interrupt occurs.
+ *
+ *  Uses PX_SCHED_CFG_SLEEP() if the next deadline is at least
+ *  PX_SCHED_CFG_IDLE_TICKS_MIN ticks away (limited to
+ *  PX_SCHED_CFG_IDLE_TICKS_MAX), else PX_SCHED_CFG_WAIT(). Returns immediately
+ *  if a task is ready.
+ */
+void px_sched_idle(void);
+
+/* _____MACROS_______________________________________________________________ */
+
+#ifdef __cplusplus
+}
+#endif
+
+/// @}
+#endif
@@ -0,0 +1,70 @@
+#ifndef __PX_SCHED_CFG_H__
+#define __PX_SCHED_CFG_H__
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_sched_cfg.h : Tickless cooperative scheduler configuration
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/**
+ *  @addtogroup PX_SCHED
+ *
+ *  @{
+ */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_defs.h"
+#include "px_sysclk.h"
+#include "px_compiler.h"
+
+/* _____DEFINITIONS__________________________________________________________ */
+/// Minimum number of idle ticks to enter low power mode with PX_SCHED_CFG_SLEEP(); else PX_SCHED_CFG_WAIT() is used
+#define PX_SCHED_CFG_IDLE_TICKS_MIN     2
+
+/// Maximum number of ticks that PX_SCHED_CFG_SLEEP() can sleep
+#define PX_SCHED_CFG_IDLE_TICKS_MAX     PX_SYSCLK_SLEEP_TICKS_MAX
+
+/**
+ *  Sleep for up to the specified number of ticks.
+ *
+ *  Must suppress the system clock tick interrupt, wake up after the specified
+ *  number of ticks (or earlier on any other interrupt) and add the ticks that
+ *  have elapsed to the system clock tick count. Called with interrupts
+ *  disabled.
+ */
+#define PX_SCHED_CFG_SLEEP(ticks)       px_sysclk_sleep(ticks)
+
+/// Wait for an interrupt (e.g. next system clock tick); called with interrupts disabled
+#define PX_SCHED_CFG_WAIT()             __WFI()
+
+/// Disable interrupts before the scheduler decides to sleep (so that a task signal from an ISR is not missed)
+#define PX_SCHED_CFG_CRITICAL_ENTER()   px_interrupts_disable()
+
+/// Enable interrupts after the scheduler has slept
+#define PX_SCHED_CFG_CRITICAL_EXIT()    px_interrupts_enable()
+
+/// Support for RTC alarm tasks (1) or not (0)
+#define PX_SCHED_CFG_RTC                0
+
+/// Return RTC time in seconds since Y2K (if PX_SCHED_CFG_RTC = 1)
+#define PX_SCHED_CFG_RTC_SEC_RD()       px_rtc_util_sec_since_y2k_rd()
+
+/// Interval in ticks to poll the RTC during the second before an alarm (if PX_SCHED_CFG_RTC = 1)
+#define PX_SCHED_CFG_RTC_POLL_TICKS     PX_SYSTMR_MS_TO_TICKS(125)
+
+/// @}
+#endif
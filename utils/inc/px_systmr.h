@@ -38,6 +38,10 @@
  *  return a counter that is incremented with every system clock tick. The
  *  number of ticks per second (Hz) is defined with #PX_SYSTMR_TICKS_PER_SEC.
  *  
+ *  If an application has many timers, see @ref PX_TMR_WHEEL. It calls a
+ *  function when a timer expires (without polling each timer) and returns the
+ *  number of ticks that the main loop may sleep.
+ *  
  *  Example:
  *  
  *  @include utils/test/px_systmr_test.c
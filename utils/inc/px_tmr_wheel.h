@@ -0,0 +1,252 @@
+#ifndef __PX_TMR_WHEEL_H__
+#define __PX_TMR_WHEEL_H__
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_tmr_wheel.h : Hierarchical timer wheel
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/**
+ *  @ingroup UTILS
+ *  @defgroup PX_TMR_WHEEL px_tmr_wheel.h : Hierarchical timer wheel
+ *
+ *  Software timers that call a function when they expire, serviced in
+ *  constant time per clock tick.
+ *
+ *  File(s):
+ *  - utils/inc/px_tmr_wheel.h
+ *  - utils/inc/px_tmr_wheel_cfg_template.h
+ *  - utils/src/px_tmr_wheel.c
+ *
+ *  Each @ref PX_SYSTMR timer must be polled to see if it has expired. With many
+ *  timers the main loop spends time checking each one and can not tell how
+ *  long it may sleep. This module keeps running timers in a hierarchical timer
+ *  wheel: level 0 has one slot (list of timers) for each of the next
+ *  2^PX_TMR_WHEEL_CFG_SLOT_BITS ticks, level 1 has one slot for each of the
+ *  next 2^PX_TMR_WHEEL_CFG_SLOT_BITS level 0 rotations, etc. Timers further
+ *  away than all of the levels are kept in an overflow list.
+ *
+ *  px_tmr_wheel_service() must be called regularly (e.g. in the main loop).
+ *  For each clock tick that has elapsed, it calls the expiry function of each
+ *  timer in the level 0 slot of that tick. When level 0 wraps, the timers in
+ *  the next slot of level 1 are moved to the lower level, etc. Starting and
+ *  stopping a timer takes constant time and servicing a tick takes constant
+ *  time amortised over all ticks.
+ *
+ *  px_tmr_wheel_ticks_to_next_expiry() returns the number of ticks until the
+ *  first timer expires so that the main loop can sleep (e.g. STM32 stop mode
+ *  with a wake-up timer) for exactly that long.
+ *
+ *  The wheel uses px_sysclk_get_tick_count() as time base (see
+ *  @ref PX_SYSTMR). A timer delay must be less than half of the tick counter
+ *  range. Each level uses 2^PX_TMR_WHEEL_CFG_SLOT_BITS linked lists (see
+ *  @ref PX_LINK_LIST), so the RAM use of the wheel is
+ *  PX_TMR_WHEEL_CFG_LEVELS * 2^PX_TMR_WHEEL_CFG_SLOT_BITS * sizeof(px_link_list_t).
+ *
+ *  Example:
+ *
+ *  @code{.c}
+ *  static px_tmr_wheel_t     tmr_wheel;
+ *  static px_tmr_wheel_tmr_t tmr_led;
+ *
+ *  static void led_on_expire(px_tmr_wheel_tmr_t * tmr)
+ *  {
+ *      // Toggle LED...
+ *  }
+ *
+ *  px_tmr_wheel_init(&tmr_wheel);
+ *  px_tmr_wheel_tmr_init(&tmr_led, led_on_expire, NULL);
+ *  px_tmr_wheel_start_periodic(&tmr_wheel, &tmr_led, PX_SYSTMR_MS_TO_TICKS(500));
+ *  while(true)
+ *  {
+ *      px_tmr_wheel_service(&tmr_wheel);
+ *      // Sleep until next timer expires (or interrupt occurs)
+ *      sleep(px_tmr_wheel_ticks_to_next_expiry(&tmr_wheel));
+ *  }
+ *  @endcode
+ *
+ *  @{
+ */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_defs.h"
+#include "px_link_list.h"
+#include "px_systmr.h"
+
+// Include project specific configuration. See "px_tmr_wheel_cfg_template.h"
+#include "px_tmr_wheel_cfg.h"
+
+// Check that all project specific options have been specified in "px_tmr_wheel_cfg.h"
+#if (   !defined(PX_TMR_WHEEL_CFG_SLOT_BITS) \
+     || !defined(PX_TMR_WHEEL_CFG_LEVELS   )  )
+#error "One or more options not defined in 'px_tmr_wheel_cfg.h'"
+#endif
+
+#if ((PX_TMR_WHEEL_CFG_SLOT_BITS * PX_TMR_WHEEL_CFG_LEVELS) > 32)
+#error "PX_TMR_WHEEL_CFG_SLOT_BITS * PX_TMR_WHEEL_CFG_LEVELS must be 32 or less"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/* _____DEFINITIONS__________________________________________________________ */
+/// Number of slots per level
+#define PX_TMR_WHEEL_SLOTS              (1u << PX_TMR_WHEEL_CFG_SLOT_BITS)
+
+/// Value returned by px_tmr_wheel_ticks_to_next_expiry() if no timer is running
+#define PX_TMR_WHEEL_TICKS_INFINITE     ((px_systmr_ticks_t)~(px_systmr_ticks_t)0)
+
+/* _____TYPE DEFINITIONS_____________________________________________________ */
+struct px_tmr_wheel_tmr_s;
+
+/**
+ *  Function that will be called when a timer expires.
+ *
+ *  The function may start or stop any timer (including this one).
+ *
+ *  @param tmr  Pointer to the timer that expired
+ */
+typedef void (*px_tmr_wheel_on_expire_t)(struct px_tmr_wheel_tmr_s * tmr);
+
+/// Timer
+typedef struct px_tmr_wheel_tmr_s
+{
+    px_link_list_item_t      list_item;     ///< Link in slot list
+    px_link_list_t *         slot;          ///< Slot list that timer is in; NULL if timer is stopped
+    px_systmr_ticks_t        expiry_tick;   ///< Tick when timer expires
+    px_systmr_ticks_t        period;        ///< Period in ticks for a periodic timer; 0 for a one shot timer
+    px_tmr_wheel_on_expire_t on_expire;     ///< Function to call when timer expires
+    void *                   arg;           ///< User argument
+} px_tmr_wheel_tmr_t;
+
+/// Timer wheel
+typedef struct
+{
+    px_link_list_t    slot[PX_TMR_WHEEL_CFG_LEVELS][PX_TMR_WHEEL_SLOTS];  ///< Slot lists of each level
+    px_link_list_t    overflow;     ///< Timers that expire after the last level
+    px_link_list_t    expired;      ///< Timers that are busy expiring
+    px_systmr_ticks_t tick;         ///< Next tick to service
+} px_tmr_wheel_t;
+
+/* _____GLOBAL VARIABLES_____________________________________________________ */
+
+/* _____GLOBAL FUNCTION DECLARATIONS_________________________________________ */
+/**
+ *  Initialise a timer wheel.
+ *
+ *  @param wheel        Pointer to timer wheel
+ */
+void px_tmr_wheel_init(px_tmr_wheel_t * wheel);
+
+/**
+ *  Initialise a timer (stopped).
+ *
+ *  @param tmr          Pointer to timer
+ *  @param on_expire    Function to call when timer expires
+ *  @param arg          User argument (tmr->arg)
+ */
+void px_tmr_wheel_tmr_init(px_tmr_wheel_tmr_t *     tmr,
+                           px_tmr_wheel_on_expire_t on_expire,
+                           void *                   arg);
+
+/**
+ *  Start (or restart) a one shot timer.
+ *
+ *  @param wheel            Pointer to timer wheel
+ *  @param tmr              Pointer to timer
+ *  @param delay_in_ticks   Delay in ticks from the current tick
+ */
+void px_tmr_wheel_start(px_tmr_wheel_t *     wheel,
+                        px_tmr_wheel_tmr_t * tmr,
+                        px_systmr_ticks_t    delay_in_ticks);
+
+/**
+ *  Start (or restart) a one shot timer that expires on the specified tick.
+ *
+ *  A timer with a deadline that has already passed expires on the next call
+ *  to px_tmr_wheel_service().
+ *
+ *  @param wheel            Pointer to timer wheel
+ *  @param tmr              Pointer to timer
+ *  @param expiry_tick      Tick on which timer expires
+ */
+void px_tmr_wheel_start_at(px_tmr_wheel_t *     wheel,
+                           px_tmr_wheel_tmr_t * tmr,
+                           px_systmr_ticks_t    expiry_tick);
+
+/**
+ *  Start (or restart) a periodic timer.
+ *
+ *  The timer is restarted from its previous expiry tick (not the tick on
+ *  which it was serviced), so the frequency does not drift over time.
+ *
+ *  @param wheel            Pointer to timer wheel
+ *  @param tmr              Pointer to timer
+ *  @param period_in_ticks  Period in ticks (must not be 0)
+ */
+void px_tmr_wheel_start_periodic(px_tmr_wheel_t *     wheel,
+                                 px_tmr_wheel_tmr_t * tmr,
+                                 px_systmr_ticks_t    period_in_ticks);
+
+/**
+ *  Stop a timer.
+ *
+ *  @param wheel            Pointer to timer wheel
+ *  @param tmr              Pointer to timer
+ */
+void px_tmr_wheel_stop(px_tmr_wheel_t *     wheel,
+                       px_tmr_wheel_tmr_t * tmr);
+
+/**
+ *  See if a timer is running.
+ *
+ *  @param tmr              Pointer to timer
+ *
+ *  @retval true            Timer is running
+ *  @retval false           Timer is stopped (or one shot timer has expired)
+ */
+bool px_tmr_wheel_is_running(const px_tmr_wheel_tmr_t * tmr);
+
+/**
+ *  Call the expiry function of each timer that has expired since the previous
+ *  call.
+ *
+ *  @param wheel            Pointer to timer wheel
+ */
+void px_tmr_wheel_service(px_tmr_wheel_t * wheel);
+
+/**
+ *  Return the number of ticks from the current tick until the first timer
+ *  expires.
+ *
+ *  @param wheel                Pointer to timer wheel
+ *
+ *  @return px_systmr_ticks_t   Number of ticks (0 if a timer has already
+ *                              expired and px_tmr_wheel_service() must be
+ *                              called); PX_TMR_WHEEL_TICKS_INFINITE if no timer
+ *                              is running.
+ */
+px_systmr_ticks_t px_tmr_wheel_ticks_to_next_expiry(px_tmr_wheel_t * wheel);
+
+/* _____MACROS_______________________________________________________________ */
+
+#ifdef __cplusplus
+}
+#endif
+
+/// @}
+#endif
@@ -0,0 +1,175 @@
+#ifndef __PX_WR_BUF_H__
+#define __PX_WR_BUF_H__
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_wr_buf.h : Buffered writer that batches output
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/**
+ *  @ingroup UTILS
+ *  @defgroup PX_WR_BUF px_wr_buf.h : Buffered writer that batches output
+ *
+ *  Collects output characters in a buffer and passes them on in one block.
+ *
+ *  File(s):
+ *  - utils/inc/px_wr_buf.h
+ *  - utils/src/px_wr_buf.c
+ *
+ *  Characters are appended to a @ref PX_SBUF buffer. The buffer is passed to
+ *  the flush function when px_wr_buf_flush() is called (e.g. once per received
+ *  character) or when it is full. This turns many small writes (e.g. a VT100
+ *  escape sequence written with putchar()) into one write to a UART or USB CDC
+ *  driver.
+ *
+ *  The number of bytes written and the number of flushes are counted so that
+ *  the effect can be measured.
+ *
+ *  Example:
+ *
+ *  @code{.c}
+ *  static px_wr_buf_t wr_buf;
+ *  static char        wr_buf_data[64];
+ *
+ *  static void wr_buf_flush(const char * data, size_t nr_of_bytes)
+ *  {
+ *      fwrite(data, 1, nr_of_bytes, stdout);
+ *  }
+ *
+ *  px_wr_buf_init(&wr_buf, wr_buf_data, sizeof(wr_buf_data), wr_buf_flush);
+ *  px_wr_buf_print(&wr_buf, PX_VT100_ERASE_LINE);
+ *  px_wr_buf_putchar(&wr_buf, '>');
+ *  // Write escape sequence and prompt in one block
+ *  px_wr_buf_flush(&wr_buf);
+ *  @endcode
+ *
+ *  @{
+ */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_defs.h"
+#include "px_sbuf.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/* _____DEFINITIONS__________________________________________________________ */
+
+/* _____TYPE DEFINITIONS_____________________________________________________ */
+/**
+ *  Flush function that writes the buffered data.
+ *
+ *  @param data         Pointer to buffered data
+ *  @param nr_of_bytes  Number of bytes (never 0)
+ */
+typedef void (*px_wr_buf_flush_fn_t)(const char * data, size_t nr_of_bytes);
+
+/// Statistics
+typedef struct
+{
+    uint32_t nr_of_bytes;               ///< Number of bytes written
+    uint32_t nr_of_flushes;             ///< Number of times flush function was called
+} px_wr_buf_stats_t;
+
+/// Buffered writer
+typedef struct
+{
+    px_sbuf_t            sbuf;          ///< Buffer
+    px_wr_buf_flush_fn_t flush_fn;      ///< Flush function
+    px_wr_buf_stats_t    stats;         ///< Statistics
+} px_wr_buf_t;
+
+/* _____GLOBAL VARIABLES_____________________________________________________ */
+
+/* _____GLOBAL FUNCTION DECLARATIONS_________________________________________ */
+/**
+ *  Initialise buffered writer (and reset statistics).
+ *
+ *  The buffer holds (buf_size - 1) characters, because @ref PX_SBUF zero
+ *  terminates the string.
+ *
+ *  @param wr_buf       Pointer to buffered writer object
+ *  @param buf          Pointer to buffer
+ *  @param buf_size     Size of buffer (at least 2)
+ *  @param flush_fn     Flush function
+ */
+void px_wr_buf_init(px_wr_buf_t *        wr_buf,
+                    char *               buf,
+                    size_t               buf_size,
+                    px_wr_buf_flush_fn_t flush_fn);
+
+/**
+ *  Append a character (and flush first if buffer is full).
+ *
+ *  @param wr_buf       Pointer to buffered writer object
+ *  @param c            Character to append
+ */
+void px_wr_buf_putchar(px_wr_buf_t * wr_buf, char c);
+
+/**
+ *  Append a string.
+ *
+ *  The buffer is flushed as many times as needed, so the string may be longer
+ *  than the buffer.
+ *
+ *  @param wr_buf       Pointer to buffered writer object
+ *  @param str          String to append
+ */
+void px_wr_buf_print(px_wr_buf_t * wr_buf, const char * str);
+
+/**
+ *  Append a string and a newline character.
+ *
+ *  @param wr_buf       Pointer to buffered writer object
+ *  @param str          String to append
+ */
+void px_wr_buf_puts(px_wr_buf_t * wr_buf, const char * str);
+
+/**
+ *  Pass buffered data to flush function (if there is any).
+ *
+ *  @param wr_buf       Pointer to buffered writer object
+ */
+void px_wr_buf_flush(px_wr_buf_t * wr_buf);
+
+/**
+ *  Return statistics.
+ *
+ *  @param wr_buf                       Pointer to buffered writer object
+ *
+ *  @return const px_wr_buf_stats_t *   Pointer to statistics
+ */
+static inline const px_wr_buf_stats_t * px_wr_buf_get_stats(const px_wr_buf_t * wr_buf)
+{
+    return &wr_buf->stats;
+}
+
+/**
+ *  Reset statistics.
+ *
+ *  @param wr_buf       Pointer to buffered writer object
+ */
+void px_wr_buf_reset_stats(px_wr_buf_t * wr_buf);
+
+/* _____MACROS_______________________________________________________________ */
+
+#ifdef __cplusplus
+}
+#endif
+
+/// @}
+#endif
@@ -17,14 +17,25 @@
 ============================================================================= */
 
 /* _____STANDARD INCLUDES____________________________________________________ */
+#include <stdlib.h>
 #include <string.h>
 
 /* _____PROJECT INCLUDES_____________________________________________________ */
 #include "px_buf_strings.h"
+#if PX_BUF_STRINGS_CFG_MEM_POOL
+#include "px_mem_pool.h"
+#endif
 
 /* _____LOCAL DEFINITIONS____________________________________________________ */
 
 /* _____MACROS_______________________________________________________________ */
+#if PX_BUF_STRINGS_CFG_MEM_POOL
+#define PX_BUF_STRINGS_MALLOC(size) px_mem_pool_malloc(size)
+#define PX_BUF_STRINGS_FREE(ptr)    px_mem_pool_free(ptr)
+#else
+#define PX_BUF_STRINGS_MALLOC(size) malloc(size)
+#define PX_BUF_STRINGS_FREE(ptr)    free(ptr)
+#endif
 
 /* _____GLOBAL VARIABLES_____________________________________________________ */
 
@@ -46,7 +57,7 @@ void px_buf_strings_init(px_buf_strings_t * buf_strings, char * buf, uint16_t bu
 
 bool px_buf_strings_malloc(px_buf_strings_t * buf_strings, uint16_t buf_size)
 {
-    char * buf = malloc(buf_size);
+    char * buf = PX_BUF_STRINGS_MALLOC(buf_size);
     if(buf != NULL)
     {
         px_buf_strings_init(buf_strings, buf, buf_size);
@@ -61,7 +72,7 @@ bool px_buf_strings_malloc(px_buf_strings_t * buf_strings, uint16_t buf_size)
 
 void px_buf_strings_free(px_buf_strings_t * buf_strings)
 {
-    free(buf_strings->buf);
+    PX_BUF_STRINGS_FREE(buf_strings->buf);
     memset(buf_strings, 0, sizeof(*buf_strings));
 }
 
@@ -20,6 +20,9 @@
 
 /* _____PROJECT INCLUDES_____________________________________________________ */
 #include "px_link_list.h"
+#if PX_LINK_LIST_CFG_MEM_POOL
+#include "px_mem_pool.h"
+#endif
 
 /* _____LOCAL DEFINITIONS____________________________________________________ */
 
@@ -248,6 +251,33 @@ bool px_link_list_insert_item_after(px_link_list_t *      list,
     return true;
 }
 
+bool px_link_list_insert_item_sorted(px_link_list_t *      list,
+                                     px_link_list_item_t * item,
+                                     px_link_list_cmp_t    cmp)
+{
+    px_link_list_item_t * item_pos;
+
+    if(px_link_list_is_full(list))
+    {
+        return false;
+    }
+    // Search backwards for last item that is smaller or equal
+    item_pos = list->last;
+    while((item_pos != NULL) && (cmp(item, item_pos) < 0))
+    {
+        item_pos = item_pos->prev;
+    }
+    if(item_pos == NULL)
+    {
+        // Item is smaller than all items in the list
+        return px_link_list_insert_item_start(list, item);
+    }
+    else
+    {
+        return px_link_list_insert_item_after(list, item, item_pos);
+    }
+}
+
 px_link_list_item_t * px_link_list_remove_item_first(px_link_list_t * list)
 {
     px_link_list_item_t * item = list->first;
@@ -360,3 +390,49 @@ bool px_link_list_has_item(px_link_list_t *      list,
     return false;
 }
 
+bool px_link_list_item_in_list(px_link_list_t *      list,
+                               px_link_list_item_t * item)
+{
+    // An item that is not in the list has no links (unless it is the only item)
+    if((item->prev != NULL) || (item->next != NULL) || (list->first == item))
+    {
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+#if PX_LINK_LIST_CFG_MEM_POOL
+px_link_list_item_t * px_link_list_item_alloc(px_link_list_t * list,
+                                              size_t           item_size)
+{
+    px_link_list_item_t * item;
+
+    // Allocate item from memory pools
+    item = (px_link_list_item_t *)px_mem_pool_malloc(item_size);
+    if(item != NULL)
+    {
+        px_link_list_item_init(list, item);
+    }
+
+    return item;
+}
+
+void px_link_list_item_free(px_link_list_t *      list,
+                            px_link_list_item_t * item)
+{
+    if(item == NULL)
+    {
+        return;
+    }
+    if(px_link_list_item_in_list(list, item))
+    {
+        px_link_list_remove_item(list, item);
+    }
+    // Return item to memory pools
+    px_mem_pool_free(item);
+}
+#endif
+
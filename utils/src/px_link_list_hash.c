@@ -0,0 +1,212 @@
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_link_list_hash.h : Linked List with hash index
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_link_list_hash.h"
+#include "px_log.h"
+
+/* _____LOCAL DEFINITIONS____________________________________________________ */
+PX_LOG_NAME("px_link_list_hash");
+
+/* _____MACROS_______________________________________________________________ */
+
+/* _____GLOBAL VARIABLES_____________________________________________________ */
+
+/* _____LOCAL VARIABLES______________________________________________________ */
+
+/* _____LOCAL FUNCTION DECLARATIONS__________________________________________ */
+
+/* _____LOCAL FUNCTIONS______________________________________________________ */
+static px_link_list_hash_item_t ** px_link_list_hash_bucket(px_link_list_hash_t * hash,
+                                                            uint32_t              key)
+{
+    // Multiplicative hash to spread keys that differ only in upper bits
+    key *= 0x9e3779b1;
+    key ^= key >> 16;
+
+    return &hash->buckets[key & hash->bucket_mask];
+}
+
+static bool px_link_list_hash_bucket_add(px_link_list_hash_t *      hash,
+                                         px_link_list_hash_item_t * item,
+                                         uint32_t                   key)
+{
+    px_link_list_hash_item_t ** bucket = px_link_list_hash_bucket(hash, key);
+
+    // List full or key already in list?
+    if(  px_link_list_is_full(&hash->list)
+       || (px_link_list_hash_find(hash, key) != NULL)  )
+    {
+        return false;
+    }
+    // Add item to start of bucket chain
+    item->key         = key;
+    item->bucket_next = *bucket;
+    *bucket           = item;
+
+    return true;
+}
+
+static void px_link_list_hash_bucket_remove(px_link_list_hash_t *      hash,
+                                            px_link_list_hash_item_t * item)
+{
+    px_link_list_hash_item_t ** link = px_link_list_hash_bucket(hash, item->key);
+
+    // Find link to item in bucket chain
+    while(*link != item)
+    {
+        PX_LOG_ASSERT(*link != NULL);
+        link = &(*link)->bucket_next;
+    }
+    // Unlink item
+    *link             = item->bucket_next;
+    item->bucket_next = NULL;
+}
+
+/* _____GLOBAL FUNCTIONS_____________________________________________________ */
+void px_link_list_hash_init(px_link_list_hash_t *       hash,
+                            px_link_list_hash_item_t ** buckets,
+                            size_t                      nr_of_buckets,
+                            size_t                      max_nr_of_items)
+{
+    size_t i;
+
+    // Number of buckets must be a power of two
+    PX_LOG_ASSERT(    (nr_of_buckets != 0)
+                   && ((nr_of_buckets & (nr_of_buckets - 1)) == 0)  );
+
+    px_link_list_init(&hash->list, max_nr_of_items);
+    hash->buckets     = buckets;
+    hash->bucket_mask = (uint32_t)(nr_of_buckets - 1);
+    for(i = 0; i < nr_of_buckets; i++)
+    {
+        buckets[i] = NULL;
+    }
+}
+
+void px_link_list_hash_item_init(px_link_list_hash_t *      hash,
+                                 px_link_list_hash_item_t * item)
+{
+    px_link_list_item_init(&hash->list, &item->list_item);
+    item->bucket_next = NULL;
+    item->key         = 0;
+}
+
+bool px_link_list_hash_insert_item_end(px_link_list_hash_t *      hash,
+                                       px_link_list_hash_item_t * item,
+                                       uint32_t                   key)
+{
+    if(!px_link_list_hash_bucket_add(hash, item, key))
+    {
+        return false;
+    }
+    return px_link_list_insert_item_end(&hash->list, &item->list_item);
+}
+
+bool px_link_list_hash_insert_item_sorted(px_link_list_hash_t *      hash,
+                                          px_link_list_hash_item_t * item,
+                                          uint32_t                   key,
+                                          px_link_list_cmp_t         cmp)
+{
+    if(!px_link_list_hash_bucket_add(hash, item, key))
+    {
+        return false;
+    }
+    return px_link_list_insert_item_sorted(&hash->list, &item->list_item, cmp);
+}
+
+px_link_list_hash_item_t * px_link_list_hash_find(px_link_list_hash_t * hash,
+                                                  uint32_t              key)
+{
+    px_link_list_hash_item_t * item = *px_link_list_hash_bucket(hash, key);
+
+    // Search bucket chain
+    while(item != NULL)
+    {
+        if(item->key == key)
+        {
+            return item;
+        }
+        item = item->bucket_next;
+    }
+    // Key is not in the list
+    return NULL;
+}
+
+bool px_link_list_hash_has_item(px_link_list_hash_t *      hash,
+                                px_link_list_hash_item_t * item)
+{
+    return px_link_list_item_in_list(&hash->list, &item->list_item);
+}
+
+void px_link_list_hash_remove_item(px_link_list_hash_t *      hash,
+                                   px_link_list_hash_item_t * item)
+{
+    px_link_list_hash_bucket_remove(hash, item);
+    px_link_list_remove_item(&hash->list, &item->list_item);
+}
+
+px_link_list_hash_item_t * px_link_list_hash_remove_key(px_link_list_hash_t * hash,
+                                                        uint32_t              key)
+{
+    px_link_list_hash_item_t ** link = px_link_list_hash_bucket(hash, key);
+    px_link_list_hash_item_t *  item;
+
+    // Find link to item in bucket chain
+    while(*link != NULL)
+    {
+        item = *link;
+        if(item->key == key)
+        {
+            // Unlink item from bucket chain and list
+            *link             = item->bucket_next;
+            item->bucket_next = NULL;
+            px_link_list_remove_item(&hash->list, &item->list_item);
+            return item;
+        }
+        link = &item->bucket_next;
+    }
+    // Key is not in the list
+    return NULL;
+}
+
+px_link_list_hash_item_t * px_link_list_hash_remove_item_first(px_link_list_hash_t * hash)
+{
+    px_link_list_hash_item_t * item;
+
+    item = (px_link_list_hash_item_t *)px_link_list_get_item_first(&hash->list);
+    if(item != NULL)
+    {
+        px_link_list_hash_remove_item(hash, item);
+    }
+    return item;
+}
+
+px_link_list_hash_item_t * px_link_list_hash_remove_item_last(px_link_list_hash_t * hash)
+{
+    px_link_list_hash_item_t * item;
+
+    item = (px_link_list_hash_item_t *)px_link_list_get_item_last(&hash->list);
+    if(item != NULL)
+    {
+        px_link_list_hash_remove_item(hash, item);
+    }
+    return item;
+}
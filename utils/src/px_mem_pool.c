@@ -0,0 +1,243 @@
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_mem_pool.h : Fixed-size block memory pool allocator
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_mem_pool.h"
+#include "px_log.h"
+
+/* _____LOCAL DEFINITIONS____________________________________________________ */
+PX_LOG_NAME("px_mem_pool");
+
+/* _____MACROS_______________________________________________________________ */
+
+/* _____GLOBAL VARIABLES_____________________________________________________ */
+
+/* _____LOCAL VARIABLES______________________________________________________ */
+/// Registered memory pools (size classes), sorted by block size
+static px_mem_pool_t * px_mem_pool_heap_pools;
+/// Number of registered memory pools
+static size_t          px_mem_pool_heap_nr_of_pools;
+
+/* _____LOCAL FUNCTION DECLARATIONS__________________________________________ */
+
+/* _____LOCAL FUNCTIONS______________________________________________________ */
+static void * px_mem_pool_block_take(px_mem_pool_t * pool)
+{
+    px_mem_pool_block_t * block;
+
+    PX_MEM_POOL_CFG_CRITICAL_ENTER();
+    // Remove first block from free list
+    block = pool->free_list;
+    if(block != NULL)
+    {
+        pool->free_list = block->next;
+        // Update statistics
+        if(++pool->blocks_used > pool->blocks_used_max)
+        {
+            pool->blocks_used_max = pool->blocks_used;
+        }
+    }
+    PX_MEM_POOL_CFG_CRITICAL_EXIT();
+
+    return block;
+}
+
+static void px_mem_pool_fail_cnt_inc(px_mem_pool_t * pool)
+{
+    PX_MEM_POOL_CFG_CRITICAL_ENTER();
+    pool->fail_cnt++;
+    PX_MEM_POOL_CFG_CRITICAL_EXIT();
+}
+
+/* _____GLOBAL FUNCTIONS_____________________________________________________ */
+void px_mem_pool_init(px_mem_pool_t * pool,
+                      void *          arena,
+                      size_t          block_size,
+                      size_t          nr_of_blocks)
+{
+    px_mem_pool_block_t * block;
+    size_t                i;
+
+    // Sanity checks
+    PX_LOG_ASSERT(    (pool         != NULL)
+                   && (arena        != NULL)
+                   && (block_size   != 0   )
+                   && (nr_of_blocks != 0   )  );
+
+    // Initialise pool
+    block_size            = PX_MEM_POOL_BLOCK_SIZE(block_size);
+    pool->arena_start     = (uint8_t *)arena;
+    pool->arena_end       = pool->arena_start + block_size * nr_of_blocks;
+    pool->block_size      = block_size;
+    pool->nr_of_blocks    = nr_of_blocks;
+    pool->blocks_used     = 0;
+    pool->blocks_used_max = 0;
+    pool->fail_cnt        = 0;
+    // Link all blocks in free list (in address order)
+    pool->free_list = (px_mem_pool_block_t *)arena;
+    block           = pool->free_list;
+    for(i = 1; i < nr_of_blocks; i++)
+    {
+        block->next = (px_mem_pool_block_t *)((uint8_t *)block + block_size);
+        block       = block->next;
+    }
+    block->next = NULL;
+}
+
+void * px_mem_pool_block_alloc(px_mem_pool_t * pool)
+{
+    void * block;
+
+    PX_LOG_ASSERT(pool != NULL);
+
+    block = px_mem_pool_block_take(pool);
+    if(block == NULL)
+    {
+        PX_LOG_W("Pool empty (block size %lu)", (unsigned long)pool->block_size);
+        px_mem_pool_fail_cnt_inc(pool);
+    }
+
+    return block;
+}
+
+void px_mem_pool_block_free(px_mem_pool_t * pool,
+                            void *          block)
+{
+    px_mem_pool_block_t * free_block = (px_mem_pool_block_t *)block;
+
+    PX_LOG_ASSERT(pool != NULL);
+
+    if(block == NULL)
+    {
+        return;
+    }
+    // Block must be in arena and at the start of a block
+    PX_LOG_ASSERT(    px_mem_pool_has_ptr(pool, block)
+                   && ((((uint8_t *)block - pool->arena_start) % pool->block_size) == 0));
+
+    PX_MEM_POOL_CFG_CRITICAL_ENTER();
+    // Add block to start of free list
+    free_block->next = pool->free_list;
+    pool->free_list  = free_block;
+    pool->blocks_used--;
+    PX_MEM_POOL_CFG_CRITICAL_EXIT();
+}
+
+bool px_mem_pool_has_ptr(const px_mem_pool_t * pool,
+                         const void *          ptr)
+{
+    return (   ((const uint8_t *)ptr >= pool->arena_start)
+            && ((const uint8_t *)ptr <  pool->arena_end  )  );
+}
+
+size_t px_mem_pool_get_blocks_free(const px_mem_pool_t * pool)
+{
+    return pool->nr_of_blocks - pool->blocks_used;
+}
+
+void px_mem_pool_stats_reset(px_mem_pool_t * pool)
+{
+    pool->blocks_used_max = pool->blocks_used;
+    pool->fail_cnt        = 0;
+}
+
+void px_mem_pool_heap_init(px_mem_pool_t * pools,
+                           size_t          nr_of_pools)
+{
+    size_t i;
+
+    // Pools must be sorted by block size
+    for(i = 1; i < nr_of_pools; i++)
+    {
+        PX_LOG_ASSERT(pools[i - 1].block_size <= pools[i].block_size);
+    }
+    px_mem_pool_heap_pools       = pools;
+    px_mem_pool_heap_nr_of_pools = nr_of_pools;
+}
+
+void * px_mem_pool_malloc(size_t size)
+{
+    void * block;
+    size_t i;
+    size_t i_fit;
+
+    // Find smallest pool that fits
+    for(i = 0; i < px_mem_pool_heap_nr_of_pools; i++)
+    {
+        if(px_mem_pool_heap_pools[i].block_size >= size)
+        {
+            break;
+        }
+    }
+    if(i == px_mem_pool_heap_nr_of_pools)
+    {
+        PX_LOG_E("No pool for %lu bytes", (unsigned long)size);
+        return NULL;
+    }
+    // Allocate from smallest pool or next larger pool if empty
+    for(i_fit = i; i < px_mem_pool_heap_nr_of_pools; i++)
+    {
+        block = px_mem_pool_block_take(&px_mem_pool_heap_pools[i]);
+        if(block != NULL)
+        {
+            return block;
+        }
+    }
+    PX_LOG_W("No free block for %lu bytes", (unsigned long)size);
+    px_mem_pool_fail_cnt_inc(&px_mem_pool_heap_pools[i_fit]);
+
+    return NULL;
+}
+
+void px_mem_pool_free(void * ptr)
+{
+    size_t i;
+
+    if(ptr == NULL)
+    {
+        return;
+    }
+    // Find pool that owns block
+    for(i = 0; i < px_mem_pool_heap_nr_of_pools; i++)
+    {
+        if(px_mem_pool_has_ptr(&px_mem_pool_heap_pools[i], ptr))
+        {
+            px_mem_pool_block_free(&px_mem_pool_heap_pools[i], ptr);
+            return;
+        }
+    }
+    PX_LOG_E("Pointer not in any pool");
+}
+
+void px_mem_pool_log_report(void)
+{
+    size_t i;
+
+    for(i = 0; i < px_mem_pool_heap_nr_of_pools; i++)
+    {
+        PX_LOG_TRACE("Pool %lu: block size=%lu, blocks=%lu, used=%lu, used max=%lu, fail=%lu\n",
+                     (unsigned long)i,
+                     (unsigned long)px_mem_pool_heap_pools[i].block_size,
+                     (unsigned long)px_mem_pool_heap_pools[i].nr_of_blocks,
+                     (unsigned long)px_mem_pool_heap_pools[i].blocks_used,
+                     (unsigned long)px_mem_pool_heap_pools[i].blocks_used_max,
+                     (unsigned long)px_mem_pool_heap_pools[i].fail_cnt);
+    }
+}
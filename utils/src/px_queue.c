@@ -46,6 +46,19 @@ static inline px_queue_idx_t px_queue_idx_next(const px_queue_t * queue, px_queu
     return idx;
 }
 
+static inline px_queue_idx_t px_queue_idx_add(const px_queue_t * queue,
+                                              px_queue_idx_t     idx,
+                                              px_queue_idx_t     nr_of_items)
+{
+    // Going past end of array?
+    if(nr_of_items >= queue->items_max - idx)
+    {
+        // Wrap to start of array
+        return nr_of_items - (queue->items_max - idx);
+    }
+    return idx + nr_of_items;
+}
+
 /* _____GLOBAL FUNCTIONS_____________________________________________________ */
 void px_queue_init(px_queue_t *         queue,
                    void *               buf,
@@ -58,12 +71,13 @@ void px_queue_init(px_queue_t *         queue,
                    && (item_size != 0   )
                    && (items_max != 0   )  );
     // Initialise queue
-    queue->buf        = (uint8_t *)buf;
-    queue->idx_rd     = 0;
-    queue->idx_wr     = 0;
-    queue->item_count = 0;
-    queue->items_max  = items_max;
-    queue->item_size  = item_size;
+    queue->buf       = (uint8_t *)buf;
+    queue->idx_rd    = 0;
+    queue->idx_wr    = 0;
+    queue->count_rd  = 0;
+    queue->count_wr  = 0;
+    queue->items_max = items_max;
+    queue->item_size = item_size;
 }
 
 bool px_queue_is_empty(px_queue_t * queue);
@@ -81,12 +95,16 @@ bool px_queue_wr(px_queue_t * queue, const void * item_data)
     {
         return false;
     }
+    // Make sure that consumer has finished reading before item is reused
+    PX_MEM_BARRIER_ACQUIRE();
     // Copy item data into buffer
     memcpy(&queue->buf[queue->idx_wr * queue->item_size], item_data, queue->item_size);
-    // Increment item count
-    queue->item_count++;
     // Next index (wrap if going past end)
     queue->idx_wr = px_queue_idx_next(queue, queue->idx_wr);
+    // Make sure item is stored before it is published to the consumer
+    PX_MEM_BARRIER_RELEASE();
+    // Increment item count
+    queue->count_wr++;
     // Success
     return true;
 }
@@ -100,39 +118,169 @@ bool px_queue_rd(px_queue_t * queue, void * item_data)
     {
         return false;
     }
+    // Make sure item is read after it was published by the producer
+    PX_MEM_BARRIER_ACQUIRE();
     // Copy item data from buffer
     memcpy(item_data, &queue->buf[queue->idx_rd * queue->item_size], queue->item_size);
-    // Decrement item count
-    queue->item_count--;
     // Next index (wrap if going past end)
     queue->idx_rd = px_queue_idx_next(queue, queue->idx_rd);
+    // Make sure item is read before it is released to the producer
+    PX_MEM_BARRIER_RELEASE();
+    // Advance read count
+    queue->count_rd++;
     // Success
     return true;
 }
 
-bool px_queue_discard_oldest(px_queue_t * queue)
+px_queue_idx_t px_queue_wr_n(px_queue_t *   queue,
+                             const void *   item_data,
+                             px_queue_idx_t nr_of_items)
 {
-    PX_LOG_ASSERT(queue != NULL);
+    const uint8_t * data = (const uint8_t *)item_data;
+    px_queue_idx_t  count_free;
+    px_queue_idx_t  n;
+
+    PX_LOG_ASSERT((queue != NULL) && ((item_data != NULL) || (nr_of_items == 0)));
+
+    // Clip to number of free items
+    count_free = queue->items_max - px_queue_get_item_count(queue);
+    if(nr_of_items > count_free)
+    {
+        nr_of_items = count_free;
+    }
+    if(nr_of_items == 0)
+    {
+        return 0;
+    }
+    // Make sure that consumer has finished reading before items are reused
+    PX_MEM_BARRIER_ACQUIRE();
+    // Copy items up to end of array
+    n = queue->items_max - queue->idx_wr;
+    if(n > nr_of_items)
+    {
+        n = nr_of_items;
+    }
+    memcpy(&queue->buf[queue->idx_wr * queue->item_size], data, n * queue->item_size);
+    // Copy rest of items to start of array
+    memcpy(&queue->buf[0], &data[n * queue->item_size], (nr_of_items - n) * queue->item_size);
+    // Next index (wrap if going past end)
+    queue->idx_wr = px_queue_idx_add(queue, queue->idx_wr, nr_of_items);
+    // Make sure items are stored before they are published to the consumer
+    PX_MEM_BARRIER_RELEASE();
+    // Increment item count
+    queue->count_wr += nr_of_items;
+
+    return nr_of_items;
+}
+
+px_queue_idx_t px_queue_rd_n(px_queue_t *   queue,
+                             void *         item_data,
+                             px_queue_idx_t nr_of_items)
+{
+    uint8_t *      data = (uint8_t *)item_data;
+    px_queue_idx_t count_used;
+    px_queue_idx_t n;
+
+    PX_LOG_ASSERT((queue != NULL) && ((item_data != NULL) || (nr_of_items == 0)));
+
+    // Clip to number of items in queue
+    count_used = px_queue_get_item_count(queue);
+    if(nr_of_items > count_used)
+    {
+        nr_of_items = count_used;
+    }
+    if(nr_of_items == 0)
+    {
+        return 0;
+    }
+    // Make sure items are read after they were published by the producer
+    PX_MEM_BARRIER_ACQUIRE();
+    // Copy items up to end of array
+    n = queue->items_max - queue->idx_rd;
+    if(n > nr_of_items)
+    {
+        n = nr_of_items;
+    }
+    memcpy(data, &queue->buf[queue->idx_rd * queue->item_size], n * queue->item_size);
+    // Copy rest of items from start of array
+    memcpy(&data[n * queue->item_size], &queue->buf[0], (nr_of_items - n) * queue->item_size);
+    // Next index (wrap if going past end)
+    queue->idx_rd = px_queue_idx_add(queue, queue->idx_rd, nr_of_items);
+    // Make sure items are read before they are released to the producer
+    PX_MEM_BARRIER_RELEASE();
+    // Advance read count
+    queue->count_rd += nr_of_items;
+
+    return nr_of_items;
+}
+
+void * px_queue_peek_ptr(px_queue_t *     queue,
+                         px_queue_idx_t * nr_of_items)
+{
+    px_queue_idx_t count_used;
+    px_queue_idx_t n;
+
+    PX_LOG_ASSERT((queue != NULL) && (nr_of_items != NULL));
 
     // Queue empty?
-    if(px_queue_is_empty(queue))
+    count_used = px_queue_get_item_count(queue);
+    if(count_used == 0)
     {
-        return false;
+        *nr_of_items = 0;
+        return NULL;
     }
-    // Decrement item count
-    queue->item_count--;
-    // Next pointer (wrap if going past end)
-    queue->idx_rd = px_queue_idx_next(queue, queue->idx_rd);
-    // Success
-    return true;
+    // Make sure items are read after they were published by the producer
+    PX_MEM_BARRIER_ACQUIRE();
+    // Number of contiguous items up to end of array
+    n = queue->items_max - queue->idx_rd;
+    if(n > count_used)
+    {
+        n = count_used;
+    }
+    *nr_of_items = n;
+
+    return &queue->buf[queue->idx_rd * queue->item_size];
+}
+
+px_queue_idx_t px_queue_drop_n(px_queue_t *   queue,
+                               px_queue_idx_t nr_of_items)
+{
+    px_queue_idx_t count_used;
+
+    PX_LOG_ASSERT(queue != NULL);
+
+    // Clip to number of items in queue
+    count_used = px_queue_get_item_count(queue);
+    if(nr_of_items > count_used)
+    {
+        nr_of_items = count_used;
+    }
+    if(nr_of_items == 0)
+    {
+        return 0;
+    }
+    // Next index (wrap if going past end)
+    queue->idx_rd = px_queue_idx_add(queue, queue->idx_rd, nr_of_items);
+    // Make sure items are read before they are released to the producer
+    PX_MEM_BARRIER_RELEASE();
+    // Advance read count
+    queue->count_rd += nr_of_items;
+
+    return nr_of_items;
+}
+
+bool px_queue_discard_oldest(px_queue_t * queue)
+{
+    PX_LOG_ASSERT(queue != NULL);
+
+    return (px_queue_drop_n(queue, 1) == 1);
 }
 
 void px_queue_flush(px_queue_t * queue)
 {
     PX_LOG_ASSERT(queue != NULL);
 
-    queue->idx_rd     = 0;
-    queue->idx_wr     = 0;
-    queue->item_count = 0;
+    // Remove all items (only read index is modified, so producer is not affected)
+    px_queue_drop_n(queue, px_queue_get_item_count(queue));
 }
 
@@ -17,6 +17,7 @@
 ============================================================================= */
 
 /* _____STANDARD INCLUDES____________________________________________________ */
+#include <string.h>
 
 /* _____PROJECT INCLUDES_____________________________________________________ */
 #include "px_ring_buf.h"
@@ -34,6 +35,21 @@ PX_LOG_NAME("px_ring_buf");
 /* _____LOCAL FUNCTION PROTOTYPES____________________________________________ */
 
 /* _____LOCAL FUNCTIONS______________________________________________________ */
+#if PX_RING_BUF_CFG_POW2
+static inline px_ring_buf_idx_t px_ring_buf_idx_offset(const px_ring_buf_t * px_ring_buf,
+                                                       px_ring_buf_idx_t     idx)
+{
+    // Free-running index is masked to get offset in buffer
+    return idx & (px_ring_buf->buf_size - 1);
+}
+
+static inline px_ring_buf_idx_t px_ring_buf_used(px_ring_buf_idx_t idx_wr,
+                                                 px_ring_buf_idx_t idx_rd)
+{
+    // Unsigned subtraction is correct even if write index has wrapped
+    return (px_ring_buf_idx_t)(idx_wr - idx_rd);
+}
+#else
 static inline px_ring_buf_idx_t px_ring_buf_idx_next(const px_ring_buf_t * px_ring_buf,
                                                      px_ring_buf_idx_t     idx)
 {
@@ -44,12 +60,17 @@ static inline px_ring_buf_idx_t px_ring_buf_idx_next(const px_ring_buf_t * px_ri
     }
     return idx;
 }
+#endif
 
 /* _____GLOBAL FUNCTIONS_____________________________________________________ */
 void px_ring_buf_init(px_ring_buf_t *   px_ring_buf,
                       uint8_t *         buf,
                       px_ring_buf_idx_t buf_size)
 {
+#if PX_RING_BUF_CFG_POW2
+    // Buffer size must be a power of two
+    PX_LOG_ASSERT((buf_size != 0) && ((buf_size & (buf_size - 1)) == 0));
+#endif
     // Initialise the ring buffer structure to be empty
     px_ring_buf->buf      = buf;
     px_ring_buf->buf_size = buf_size;
@@ -61,7 +82,11 @@ bool px_ring_buf_is_empty(const px_ring_buf_t * px_ring_buf);
 
 bool px_ring_buf_is_full(const px_ring_buf_t * px_ring_buf)
 {
+#if PX_RING_BUF_CFG_POW2
+    return (px_ring_buf_used(px_ring_buf->idx_wr, px_ring_buf->idx_rd) == px_ring_buf->buf_size);
+#else
     return (px_ring_buf_idx_next(px_ring_buf, px_ring_buf->idx_wr) == px_ring_buf->idx_rd);
+#endif
 }
 
 void px_ring_buf_flush(px_ring_buf_t * px_ring_buf, size_t nr_of_bytes)
@@ -80,6 +105,18 @@ void px_ring_buf_flush(px_ring_buf_t * px_ring_buf, size_t nr_of_bytes)
     idx_wr = px_ring_buf->idx_wr;
     idx_rd = px_ring_buf->idx_rd;
 
+#if PX_RING_BUF_CFG_POW2
+    if(nr_of_bytes > px_ring_buf_used(idx_wr, idx_rd))
+    {
+        // Flush everything
+        px_ring_buf->idx_rd = idx_wr;
+    }
+    else
+    {
+        // Flush requested number of bytes
+        px_ring_buf->idx_rd = idx_rd + nr_of_bytes;
+    }
+#else
     // Buffer empty?
     if(idx_rd == idx_wr)
     {
@@ -122,6 +159,7 @@ void px_ring_buf_flush(px_ring_buf_t * px_ring_buf, size_t nr_of_bytes)
         // Flush requested number of bytes
         px_ring_buf->idx_rd = idx_rd + nr_of_bytes;
     }
+#endif
 }
 
 bool px_ring_buf_wr_u8(px_ring_buf_t * px_ring_buf, 
@@ -130,16 +168,31 @@ bool px_ring_buf_wr_u8(px_ring_buf_t * px_ring_buf,
     px_ring_buf_idx_t idx_wr = px_ring_buf->idx_wr;
 
     // Buffer full?
+#if PX_RING_BUF_CFG_POW2
+    if(px_ring_buf_used(idx_wr, px_ring_buf->idx_rd) == px_ring_buf->buf_size)
+#else
     if(px_ring_buf_idx_next(px_ring_buf, idx_wr) == px_ring_buf->idx_rd)
+#endif
     {
         // Yes. Discard byte
         return false;
     }
+    // Make sure that consumer has finished reading before space is reused
+    PX_MEM_BARRIER_ACQUIRE();
 
+#if PX_RING_BUF_CFG_POW2
+    // Add data to buffer
+    px_ring_buf->buf[px_ring_buf_idx_offset(px_ring_buf, idx_wr)] = data;
+    // Advance index (wraps by itself)
+    idx_wr++;
+#else
     // Add data to buffer
     px_ring_buf->buf[idx_wr] = data;
     // Advance index
     idx_wr = px_ring_buf_idx_next(px_ring_buf, idx_wr);
+#endif
+    // Make sure data is stored before it is published to the consumer
+    PX_MEM_BARRIER_RELEASE();
     // Update write index
     px_ring_buf->idx_wr = idx_wr;
 
@@ -150,31 +203,101 @@ px_ring_buf_idx_t px_ring_buf_wr(px_ring_buf_t * px_ring_buf,
                                  const void *    data, 
                                  size_t          nr_of_bytes)
 {
-    px_ring_buf_idx_t idx_wr        = px_ring_buf->idx_wr;
     px_ring_buf_idx_t bytes_written = 0;
-    uint8_t *         data_u8       = (uint8_t *)data;
+    const uint8_t *   data_u8       = (const uint8_t *)data;
+    uint8_t *         chunk;
+    size_t            chunk_size;
 
+    // Copy data in linear chunks (at most two: before and after wrap)
     while(nr_of_bytes != 0)
     {
-        // Buffer full?
-        if(px_ring_buf_idx_next(px_ring_buf, idx_wr) == px_ring_buf->idx_rd)
+        chunk_size = nr_of_bytes;
+        chunk      = px_ring_buf_wr_chunk_reserve(px_ring_buf, &chunk_size);
+        if(chunk == NULL)
         {
-            // Yes. Discard rest of data
+            // Buffer full. Discard rest of data
             break;
         }
-        // Add data to buffer
-        px_ring_buf->buf[idx_wr] = *data_u8++;
-        // Advance index
-        idx_wr = px_ring_buf_idx_next(px_ring_buf, idx_wr);
-        // Next byte
-        bytes_written++;
-        nr_of_bytes--;
+        memcpy(chunk, data_u8, chunk_size);
+        px_ring_buf_wr_chunk_commit(px_ring_buf, chunk_size);
+        // Next chunk
+        data_u8       += chunk_size;
+        bytes_written += chunk_size;
+        nr_of_bytes   -= chunk_size;
+    }
+
+    return bytes_written;
+}
+
+uint8_t * px_ring_buf_wr_chunk_reserve(px_ring_buf_t * px_ring_buf,
+                                       size_t *        nr_of_bytes)
+{
+    px_ring_buf_idx_t idx_wr = px_ring_buf->idx_wr;
+    px_ring_buf_idx_t idx_rd = px_ring_buf->idx_rd;
+    size_t            count_free;
+
+    // Make sure that consumer has finished reading before space is reused
+    PX_MEM_BARRIER_ACQUIRE();
+
+#if PX_RING_BUF_CFG_POW2
+    // Free space up to end of buffer
+    count_free = px_ring_buf->buf_size - px_ring_buf_used(idx_wr, idx_rd);
+    idx_wr     = px_ring_buf_idx_offset(px_ring_buf, idx_wr);
+    if(count_free > (size_t)(px_ring_buf->buf_size - idx_wr))
+    {
+        count_free = px_ring_buf->buf_size - idx_wr;
+    }
+#else
+    if(idx_wr >= idx_rd)
+    {
+        // |________xxxxxxxxx___________|
+        //          R>>>>>>>>W
+        // Free space up to end of buffer (keep one byte open if R is at start)
+        count_free = px_ring_buf->buf_size - idx_wr;
+        if(idx_rd == 0)
+        {
+            count_free--;
+        }
     }
+    else
+    {
+        // |xxxxxx___________________xxx|
+        //  >>>>>>W                  R>>
+        count_free = idx_rd - idx_wr - 1;
+    }
+#endif
+
+    // Buffer full?
+    if(count_free == 0)
+    {
+        *nr_of_bytes = 0;
+        return NULL;
+    }
+    // Clip chunk size to linear free space
+    if((*nr_of_bytes == 0) || (*nr_of_bytes > count_free))
+    {
+        *nr_of_bytes = count_free;
+    }
+
+    return &px_ring_buf->buf[idx_wr];
+}
+
+void px_ring_buf_wr_chunk_commit(px_ring_buf_t * px_ring_buf,
+                                 size_t          nr_of_bytes)
+{
+    px_ring_buf_idx_t idx_wr = px_ring_buf->idx_wr + nr_of_bytes;
 
+#if !PX_RING_BUF_CFG_POW2
+    if(idx_wr >= px_ring_buf->buf_size)
+    {
+        // Wrap index to start of buffer
+        idx_wr = 0;
+    }
+#endif
+    // Make sure data is stored before it is published to the consumer
+    PX_MEM_BARRIER_RELEASE();
     // Update write index
     px_ring_buf->idx_wr = idx_wr;
-
-    return bytes_written;
 }
 
 bool px_ring_buf_rd_u8(px_ring_buf_t * px_ring_buf,
@@ -188,10 +311,21 @@ bool px_ring_buf_rd_u8(px_ring_buf_t * px_ring_buf,
         // Yes
         return false;
     }
+    // Make sure data is read after it was published by the producer
+    PX_MEM_BARRIER_ACQUIRE();
+#if PX_RING_BUF_CFG_POW2
+    // Fetch data
+    *data = px_ring_buf->buf[px_ring_buf_idx_offset(px_ring_buf, idx_rd)];
+    // Advance index (wraps by itself)
+    idx_rd++;
+#else
     // Fetch data
     *data = px_ring_buf->buf[idx_rd];
     // Advance index
     idx_rd = px_ring_buf_idx_next(px_ring_buf, idx_rd);
+#endif
+    // Make sure data is read before space is released to the producer
+    PX_MEM_BARRIER_RELEASE();
     // Update read index
     px_ring_buf->idx_rd = idx_rd;
 
@@ -202,30 +336,29 @@ px_ring_buf_idx_t px_ring_buf_rd(px_ring_buf_t * px_ring_buf,
                                  void *          data,
                                  size_t          nr_of_bytes)
 {
-    px_ring_buf_idx_t idx_rd     = px_ring_buf->idx_rd;
     px_ring_buf_idx_t bytes_read = 0;
     uint8_t *         data_u8    = (uint8_t *)data;
+    const uint8_t *   chunk;
+    size_t            chunk_size;
 
+    // Copy data in linear chunks (at most two: before and after wrap)
     while(nr_of_bytes != 0)
     {
-        // Buffer empty?
-        if(idx_rd == px_ring_buf->idx_wr)
+        chunk_size = nr_of_bytes;
+        chunk      = px_ring_buf_rd_chunk_get(px_ring_buf, &chunk_size);
+        if(chunk == NULL)
         {
-            // Yes
+            // Buffer empty
             break;
         }
-        // Fetch data
-        *data_u8++ = px_ring_buf->buf[idx_rd];
-        // Advance index
-        idx_rd = px_ring_buf_idx_next(px_ring_buf, idx_rd);
-        // Next byte
-        bytes_read++;
-        nr_of_bytes--;
+        memcpy(data_u8, chunk, chunk_size);
+        px_ring_buf_rd_chunk_consume(px_ring_buf, chunk_size);
+        // Next chunk
+        data_u8     += chunk_size;
+        bytes_read  += chunk_size;
+        nr_of_bytes -= chunk_size;
     }
 
-    // Update read index
-    px_ring_buf->idx_rd = idx_rd;
-
     return bytes_read;
 }
 
@@ -234,6 +367,9 @@ const uint8_t * px_ring_buf_rd_chunk_get(const px_ring_buf_t * px_ring_buf,
 {
     px_ring_buf_idx_t idx_wr = px_ring_buf->idx_wr;
     px_ring_buf_idx_t idx_rd = px_ring_buf->idx_rd;
+#if PX_RING_BUF_CFG_POW2
+    size_t            count_used;
+#endif
 
     // Buffer empty?
     if(idx_rd == idx_wr)
@@ -241,7 +377,23 @@ const uint8_t * px_ring_buf_rd_chunk_get(const px_ring_buf_t * px_ring_buf,
         *nr_of_bytes = 0;
         return NULL;
     }
-
+    // Make sure data is read after it was published by the producer
+    PX_MEM_BARRIER_ACQUIRE();
+
+#if PX_RING_BUF_CFG_POW2
+    // Data up to end of buffer
+    count_used = px_ring_buf_used(idx_wr, idx_rd);
+    idx_rd     = px_ring_buf_idx_offset(px_ring_buf, idx_rd);
+    if(count_used > (size_t)(px_ring_buf->buf_size - idx_rd))
+    {
+        count_used = px_ring_buf->buf_size - idx_rd;
+    }
+    // Clip chunk size to linear data
+    if((*nr_of_bytes == 0) || (*nr_of_bytes > count_used))
+    {
+        *nr_of_bytes = count_used;
+    }
+#else
     if(idx_rd < idx_wr)
     {
         // |________xxxxxxxxx___________|
@@ -272,40 +424,94 @@ const uint8_t * px_ring_buf_rd_chunk_get(const px_ring_buf_t * px_ring_buf,
             *nr_of_bytes = px_ring_buf->buf_size - idx_rd;
         }
     }
+#endif
 
     return &px_ring_buf->buf[idx_rd];
 }
 
+void px_ring_buf_rd_chunk_consume(px_ring_buf_t * px_ring_buf,
+                                  size_t          nr_of_bytes)
+{
+    px_ring_buf_idx_t idx_rd = px_ring_buf->idx_rd + nr_of_bytes;
+
+#if !PX_RING_BUF_CFG_POW2
+    if(idx_rd >= px_ring_buf->buf_size)
+    {
+        // Wrap index to start of buffer
+        idx_rd = 0;
+    }
+#endif
+    // Make sure data is read before space is released to the producer
+    PX_MEM_BARRIER_RELEASE();
+    // Update read index
+    px_ring_buf->idx_rd = idx_rd;
+}
+
 px_ring_buf_idx_t px_ring_buf_peek(const px_ring_buf_t * px_ring_buf,
                                    void *                data,
                                    size_t                nr_of_bytes)
 {
-    px_ring_buf_idx_t idx_peek   = px_ring_buf->idx_rd;
-    px_ring_buf_idx_t bytes_read = 0;
-    uint8_t *         data_u8    = (uint8_t *)data;
+    px_ring_buf_idx_t idx_wr = px_ring_buf->idx_wr;
+    px_ring_buf_idx_t idx_rd = px_ring_buf->idx_rd;
+    uint8_t *         data_u8 = (uint8_t *)data;
+    size_t            chunk_size;
+    size_t            bytes_read = 0;
 
-    while(nr_of_bytes != 0)
+    // Make sure data is read after it was published by the producer
+    PX_MEM_BARRIER_ACQUIRE();
+
+#if PX_RING_BUF_CFG_POW2
+    // Clip to number of bytes in buffer
+    if(nr_of_bytes > px_ring_buf_used(idx_wr, idx_rd))
+    {
+        nr_of_bytes = px_ring_buf_used(idx_wr, idx_rd);
+    }
+    // Data up to end of buffer
+    idx_rd     = px_ring_buf_idx_offset(px_ring_buf, idx_rd);
+    chunk_size = px_ring_buf->buf_size - idx_rd;
+    if(chunk_size > nr_of_bytes)
     {
-        // Buffer empty?
-        if(idx_peek == px_ring_buf->idx_wr)
+        chunk_size = nr_of_bytes;
+    }
+    memcpy(data_u8, &px_ring_buf->buf[idx_rd], chunk_size);
+    // Rest of data at start of buffer
+    memcpy(data_u8 + chunk_size, &px_ring_buf->buf[0], nr_of_bytes - chunk_size);
+    bytes_read = nr_of_bytes;
+#else
+    if(idx_rd > idx_wr)
+    {
+        // |xxxxxx___________________xxx|
+        //  >>>>>>W                  R>>
+        chunk_size = px_ring_buf->buf_size - idx_rd;
+        if(chunk_size > nr_of_bytes)
         {
-            // Yes
-            break;
+            chunk_size = nr_of_bytes;
         }
-        // Fetch data
-        *data_u8++ = px_ring_buf->buf[idx_peek];
-        // Advance index
-        idx_peek = px_ring_buf_idx_next(px_ring_buf, idx_peek);
-        // Next byte
-        bytes_read++;
-        nr_of_bytes--;
+        memcpy(data_u8, &px_ring_buf->buf[idx_rd], chunk_size);
+        data_u8     += chunk_size;
+        bytes_read  += chunk_size;
+        nr_of_bytes -= chunk_size;
+        idx_rd       = 0;
     }
+    // |________xxxxxxxxx___________|
+    //          R>>>>>>>>W
+    chunk_size = idx_wr - idx_rd;
+    if(chunk_size > nr_of_bytes)
+    {
+        chunk_size = nr_of_bytes;
+    }
+    memcpy(data_u8, &px_ring_buf->buf[idx_rd], chunk_size);
+    bytes_read += chunk_size;
+#endif
 
-    return bytes_read;
+    return (px_ring_buf_idx_t)bytes_read;
 }
 
 px_ring_buf_idx_t px_ring_buf_count_used(px_ring_buf_t * px_ring_buf)
 {
+#if PX_RING_BUF_CFG_POW2
+    return px_ring_buf_used(px_ring_buf->idx_wr, px_ring_buf->idx_rd);
+#else
     px_ring_buf_idx_t count_used;
     px_ring_buf_idx_t idx_wr = px_ring_buf->idx_wr;
     px_ring_buf_idx_t idx_rd = px_ring_buf->idx_rd;
@@ -329,10 +535,14 @@ px_ring_buf_idx_t px_ring_buf_count_used(px_ring_buf_t * px_ring_buf)
     }
 
     return count_used;
+#endif
 }
 
 px_ring_buf_idx_t px_ring_buf_count_free(px_ring_buf_t * px_ring_buf)
 {
+#if PX_RING_BUF_CFG_POW2
+    return px_ring_buf->buf_size - px_ring_buf_used(px_ring_buf->idx_wr, px_ring_buf->idx_rd);
+#else
     px_ring_buf_idx_t count_free;
     px_ring_buf_idx_t idx_wr = px_ring_buf->idx_wr;
     px_ring_buf_idx_t idx_rd = px_ring_buf->idx_rd;
@@ -356,14 +566,15 @@ px_ring_buf_idx_t px_ring_buf_count_free(px_ring_buf_t * px_ring_buf)
     }
 
     return count_free;
+#endif
 }
 
 void px_ring_buf_log_report(px_ring_buf_t * px_ring_buf)
 {
-    PX_LOG_TRACE("WR=%u\n",   px_ring_buf->idx_wr);
-    PX_LOG_TRACE("RD=%u\n",   px_ring_buf->idx_rd);
-    PX_LOG_TRACE("Size=%u\n", px_ring_buf->buf_size);
-    PX_LOG_TRACE("Used=%u\n", px_ring_buf_count_used(px_ring_buf));
-    PX_LOG_TRACE("Free=%u\n", px_ring_buf_count_free(px_ring_buf));
+    PX_LOG_TRACE("WR=%lu\n",   (unsigned long)px_ring_buf->idx_wr);
+    PX_LOG_TRACE("RD=%lu\n",   (unsigned long)px_ring_buf->idx_rd);
+    PX_LOG_TRACE("Size=%lu\n", (unsigned long)px_ring_buf->buf_size);
+    PX_LOG_TRACE("Used=%lu\n", (unsigned long)px_ring_buf_count_used(px_ring_buf));
+    PX_LOG_TRACE("Free=%lu\n", (unsigned long)px_ring_buf_count_free(px_ring_buf));
 }
 
@@ -24,10 +24,20 @@
 
 /* _____PROJECT INCLUDES_____________________________________________________ */
 #include "px_sbuf.h"
+#if PX_SBUF_CFG_MEM_POOL
+#include "px_mem_pool.h"
+#endif
 
 /* _____LOCAL DEFINITIONS____________________________________________________ */
 
 /* _____MACROS_______________________________________________________________ */
+#if PX_SBUF_CFG_MEM_POOL
+#define PX_SBUF_MALLOC(size)    px_mem_pool_malloc(size)
+#define PX_SBUF_FREE(ptr)       px_mem_pool_free(ptr)
+#else
+#define PX_SBUF_MALLOC(size)    malloc(size)
+#define PX_SBUF_FREE(ptr)       free(ptr)
+#endif
 
 /* _____GLOBAL VARIABLES_____________________________________________________ */
 
@@ -48,7 +58,7 @@ void px_sbuf_init(px_sbuf_t * sbuf, char * buf, size_t buf_size)
 
 bool px_sbuf_malloc(px_sbuf_t * sbuf, size_t buf_size)
 {
-    char * buf = malloc(buf_size);
+    char * buf = PX_SBUF_MALLOC(buf_size);
     if(buf != NULL)
     {
         px_sbuf_init(sbuf, buf, buf_size);
@@ -63,7 +73,7 @@ bool px_sbuf_malloc(px_sbuf_t * sbuf, size_t buf_size)
 
 void px_sbuf_free(px_sbuf_t * sbuf)
 {
-    free(sbuf->buf);
+    PX_SBUF_FREE(sbuf->buf);
     memset(sbuf, 0, sizeof(*sbuf));
 }
 
@@ -206,15 +216,19 @@ void px_sbuf_printf(px_sbuf_t * sbuf, const char * format, ...)
 
 void px_sbuf_vprintf(px_sbuf_t * sbuf, const char * format, const va_list * args)
 {
-    size_t rem_buf_size;
-    int    i;
+    size_t  rem_buf_size;
+    int     i;
+    va_list args_copy;
 
     // Buffer full?
     if(px_sbuf_is_full(sbuf)) return;
     // Calculate remaining size
     rem_buf_size = sbuf->buf_size - sbuf->index;
-    // Append formatted string
-    i = vsnprintf(&sbuf->buf[sbuf->index], rem_buf_size, format, *args);
+    // Append formatted string (vsnprintf() needs a non-const va_list; source
+    // of copy is not modified)
+    va_copy(args_copy, *(va_list *)args);
+    i = vsnprintf(&sbuf->buf[sbuf->index], rem_buf_size, format, args_copy);
+    va_end(args_copy);
     // Error?
     if(i <= 0)
     {
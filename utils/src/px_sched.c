@@ -0,0 +1,306 @@
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_sched.h : Tickless cooperative scheduler
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_sched.h"
+#include "px_log.h"
+
+/* _____LOCAL DEFINITIONS____________________________________________________ */
+PX_LOG_NAME("px_sched");
+
+/* _____MACROS_______________________________________________________________ */
+
+/* _____GLOBAL VARIABLES_____________________________________________________ */
+
+/* _____LOCAL VARIABLES______________________________________________________ */
+/// List of tasks
+static px_link_list_t px_sched_task_list;
+
+/// List of registered application timers
+static px_link_list_t px_sched_systmr_list;
+
+/* _____LOCAL FUNCTION DECLARATIONS__________________________________________ */
+
+/* _____LOCAL FUNCTIONS______________________________________________________ */
+/// Return number of ticks until timer expires; PX_SCHED_TICKS_INFINITE if stopped
+static px_systmr_ticks_t px_sched_systmr_ticks(px_systmr_t * systmr)
+{
+    if(systmr->state == PX_SYSTMR_STOPPED)
+    {
+        return PX_SCHED_TICKS_INFINITE;
+    }
+    return px_systmr_ticks_remaining(systmr);
+}
+
+/// Return number of ticks until application timer expires; PX_SCHED_TICKS_INFINITE if stopped or already expired
+static px_systmr_ticks_t px_sched_app_systmr_ticks(px_systmr_t * systmr)
+{
+    // Expiry already seen (by application or previous deadline)?
+    if(systmr->state == PX_SYSTMR_EXPIRED)
+    {
+        // Do not wake up again until application restarts timer
+        return PX_SCHED_TICKS_INFINITE;
+    }
+    return px_sched_systmr_ticks(systmr);
+}
+
+#if PX_SCHED_CFG_RTC
+/// Return number of ticks until RTC alarm of task; PX_SCHED_TICKS_INFINITE if disabled
+static px_systmr_ticks_t px_sched_alarm_ticks(const px_sched_task_t * task,
+                                              px_rtc_sec_since_y2k_t  rtc_sec)
+{
+    px_rtc_sec_since_y2k_t sec;
+
+    if(!task->alarm)
+    {
+        return PX_SCHED_TICKS_INFINITE;
+    }
+    // Alarm time reached?
+    if(rtc_sec >= task->alarm_sec)
+    {
+        return 0;
+    }
+    // Alarm in the next second?
+    sec = task->alarm_sec - rtc_sec;
+    if(sec == 1)
+    {
+        // Poll RTC (start of second is not known)
+        return PX_SCHED_CFG_RTC_POLL_TICKS;
+    }
+    // Limit to prevent overflow
+    if((sec - 1) >= (PX_SCHED_TICKS_INFINITE / PX_SYSTMR_TICKS_PER_SEC))
+    {
+        return PX_SCHED_TICKS_INFINITE - 1;
+    }
+    // Sleep until start of the second before the alarm (at the latest)
+    return (px_systmr_ticks_t)(sec - 1) * PX_SYSTMR_TICKS_PER_SEC;
+}
+#endif
+
+/* _____GLOBAL FUNCTIONS_____________________________________________________ */
+void px_sched_init(void)
+{
+    px_link_list_init(&px_sched_task_list, 0);
+    px_link_list_init(&px_sched_systmr_list, 0);
+}
+
+void px_sched_task_add(px_sched_task_t *  task,
+                       px_sched_task_fn_t fn,
+                       void *             arg)
+{
+    PX_LOG_ASSERT(task != NULL);
+    PX_LOG_ASSERT(fn != NULL);
+
+    task->fn     = fn;
+    task->arg    = arg;
+    task->signal = false;
+    px_systmr_stop(&task->tmr);
+#if PX_SCHED_CFG_RTC
+    task->alarm  = false;
+#endif
+    px_link_list_item_init(&px_sched_task_list, &task->list_item);
+    px_link_list_insert_item_end(&px_sched_task_list, &task->list_item);
+}
+
+void px_sched_task_remove(px_sched_task_t * task)
+{
+    px_link_list_remove_item(&px_sched_task_list, &task->list_item);
+}
+
+void px_sched_task_start(px_sched_task_t * task,
+                         px_systmr_ticks_t delay_in_ticks)
+{
+    px_systmr_start(&task->tmr, delay_in_ticks);
+}
+
+void px_sched_task_stop(px_sched_task_t * task)
+{
+    px_systmr_stop(&task->tmr);
+}
+
+void px_sched_task_signal(px_sched_task_t * task)
+{
+    task->signal = true;
+}
+
+#if PX_SCHED_CFG_RTC
+void px_sched_task_alarm_set(px_sched_task_t *      task,
+                             px_rtc_sec_since_y2k_t alarm_sec)
+{
+    task->alarm_sec = alarm_sec;
+    task->alarm     = true;
+}
+
+void px_sched_task_alarm_clear(px_sched_task_t * task)
+{
+    task->alarm = false;
+}
+#endif
+
+void px_sched_systmr_register(px_sched_systmr_t * sched_systmr,
+                              px_systmr_t *       systmr)
+{
+    PX_LOG_ASSERT(sched_systmr != NULL);
+    PX_LOG_ASSERT(systmr != NULL);
+
+    sched_systmr->systmr = systmr;
+    px_link_list_item_init(&px_sched_systmr_list, &sched_systmr->list_item);
+    px_link_list_insert_item_end(&px_sched_systmr_list, &sched_systmr->list_item);
+}
+
+void px_sched_systmr_unregister(px_sched_systmr_t * sched_systmr)
+{
+    px_link_list_remove_item(&px_sched_systmr_list, &sched_systmr->list_item);
+}
+
+bool px_sched_run(void)
+{
+    px_link_list_item_t * item;
+    px_sched_task_t *     task;
+    bool                  ready;
+    bool                  task_has_run = false;
+#if PX_SCHED_CFG_RTC
+    px_rtc_sec_since_y2k_t rtc_sec = PX_SCHED_CFG_RTC_SEC_RD();
+#endif
+
+    item = px_link_list_get_item_first(&px_sched_task_list);
+    while(item != NULL)
+    {
+        task = (px_sched_task_t *)item;
+        // Fetch next task now in case task removes itself
+        item = px_link_list_get_item_next(&px_sched_task_list, item);
+
+        ready = false;
+        // Signalled?
+        if(task->signal)
+        {
+            task->signal = false;
+            ready        = true;
+        }
+        // Timer expired?
+        if(px_systmr_has_expired(&task->tmr))
+        {
+            // Stop timer so that task only runs once (task may restart it)
+            px_systmr_stop(&task->tmr);
+            ready = true;
+        }
+#if PX_SCHED_CFG_RTC
+        // RTC alarm?
+        if(task->alarm && (rtc_sec >= task->alarm_sec))
+        {
+            task->alarm = false;
+            ready       = true;
+        }
+#endif
+        if(ready)
+        {
+            (*task->fn)(task);
+            task_has_run = true;
+        }
+    }
+
+    return task_has_run;
+}
+
+px_systmr_ticks_t px_sched_ticks_to_next_deadline(void)
+{
+    px_link_list_item_t * item;
+    px_sched_task_t *     task;
+    px_sched_systmr_t *   sched_systmr;
+    px_systmr_ticks_t     ticks;
+    px_systmr_ticks_t     ticks_min = PX_SCHED_TICKS_INFINITE;
+#if PX_SCHED_CFG_RTC
+    px_rtc_sec_since_y2k_t rtc_sec = PX_SCHED_CFG_RTC_SEC_RD();
+#endif
+
+    // Find first task deadline
+    item = px_link_list_get_item_first(&px_sched_task_list);
+    while(item != NULL)
+    {
+        task = (px_sched_task_t *)item;
+        if(task->signal)
+        {
+            return 0;
+        }
+        ticks = px_sched_systmr_ticks(&task->tmr);
+        if(ticks < ticks_min)
+        {
+            ticks_min = ticks;
+        }
+#if PX_SCHED_CFG_RTC
+        ticks = px_sched_alarm_ticks(task, rtc_sec);
+        if(ticks < ticks_min)
+        {
+            ticks_min = ticks;
+        }
+#endif
+        if(ticks_min == 0)
+        {
+            return 0;
+        }
+        item = px_link_list_get_item_next(&px_sched_task_list, item);
+    }
+
+    // Find first application timer deadline
+    item = px_link_list_get_item_first(&px_sched_systmr_list);
+    while(item != NULL)
+    {
+        sched_systmr = (px_sched_systmr_t *)item;
+        ticks = px_sched_app_systmr_ticks(sched_systmr->systmr);
+        if(ticks < ticks_min)
+        {
+            ticks_min = ticks;
+            if(ticks_min == 0)
+            {
+                return 0;
+            }
+        }
+        item = px_link_list_get_item_next(&px_sched_systmr_list, item);
+    }
+
+    return ticks_min;
+}
+
+void px_sched_idle(void)
+{
+    px_systmr_ticks_t ticks;
+
+    // Disable interrupts so that a task signal is not missed before sleeping
+    PX_SCHED_CFG_CRITICAL_ENTER();
+    ticks = px_sched_ticks_to_next_deadline();
+    if(ticks != 0)
+    {
+        if(ticks >= PX_SCHED_CFG_IDLE_TICKS_MIN)
+        {
+            if(ticks > PX_SCHED_CFG_IDLE_TICKS_MAX)
+            {
+                ticks = PX_SCHED_CFG_IDLE_TICKS_MAX;
+            }
+            // Suppress tick interrupt and sleep until deadline (or interrupt)
+            PX_SCHED_CFG_SLEEP(ticks);
+        }
+        else
+        {
+            // Wait for next tick (or interrupt)
+            PX_SCHED_CFG_WAIT();
+        }
+    }
+    PX_SCHED_CFG_CRITICAL_EXIT();
+}
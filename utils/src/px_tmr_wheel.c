@@ -0,0 +1,352 @@
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_tmr_wheel.h : Hierarchical timer wheel
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_tmr_wheel.h"
+#include "px_log.h"
+
+/* _____LOCAL DEFINITIONS____________________________________________________ */
+PX_LOG_NAME("px_tmr_wheel");
+
+#if ((PX_TMR_WHEEL_CFG_SLOT_BITS < 1) || (PX_TMR_WHEEL_CFG_SLOT_BITS > 8))
+#error "PX_TMR_WHEEL_CFG_SLOT_BITS must be 1 to 8"
+#endif
+
+/// Slot index mask
+#define PX_TMR_WHEEL_SLOT_MASK  (PX_TMR_WHEEL_SLOTS - 1)
+
+/// Half of the tick counter range
+#define PX_TMR_WHEEL_TICK_HALF  ((px_systmr_ticks_t)(PX_TMR_WHEEL_TICKS_INFINITE / 2 + 1))
+
+/* _____MACROS_______________________________________________________________ */
+/// Slot index of tick on specified level
+#define PX_TMR_WHEEL_SLOT_IDX(tick, level) \
+    ((uint32_t)((uint32_t)(tick) >> (PX_TMR_WHEEL_CFG_SLOT_BITS * (level))) & PX_TMR_WHEEL_SLOT_MASK)
+
+/* _____GLOBAL VARIABLES_____________________________________________________ */
+
+/* _____LOCAL VARIABLES______________________________________________________ */
+
+/* _____LOCAL FUNCTION DECLARATIONS__________________________________________ */
+
+/* _____LOCAL FUNCTIONS______________________________________________________ */
+/// See if tick A is before tick B (with provision for counter roll-over)
+static inline bool px_tmr_wheel_tick_is_before(px_systmr_ticks_t tick_a,
+                                               px_systmr_ticks_t tick_b)
+{
+    return ((px_systmr_ticks_t)(tick_a - tick_b) >= PX_TMR_WHEEL_TICK_HALF);
+}
+
+static void px_tmr_wheel_add(px_tmr_wheel_t *     wheel,
+                             px_tmr_wheel_tmr_t * tmr)
+{
+    px_systmr_ticks_t expiry_tick = tmr->expiry_tick;
+    uint32_t          diff;
+    uint8_t           level;
+
+    // Deadline already passed? Expire on next tick to service
+    if(px_tmr_wheel_tick_is_before(expiry_tick, wheel->tick))
+    {
+        expiry_tick = wheel->tick;
+    }
+    // Level is determined by the highest slot index that differs from the next tick to service
+    diff  = (uint32_t)(expiry_tick ^ wheel->tick) >> PX_TMR_WHEEL_CFG_SLOT_BITS;
+    level = 0;
+    while(diff != 0)
+    {
+        level++;
+        diff >>= PX_TMR_WHEEL_CFG_SLOT_BITS;
+    }
+    if(level >= PX_TMR_WHEEL_CFG_LEVELS)
+    {
+        tmr->slot = &wheel->overflow;
+    }
+    else
+    {
+        tmr->slot = &wheel->slot[level][PX_TMR_WHEEL_SLOT_IDX(expiry_tick, level)];
+    }
+    px_link_list_insert_item_end(tmr->slot, &tmr->list_item);
+}
+
+static void px_tmr_wheel_remove(px_tmr_wheel_tmr_t * tmr)
+{
+    if(tmr->slot != NULL)
+    {
+        px_link_list_remove_item(tmr->slot, &tmr->list_item);
+        tmr->slot = NULL;
+    }
+}
+
+static void px_tmr_wheel_cascade(px_tmr_wheel_t * wheel,
+                                 px_link_list_t * slot)
+{
+    px_link_list_t       list;
+    px_tmr_wheel_tmr_t * tmr;
+
+    // Take all timers out of slot (a timer may be added to the same list again)
+    list = *slot;
+    px_link_list_init(slot, 0);
+    // Add each timer again (on a lower level)
+    while((tmr = (px_tmr_wheel_tmr_t *)px_link_list_remove_item_first(&list)) != NULL)
+    {
+        px_tmr_wheel_add(wheel, tmr);
+    }
+}
+
+/// Return number of ticks from wheel->tick until the first timer in the list expires
+static px_systmr_ticks_t px_tmr_wheel_list_ticks_min(px_tmr_wheel_t * wheel,
+                                                     px_link_list_t * list)
+{
+    px_tmr_wheel_tmr_t * tmr;
+    px_systmr_ticks_t    ticks;
+    px_systmr_ticks_t    ticks_min = PX_TMR_WHEEL_TICKS_INFINITE;
+
+    tmr = (px_tmr_wheel_tmr_t *)px_link_list_get_item_first(list);
+    while(tmr != NULL)
+    {
+        if(px_tmr_wheel_tick_is_before(tmr->expiry_tick, wheel->tick))
+        {
+            return 0;
+        }
+        ticks = tmr->expiry_tick - wheel->tick;
+        if(ticks < ticks_min)
+        {
+            ticks_min = ticks;
+        }
+        tmr = (px_tmr_wheel_tmr_t *)px_link_list_get_item_next(list, &tmr->list_item);
+    }
+    return ticks_min;
+}
+
+/* _____GLOBAL FUNCTIONS_____________________________________________________ */
+void px_tmr_wheel_init(px_tmr_wheel_t * wheel)
+{
+    uint8_t  level;
+    uint16_t i;
+
+    for(level = 0; level < PX_TMR_WHEEL_CFG_LEVELS; level++)
+    {
+        for(i = 0; i < PX_TMR_WHEEL_SLOTS; i++)
+        {
+            px_link_list_init(&wheel->slot[level][i], 0);
+        }
+    }
+    px_link_list_init(&wheel->overflow, 0);
+    px_link_list_init(&wheel->expired, 0);
+    wheel->tick = px_sysclk_get_tick_count();
+}
+
+void px_tmr_wheel_tmr_init(px_tmr_wheel_tmr_t *     tmr,
+                           px_tmr_wheel_on_expire_t on_expire,
+                           void *                   arg)
+{
+    tmr->list_item.next = NULL;
+    tmr->list_item.prev = NULL;
+    tmr->slot           = NULL;
+    tmr->expiry_tick    = 0;
+    tmr->period         = 0;
+    tmr->on_expire      = on_expire;
+    tmr->arg            = arg;
+}
+
+void px_tmr_wheel_start(px_tmr_wheel_t *     wheel,
+                        px_tmr_wheel_tmr_t * tmr,
+                        px_systmr_ticks_t    delay_in_ticks)
+{
+    px_tmr_wheel_start_at(wheel, tmr, px_sysclk_get_tick_count() + delay_in_ticks);
+}
+
+void px_tmr_wheel_start_at(px_tmr_wheel_t *     wheel,
+                           px_tmr_wheel_tmr_t * tmr,
+                           px_systmr_ticks_t    expiry_tick)
+{
+    px_tmr_wheel_remove(tmr);
+    tmr->expiry_tick = expiry_tick;
+    tmr->period      = 0;
+    px_tmr_wheel_add(wheel, tmr);
+}
+
+void px_tmr_wheel_start_periodic(px_tmr_wheel_t *     wheel,
+                                 px_tmr_wheel_tmr_t * tmr,
+                                 px_systmr_ticks_t    period_in_ticks)
+{
+    PX_LOG_ASSERT(period_in_ticks != 0);
+
+    px_tmr_wheel_remove(tmr);
+    tmr->expiry_tick = px_sysclk_get_tick_count() + period_in_ticks;
+    tmr->period      = period_in_ticks;
+    px_tmr_wheel_add(wheel, tmr);
+}
+
+void px_tmr_wheel_stop(px_tmr_wheel_t *     wheel,
+                       px_tmr_wheel_tmr_t * tmr)
+{
+    px_tmr_wheel_remove(tmr);
+}
+
+bool px_tmr_wheel_is_running(const px_tmr_wheel_tmr_t * tmr)
+{
+    return (tmr->slot != NULL);
+}
+
+void px_tmr_wheel_service(px_tmr_wheel_t * wheel)
+{
+    px_systmr_ticks_t    tick_now = px_sysclk_get_tick_count();
+    px_systmr_ticks_t    tick;
+    px_link_list_t *     slot;
+    px_tmr_wheel_tmr_t * tmr;
+    uint32_t             idx;
+    uint32_t             i;
+    uint8_t              level;
+
+    // Service each tick up to and including the current tick
+    while(!px_tmr_wheel_tick_is_before(tick_now, wheel->tick))
+    {
+        tick = wheel->tick;
+        idx  = PX_TMR_WHEEL_SLOT_IDX(tick, 0);
+        if(idx == 0)
+        {
+            // Level 0 wrapped. Move timers from the next slot(s) of higher levels down
+            for(level = 1; level < PX_TMR_WHEEL_CFG_LEVELS; level++)
+            {
+                i = PX_TMR_WHEEL_SLOT_IDX(tick, level);
+                px_tmr_wheel_cascade(wheel, &wheel->slot[level][i]);
+                if(i != 0)
+                {
+                    break;
+                }
+            }
+            if(level == PX_TMR_WHEEL_CFG_LEVELS)
+            {
+                // All levels wrapped
+                px_tmr_wheel_cascade(wheel, &wheel->overflow);
+            }
+        }
+        slot = &wheel->slot[0][idx];
+        if(px_link_list_is_empty(slot))
+        {
+            // Skip empty slots up to the next level 0 wrap (or current tick)
+            for(i = idx + 1; i < PX_TMR_WHEEL_SLOTS; i++)
+            {
+                if(!px_link_list_is_empty(&wheel->slot[0][i]))
+                {
+                    break;
+                }
+            }
+            if((px_systmr_ticks_t)(i - idx) > (px_systmr_ticks_t)(tick_now - tick))
+            {
+                wheel->tick = tick_now + 1;
+            }
+            else
+            {
+                wheel->tick = tick + (px_systmr_ticks_t)(i - idx);
+            }
+            continue;
+        }
+        // Move expired timers to expired list (an expiry function may stop them)
+        while((tmr = (px_tmr_wheel_tmr_t *)px_link_list_remove_item_first(slot)) != NULL)
+        {
+            px_link_list_insert_item_end(&wheel->expired, &tmr->list_item);
+            tmr->slot = &wheel->expired;
+        }
+        wheel->tick = tick + 1;
+        // Call expiry function of each timer
+        while((tmr = (px_tmr_wheel_tmr_t *)px_link_list_remove_item_first(&wheel->expired)) != NULL)
+        {
+            tmr->slot = NULL;
+            if(tmr->period != 0)
+            {
+                // Restart periodic timer from expiry tick (no drift)
+                tmr->expiry_tick += tmr->period;
+                px_tmr_wheel_add(wheel, tmr);
+            }
+            tmr->on_expire(tmr);
+        }
+    }
+}
+
+px_systmr_ticks_t px_tmr_wheel_ticks_to_next_expiry(px_tmr_wheel_t * wheel)
+{
+    px_systmr_ticks_t tick_now;
+    px_systmr_ticks_t ticks_min = PX_TMR_WHEEL_TICKS_INFINITE;
+    px_systmr_ticks_t ticks;
+    uint32_t          idx;
+    uint32_t          i;
+    uint8_t           level;
+
+    /*
+     *  Timers on a higher level expire after timers on a lower level, except
+     *  for the slot of a higher level that still has to be moved down when
+     *  the next tick to service is on a level 0 wrap boundary.
+     */
+    // First non-empty slot on level 0
+    idx = PX_TMR_WHEEL_SLOT_IDX(wheel->tick, 0);
+    for(i = idx; i < PX_TMR_WHEEL_SLOTS; i++)
+    {
+        if(!px_link_list_is_empty(&wheel->slot[0][i]))
+        {
+            ticks_min = (px_systmr_ticks_t)(i - idx);
+            break;
+        }
+    }
+    // First timer in first non-empty slot on higher levels
+    for(level = 1; level < PX_TMR_WHEEL_CFG_LEVELS; level++)
+    {
+        if(   (ticks_min != PX_TMR_WHEEL_TICKS_INFINITE)
+           && (((uint32_t)wheel->tick & ((1ul << (PX_TMR_WHEEL_CFG_SLOT_BITS * level)) - 1)) != 0)  )
+        {
+            // Found and no higher level slot has to be moved down
+            break;
+        }
+        for(i = PX_TMR_WHEEL_SLOT_IDX(wheel->tick, level); i < PX_TMR_WHEEL_SLOTS; i++)
+        {
+            if(!px_link_list_is_empty(&wheel->slot[level][i]))
+            {
+                ticks = px_tmr_wheel_list_ticks_min(wheel, &wheel->slot[level][i]);
+                if(ticks < ticks_min)
+                {
+                    ticks_min = ticks;
+                }
+                break;
+            }
+        }
+    }
+    // Overflow list
+    if(   (ticks_min == PX_TMR_WHEEL_TICKS_INFINITE)
+       || (level == PX_TMR_WHEEL_CFG_LEVELS)       )
+    {
+        ticks = px_tmr_wheel_list_ticks_min(wheel, &wheel->overflow);
+        if(ticks < ticks_min)
+        {
+            ticks_min = ticks;
+        }
+    }
+    if(ticks_min == PX_TMR_WHEEL_TICKS_INFINITE)
+    {
+        return PX_TMR_WHEEL_TICKS_INFINITE;
+    }
+    // Convert to number of ticks from current tick
+    tick_now = px_sysclk_get_tick_count();
+    if(px_tmr_wheel_tick_is_before(wheel->tick + ticks_min, tick_now))
+    {
+        return 0;
+    }
+    return (px_systmr_ticks_t)(wheel->tick + ticks_min - tick_now);
+}
@@ -0,0 +1,95 @@
+/* =============================================================================
+     ____    ___    ____    ___    _   _    ___    __  __   ___  __  __ TM
+    |  _ \  |_ _|  / ___|  / _ \  | \ | |  / _ \  |  \/  | |_ _| \ \/ /
+    | |_) |  | |  | |     | | | | |  \| | | | | | | |\/| |  | |   \  /
+    |  __/   | |  | |___  | |_| | | |\  | | |_| | | |  | |  | |   /  \
+    |_|     |___|  \____|  \___/  |_| \_|  \___/  |_|  |_| |___| /_/\_\
+
+    Copyright (c) 2026 Pieter Conradie <https://piconomix.com>
+
+    License: MIT
+    https://github.com/piconomix/px-fwlib/blob/master/LICENSE.md
+
+    Title:          px_wr_buf.h : Buffered writer that batches output
+    Author(s):      Pieter Conradie
+    Creation Date:  2026-10-17
+
+============================================================================= */
+
+/* _____STANDARD INCLUDES____________________________________________________ */
+
+/* _____PROJECT INCLUDES_____________________________________________________ */
+#include "px_wr_buf.h"
+#include "px_log.h"
+
+/* _____LOCAL DEFINITIONS____________________________________________________ */
+PX_LOG_NAME("px_wr_buf");
+
+/* _____MACROS_______________________________________________________________ */
+
+/* _____GLOBAL VARIABLES_____________________________________________________ */
+
+/* _____LOCAL VARIABLES______________________________________________________ */
+
+/* _____LOCAL FUNCTION DECLARATIONS__________________________________________ */
+
+/* _____LOCAL FUNCTIONS______________________________________________________ */
+
+/* _____GLOBAL FUNCTIONS_____________________________________________________ */
+void px_wr_buf_init(px_wr_buf_t *        wr_buf,
+                    char *               buf,
+                    size_t               buf_size,
+                    px_wr_buf_flush_fn_t flush_fn)
+{
+    PX_LOG_ASSERT(buf != NULL);
+    PX_LOG_ASSERT(buf_size >= 2);
+    PX_LOG_ASSERT(flush_fn != NULL);
+
+    px_sbuf_init(&wr_buf->sbuf, buf, buf_size);
+    wr_buf->flush_fn = flush_fn;
+    px_wr_buf_reset_stats(wr_buf);
+}
+
+void px_wr_buf_putchar(px_wr_buf_t * wr_buf, char c)
+{
+    // Buffer full?
+    if(px_sbuf_is_full(&wr_buf->sbuf))
+    {
+        px_wr_buf_flush(wr_buf);
+    }
+    px_sbuf_putchar(&wr_buf->sbuf, c);
+    wr_buf->stats.nr_of_bytes++;
+}
+
+void px_wr_buf_print(px_wr_buf_t * wr_buf, const char * str)
+{
+    while(*str != '\0')
+    {
+        px_wr_buf_putchar(wr_buf, *str++);
+    }
+}
+
+void px_wr_buf_puts(px_wr_buf_t * wr_buf, const char * str)
+{
+    px_wr_buf_print(wr_buf, str);
+    px_wr_buf_putchar(wr_buf, '\n');
+}
+
+void px_wr_buf_flush(px_wr_buf_t * wr_buf)
+{
+    // Empty?
+    if(px_sbuf_is_empty(&wr_buf->sbuf))
+    {
+        return;
+    }
+    (*wr_buf->flush_fn)(px_sbuf_get_str(&wr_buf->sbuf),
+                        px_sbuf_get_len(&wr_buf->sbuf));
+    px_sbuf_reset(&wr_buf->sbuf);
+    wr_buf->stats.nr_of_flushes++;
+}
+
+void px_wr_buf_reset_stats(px_wr_buf_t * wr_buf)
+{
+    wr_buf->stats.nr_of_bytes   = 0;
+    wr_buf->stats.nr_of_flushes = 0;
+}
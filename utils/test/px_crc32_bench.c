@@ -0,0 +1,139 @@
+/*
+ *  Host benchmark for px_crc32. The implementation is selected at compile time
+ *  (see px_crc32_cfg.h), so tools/px_host_test/Makefile builds one executable
+ *  per option:
+ *
+ *      make -C tools/px_host_test run
+ *
+ *  Each result is checked against a bitwise reference over many lengths and
+ *  alignments before the throughput is measured for different block sizes.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "px_crc32.h"
+#include "px_host_bench.h"
+
+/// Total number of bytes processed for each block size
+#define BENCH_TOTAL_BYTES   (16ul * 1024 * 1024)
+/// Size of test buffer
+#define BENCH_BUF_SIZE      65536
+
+static uint8_t           bench_buf[BENCH_BUF_SIZE + 8];
+static volatile uint32_t bench_sink;
+
+static const char * bench_name(void)
+{
+#if PX_CRC32_RAM_TABLE
+    switch(PX_CRC32_SLICE_BY)
+    {
+    case 4:  return "slice-by-4 (RAM table)";
+    case 8:  return "slice-by-8 (RAM table)";
+    default: return "table (RAM)";
+    }
+#elif PX_CRC32_ROM_TABLE
+    switch(PX_CRC32_SLICE_BY)
+    {
+    case 4:  return "slice-by-4 (ROM table)";
+    case 8:  return "slice-by-8 (ROM table)";
+    default: return "table (ROM)";
+    }
+#else
+    return "bitwise (no table)";
+#endif
+}
+
+static uint32_t bench_crc32_ref(uint32_t crc, const uint8_t * data, size_t nr_of_bytes)
+{
+    uint8_t i;
+
+    while(nr_of_bytes--)
+    {
+        crc ^= *data++;
+        for(i = 0; i < 8; i++)
+        {
+            crc = (crc & 1) ? (crc >> 1) ^ PX_CRC32_POLYNOMIAL : (crc >> 1);
+        }
+    }
+    return crc;
+}
+
+static void bench_verify(void)
+{
+    size_t offset;
+    size_t len;
+
+    // Standard check value of CRC-32 over "123456789"
+    PX_HOST_CHECK((px_crc32_update_data(PX_CRC32_INIT_VAL, "123456789", 9) ^ 0xffffffff) == 0xcbf43926);
+    // Compare with reference over different alignments and lengths
+    for(offset = 0; offset < 8; offset++)
+    {
+        for(len = 0; len < 100; len++)
+        {
+            PX_HOST_CHECK(   px_crc32_update_data(PX_CRC32_INIT_VAL, &bench_buf[offset], len)
+                          == bench_crc32_ref(PX_CRC32_INIT_VAL, &bench_buf[offset], len)     );
+        }
+    }
+    PX_HOST_CHECK(   px_crc32_update_data(PX_CRC32_INIT_VAL, &bench_buf[1], BENCH_BUF_SIZE)
+                  == bench_crc32_ref(PX_CRC32_INIT_VAL, &bench_buf[1], BENCH_BUF_SIZE)     );
+    // Byte at a time must give the same result
+    PX_HOST_CHECK(   px_crc32_update_u8(px_crc32_update_data(PX_CRC32_INIT_VAL, bench_buf, 99), bench_buf[99])
+                  == px_crc32_update_data(PX_CRC32_INIT_VAL, bench_buf, 100)                                   );
+}
+
+static void bench_block_size(size_t block_size)
+{
+    uint64_t start_us;
+    uint64_t start_cycles;
+    uint64_t time_us;
+    uint64_t cycles;
+    uint32_t crc = PX_CRC32_INIT_VAL;
+    size_t   nr_of_blocks = BENCH_TOTAL_BYTES / block_size;
+    size_t   i;
+
+    start_us     = px_host_bench_time_us();
+    start_cycles = px_host_bench_cycles();
+    for(i = 0; i < nr_of_blocks; i++)
+    {
+        crc = px_crc32_update_data(crc, &bench_buf[(i * 8) % (BENCH_BUF_SIZE - block_size + 1)], block_size);
+    }
+    cycles  = px_host_bench_cycles() - start_cycles;
+    time_us = px_host_bench_time_us() - start_us;
+    bench_sink = crc;
+
+    printf("%10lu %12.1f", (unsigned long)block_size,
+           px_host_bench_per_sec(nr_of_blocks * block_size, time_us) / 1e6);
+    if(PX_HOST_BENCH_HAS_CYCLES && (cycles != 0))
+    {
+        printf(" %12.3f\n", (double)(nr_of_blocks * block_size) / (double)cycles);
+    }
+    else
+    {
+        printf(" %12s\n", "n/a");
+    }
+}
+
+int main(void)
+{
+    size_t i;
+
+    // Fill buffer with pseudo random data
+    srand(1);
+    for(i = 0; i < sizeof(bench_buf); i++)
+    {
+        bench_buf[i] = (uint8_t)rand();
+    }
+    px_crc32_init();
+
+    printf("px_crc32 benchmark: %s\n\n", bench_name());
+    bench_verify();
+
+    printf("%10s %12s %12s\n", "Block size", "MB/s", "Bytes/cycle");
+    bench_block_size(16);
+    bench_block_size(64);
+    bench_block_size(512);
+    bench_block_size(4096);
+    bench_block_size(65536);
+
+    return 0;
+}
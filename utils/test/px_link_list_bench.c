@@ -0,0 +1,434 @@
+/*
+ *  Host test and benchmark for px_link_list and px_link_list_hash. Build and
+ *  run with:
+ *
+ *      make -C tools/px_host_test run
+ *
+ *  1. px_link_list_insert_item_sorted() is checked with random keys (order and
+ *     stability of equal keys) and px_link_list_item_in_list() is checked
+ *     against px_link_list_has_item().
+ *  2. Random insert, find and remove operations on a list with hash index are
+ *     checked against a simple model (flag per key).
+ *  3. Time per operation with 10, 100 and 1000 items in the list: membership test
+ *     and remove / reinsert by key with a list walk vs the hash index, and
+ *     sorted insert of random vs ascending keys (timer list).
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "px_link_list.h"
+#include "px_link_list_hash.h"
+#include "px_host_bench.h"
+
+/// Maximum number of items
+#define BENCH_ITEMS_MAX     1000
+/// Number of hash buckets
+#define BENCH_NR_OF_BUCKETS 1024
+/// Number of operations for each time measurement
+#define BENCH_OPS           200000ul
+
+/// Test item (e.g. application timer)
+typedef struct
+{
+    px_link_list_hash_item_t item;      ///< Must be first
+    uint32_t                 expiry;    ///< Sort key
+    uint32_t                 seq;       ///< Insertion order
+} bench_item_t;
+
+/// Items (second half is used for items that are not in the list)
+static bench_item_t               bench_items[2 * BENCH_ITEMS_MAX];
+static px_link_list_hash_item_t * bench_buckets[BENCH_NR_OF_BUCKETS];
+static px_link_list_hash_t        bench_hash;
+static px_link_list_t             bench_list;
+
+/// Benchmark sizes
+static const size_t bench_sizes[] = {10, 100, 1000};
+
+/// Simple xorshift PRNG
+static uint32_t bench_rand(uint32_t * state)
+{
+    uint32_t x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+static int bench_cmp(const px_link_list_item_t * item_a,
+                     const px_link_list_item_t * item_b)
+{
+    const bench_item_t * a = (const bench_item_t *)item_a;
+    const bench_item_t * b = (const bench_item_t *)item_b;
+
+    if(a->expiry < b->expiry) return -1;
+    if(a->expiry > b->expiry) return 1;
+    return 0;
+}
+
+/// Key of each item is spread out so that keys are not simply consecutive
+static uint32_t bench_key(size_t i)
+{
+    return (uint32_t)i * 7919 + 0x10000;
+}
+
+/// Check sorted insert and constant time membership test
+static void bench_check_sorted(void)
+{
+    bench_item_t *        item;
+    bench_item_t *        item_prev;
+    px_link_list_item_t * link;
+    uint32_t              seed = 1;
+    size_t                i;
+    size_t                n;
+
+    px_link_list_init(&bench_list, 0);
+    for(i = 0; i < BENCH_ITEMS_MAX; i++)
+    {
+        px_link_list_item_init(&bench_list, &bench_items[i].item.list_item);
+        PX_HOST_CHECK(!px_link_list_item_in_list(&bench_list, &bench_items[i].item.list_item));
+    }
+    // Insert random keys (with many equal keys)
+    for(i = 0; i < BENCH_ITEMS_MAX; i++)
+    {
+        bench_items[i].expiry = bench_rand(&seed) % 64;
+        bench_items[i].seq    = (uint32_t)i;
+        PX_HOST_CHECK(px_link_list_insert_item_sorted(&bench_list, &bench_items[i].item.list_item, bench_cmp));
+    }
+    PX_HOST_CHECK(px_link_list_get_item_count(&bench_list) == BENCH_ITEMS_MAX);
+    // Check order: ascending expiry and insertion order for equal expiry
+    item_prev = NULL;
+    n         = 0;
+    for(link = px_link_list_get_item_first(&bench_list); link != NULL; link = px_link_list_get_item_next(&bench_list, link))
+    {
+        item = (bench_item_t *)link;
+        if(item_prev != NULL)
+        {
+            PX_HOST_CHECK(item_prev->expiry <= item->expiry);
+            if(item_prev->expiry == item->expiry)
+            {
+                PX_HOST_CHECK(item_prev->seq < item->seq);
+            }
+        }
+        item_prev = item;
+        n++;
+    }
+    PX_HOST_CHECK(n == BENCH_ITEMS_MAX);
+    // Remove random items and compare constant time test with list search
+    for(i = 0; i < BENCH_ITEMS_MAX * 4; i++)
+    {
+        item = &bench_items[bench_rand(&seed) % BENCH_ITEMS_MAX];
+        if(px_link_list_item_in_list(&bench_list, &item->item.list_item))
+        {
+            px_link_list_remove_item(&bench_list, &item->item.list_item);
+        }
+        else
+        {
+            PX_HOST_CHECK(px_link_list_insert_item_sorted(&bench_list, &item->item.list_item, bench_cmp));
+        }
+    }
+    for(i = 0; i < BENCH_ITEMS_MAX; i++)
+    {
+        PX_HOST_CHECK(   px_link_list_item_in_list(&bench_list, &bench_items[i].item.list_item)
+                      == px_link_list_has_item(&bench_list, &bench_items[i].item.list_item));
+    }
+    // Single item and empty list
+    while(!px_link_list_is_empty(&bench_list))
+    {
+        px_link_list_remove_item_first(&bench_list);
+    }
+    PX_HOST_CHECK(px_link_list_insert_item_sorted(&bench_list, &bench_items[0].item.list_item, bench_cmp));
+    PX_HOST_CHECK(px_link_list_item_in_list(&bench_list, &bench_items[0].item.list_item));
+    PX_HOST_CHECK(!px_link_list_item_in_list(&bench_list, &bench_items[1].item.list_item));
+    // Full list
+    px_link_list_init(&bench_list, 1);
+    PX_HOST_CHECK(px_link_list_insert_item_sorted(&bench_list, &bench_items[0].item.list_item, bench_cmp));
+    PX_HOST_CHECK(!px_link_list_insert_item_sorted(&bench_list, &bench_items[1].item.list_item, bench_cmp));
+}
+
+/// Random operations on a list with hash index compared with a model
+static void bench_check_hash(void)
+{
+    bool                       in_list[BENCH_ITEMS_MAX];
+    size_t                     count = 0;
+    bench_item_t *             item;
+    px_link_list_hash_item_t * hash_item;
+    px_link_list_item_t *      link;
+    uint32_t                   seed = 2;
+    uint32_t                   expiry_prev;
+    size_t                     i;
+    size_t                     j;
+    size_t                     n;
+
+    // Small number of buckets so that chains are long
+    px_link_list_hash_init(&bench_hash, bench_buckets, 16, BENCH_ITEMS_MAX / 2);
+    for(i = 0; i < BENCH_ITEMS_MAX; i++)
+    {
+        px_link_list_hash_item_init(&bench_hash, &bench_items[i].item);
+        in_list[i] = false;
+    }
+    for(i = 0; i < 400000; i++)
+    {
+        j    = bench_rand(&seed) % BENCH_ITEMS_MAX;
+        item = &bench_items[j];
+        switch(bench_rand(&seed) % 6)
+        {
+        case 0:
+        case 1:
+            // Insert (sorted)
+            if(in_list[j])
+            {
+                // Same key rejected
+                PX_HOST_CHECK(!px_link_list_hash_insert_item_sorted(&bench_hash, &bench_items[(j + 1) % BENCH_ITEMS_MAX].item, bench_key(j), bench_cmp));
+            }
+            else if(count == BENCH_ITEMS_MAX / 2)
+            {
+                // Full
+                PX_HOST_CHECK(!px_link_list_hash_insert_item_sorted(&bench_hash, &item->item, bench_key(j), bench_cmp));
+            }
+            else
+            {
+                item->expiry = bench_rand(&seed) % 1000;
+                PX_HOST_CHECK(px_link_list_hash_insert_item_sorted(&bench_hash, &item->item, bench_key(j), bench_cmp));
+                in_list[j] = true;
+                count++;
+            }
+            break;
+        case 2:
+            // Find
+            hash_item = px_link_list_hash_find(&bench_hash, bench_key(j));
+            PX_HOST_CHECK(hash_item == (in_list[j] ? &item->item : NULL));
+            PX_HOST_CHECK(px_link_list_hash_has_item(&bench_hash, &item->item) == in_list[j]);
+            break;
+        case 3:
+            // Remove by key
+            hash_item = px_link_list_hash_remove_key(&bench_hash, bench_key(j));
+            PX_HOST_CHECK(hash_item == (in_list[j] ? &item->item : NULL));
+            if(in_list[j])
+            {
+                in_list[j] = false;
+                count--;
+            }
+            break;
+        case 4:
+            // Remove item
+            if(in_list[j])
+            {
+                px_link_list_hash_remove_item(&bench_hash, &item->item);
+                in_list[j] = false;
+                count--;
+            }
+            break;
+        default:
+            // Remove first (earliest expiry)
+            hash_item = px_link_list_hash_remove_item_first(&bench_hash);
+            if(count == 0)
+            {
+                PX_HOST_CHECK(hash_item == NULL);
+            }
+            else
+            {
+                PX_HOST_CHECK(hash_item != NULL);
+                j = (size_t)((bench_item_t *)hash_item - bench_items);
+                PX_HOST_CHECK(in_list[j]);
+                PX_HOST_CHECK(px_link_list_hash_find(&bench_hash, bench_key(j)) == NULL);
+                in_list[j] = false;
+                count--;
+            }
+            break;
+        }
+        PX_HOST_CHECK(px_link_list_get_item_count(&bench_hash.list) == count);
+    }
+    // List must be sorted and contain the same items as the model
+    n           = 0;
+    expiry_prev = 0;
+    for(link = px_link_list_get_item_first(&bench_hash.list); link != NULL; link = px_link_list_get_item_next(&bench_hash.list, link))
+    {
+        item = (bench_item_t *)link;
+        PX_HOST_CHECK(in_list[item - bench_items]);
+        PX_HOST_CHECK(item->expiry >= expiry_prev);
+        expiry_prev = item->expiry;
+        n++;
+    }
+    PX_HOST_CHECK(n == count);
+}
+
+/// Walk the list to find the item with the specified key
+static px_link_list_hash_item_t * bench_find_walk(uint32_t key)
+{
+    px_link_list_item_t * link;
+
+    for(link = px_link_list_get_item_first(&bench_hash.list); link != NULL; link = link->next)
+    {
+        if(((px_link_list_hash_item_t *)link)->key == key)
+        {
+            return (px_link_list_hash_item_t *)link;
+        }
+    }
+    return NULL;
+}
+
+/// Fill list with hash index with n items (keys in random order)
+static void bench_fill(size_t n)
+{
+    uint32_t seed = 3;
+    size_t   i;
+    size_t   j;
+    uint32_t idx[BENCH_ITEMS_MAX];
+    uint32_t tmp;
+
+    for(i = 0; i < n; i++)
+    {
+        idx[i] = (uint32_t)i;
+    }
+    for(i = n - 1; i > 0; i--)
+    {
+        j      = bench_rand(&seed) % (i + 1);
+        tmp    = idx[i];
+        idx[i] = idx[j];
+        idx[j] = tmp;
+    }
+    px_link_list_hash_init(&bench_hash, bench_buckets, BENCH_NR_OF_BUCKETS, 0);
+    for(i = 0; i < 2 * BENCH_ITEMS_MAX; i++)
+    {
+        px_link_list_hash_item_init(&bench_hash, &bench_items[i].item);
+    }
+    for(i = 0; i < n; i++)
+    {
+        PX_HOST_CHECK(px_link_list_hash_insert_item_end(&bench_hash, &bench_items[idx[i]].item, bench_key(idx[i])));
+    }
+}
+
+/// Return ns per operation
+static double bench_ns_per_op(uint64_t time_us)
+{
+    return (double)time_us * 1000.0 / (double)BENCH_OPS;
+}
+
+static void bench_size(size_t n)
+{
+    volatile size_t            found;
+    px_link_list_hash_item_t * hash_item;
+    uint32_t                   seed;
+    uint32_t                   j;
+    uint64_t                   t;
+    uint64_t                   t_has_item, t_in_list, t_find_walk, t_find_hash;
+    uint64_t                   t_rm_walk, t_rm_hash, t_ins_rand, t_ins_asc;
+    unsigned long              i;
+
+    bench_fill(n);
+
+    // Membership: list search vs link test (half of the items not in the list)
+    found = 0;
+    seed  = 4;
+    t     = px_host_bench_time_us();
+    for(i = 0; i < BENCH_OPS; i++)
+    {
+        j      = bench_rand(&seed) % (2 * n);
+        found += px_link_list_has_item(&bench_hash.list, &bench_items[j].item.list_item);
+    }
+    t_has_item = px_host_bench_time_us() - t;
+    seed = 4;
+    t    = px_host_bench_time_us();
+    for(i = 0; i < BENCH_OPS; i++)
+    {
+        j      = bench_rand(&seed) % (2 * n);
+        found += px_link_list_item_in_list(&bench_hash.list, &bench_items[j].item.list_item);
+    }
+    t_in_list = px_host_bench_time_us() - t;
+
+    // Find by key: list walk vs hash index
+    seed = 5;
+    t    = px_host_bench_time_us();
+    for(i = 0; i < BENCH_OPS; i++)
+    {
+        j      = bench_rand(&seed) % (2 * n);
+        found += (bench_find_walk(bench_key(j)) != NULL);
+    }
+    t_find_walk = px_host_bench_time_us() - t;
+    seed = 5;
+    t    = px_host_bench_time_us();
+    for(i = 0; i < BENCH_OPS; i++)
+    {
+        j      = bench_rand(&seed) % (2 * n);
+        found += (px_link_list_hash_find(&bench_hash, bench_key(j)) != NULL);
+    }
+    t_find_hash = px_host_bench_time_us() - t;
+
+    // Remove by key and insert again: list walk vs hash index
+    seed = 6;
+    t    = px_host_bench_time_us();
+    for(i = 0; i < BENCH_OPS; i++)
+    {
+        j         = bench_rand(&seed) % n;
+        hash_item = bench_find_walk(bench_key(j));
+        px_link_list_remove_item(&bench_hash.list, &hash_item->list_item);
+        px_link_list_insert_item_end(&bench_hash.list, &hash_item->list_item);
+    }
+    t_rm_walk = px_host_bench_time_us() - t;
+    seed = 6;
+    t    = px_host_bench_time_us();
+    for(i = 0; i < BENCH_OPS; i++)
+    {
+        j         = bench_rand(&seed) % n;
+        hash_item = px_link_list_hash_remove_key(&bench_hash, bench_key(j));
+        px_link_list_hash_insert_item_end(&bench_hash, hash_item, bench_key(j));
+    }
+    t_rm_hash = px_host_bench_time_us() - t;
+    PX_HOST_CHECK(px_link_list_get_item_count(&bench_hash.list) == n);
+
+    // Sorted insert (timer list): remove first and insert with random vs later expiry
+    px_link_list_init(&bench_list, 0);
+    seed = 7;
+    for(i = 0; i < n; i++)
+    {
+        bench_items[i].expiry = bench_rand(&seed) % 1000;
+        px_link_list_insert_item_sorted(&bench_list, &bench_items[i].item.list_item, bench_cmp);
+    }
+    t = px_host_bench_time_us();
+    for(i = 0; i < BENCH_OPS; i++)
+    {
+        bench_item_t * item = (bench_item_t *)px_link_list_remove_item_first(&bench_list);
+        item->expiry += bench_rand(&seed) % 1000;
+        px_link_list_insert_item_sorted(&bench_list, &item->item.list_item, bench_cmp);
+    }
+    t_ins_rand = px_host_bench_time_us() - t;
+    t = px_host_bench_time_us();
+    for(i = 0; i < BENCH_OPS; i++)
+    {
+        bench_item_t * item = (bench_item_t *)px_link_list_remove_item_first(&bench_list);
+        item->expiry = ((bench_item_t *)px_link_list_get_item_last(&bench_list))->expiry + 1;
+        px_link_list_insert_item_sorted(&bench_list, &item->item.list_item, bench_cmp);
+    }
+    t_ins_asc = px_host_bench_time_us() - t;
+    PX_HOST_CHECK(px_link_list_get_item_count(&bench_list) == n);
+
+    printf("%5lu %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f\n",
+           (unsigned long)n,
+           bench_ns_per_op(t_has_item), bench_ns_per_op(t_in_list),
+           bench_ns_per_op(t_find_walk), bench_ns_per_op(t_find_hash),
+           bench_ns_per_op(t_rm_walk),   bench_ns_per_op(t_rm_hash),
+           bench_ns_per_op(t_ins_rand),  bench_ns_per_op(t_ins_asc));
+}
+
+int main(void)
+{
+    size_t i;
+
+    bench_check_sorted();
+    printf("Sorted insert and membership check OK\n");
+    bench_check_hash();
+    printf("Hash index model check OK\n");
+
+    printf("\nns per operation:\n");
+    printf("%5s %10s %10s %10s %10s %10s %10s %10s %10s\n",
+           "items", "has_item", "in_list", "find_walk", "find_hash",
+           "rm_walk", "rm_hash", "sort_rand", "sort_asc");
+    for(i = 0; i < sizeof(bench_sizes) / sizeof(bench_sizes[0]); i++)
+    {
+        bench_size(bench_sizes[i]);
+    }
+
+    return 0;
+}
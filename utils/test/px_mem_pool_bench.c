@@ -0,0 +1,425 @@
+/*
+ *  Host test and benchmark for px_mem_pool. Build and run with:
+ *
+ *      make -C tools/px_host_test run
+ *
+ *  1. Pool, size class and adapter (px_sbuf, px_buf_strings, px_link_list)
+ *     checks.
+ *  2. Two threads allocate and free blocks from the same pools. The critical
+ *     section of the host configuration (a spin lock) must prevent a block
+ *     from being handed out twice. Skipped if built with
+ *     PX_MEM_POOL_HOST_LOCK = 0 (to measure the allocator without the lock).
+ *  3. The same random allocate/free workload with mixed object lifetimes is
+ *     run with px_mem_pool_malloc() and malloc(). The average time per
+ *     operation, the 99.9th percentile and worst case latency in CPU cycles
+ *     and the memory footprint are reported. The worst case includes
+ *     preemption by the host OS.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+#include "px_mem_pool.h"
+#include "px_sbuf.h"
+#include "px_buf_strings.h"
+#include "px_link_list.h"
+#include "px_host_bench.h"
+
+/// Number of size classes
+#define BENCH_NR_OF_POOLS       4
+/// Number of live object slots in workload
+#define BENCH_SLOTS             512
+/// Number of allocate/free operations in workload
+#define BENCH_OPS               (4ul * 1024 * 1024)
+/// Number of allocate/free operations per thread
+#define BENCH_THREAD_OPS        (1ul * 1024 * 1024)
+
+#if PX_MEM_POOL_HOST_LOCK
+/// Spin lock used by PX_MEM_POOL_CFG_CRITICAL_ENTER() (see cfg/px_mem_pool_cfg.h)
+volatile bool px_mem_pool_host_lock;
+#endif
+
+static const size_t  bench_block_size[BENCH_NR_OF_POOLS]   = {16, 32, 64, 256};
+static const size_t  bench_nr_of_blocks[BENCH_NR_OF_POOLS] = {256, 256, 256, 128};
+static PX_MEM_POOL_ARENA_DECLARE(bench_arena_16,  16,  256);
+static PX_MEM_POOL_ARENA_DECLARE(bench_arena_32,  32,  256);
+static PX_MEM_POOL_ARENA_DECLARE(bench_arena_64,  64,  256);
+static PX_MEM_POOL_ARENA_DECLARE(bench_arena_256, 256, 128);
+static void * const  bench_arena[BENCH_NR_OF_POOLS] =
+{
+    bench_arena_16, bench_arena_32, bench_arena_64, bench_arena_256,
+};
+static px_mem_pool_t bench_pools[BENCH_NR_OF_POOLS];
+
+/// Item with link structure at the head
+typedef struct
+{
+    px_link_list_item_t link;
+    uint32_t            val;
+} bench_list_item_t;
+
+/// Simple xorshift PRNG
+static uint32_t bench_rand(uint32_t * state)
+{
+    uint32_t x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+static void bench_pools_init(void)
+{
+    size_t i;
+
+    for(i = 0; i < BENCH_NR_OF_POOLS; i++)
+    {
+        px_mem_pool_init(&bench_pools[i], bench_arena[i], bench_block_size[i], bench_nr_of_blocks[i]);
+    }
+    px_mem_pool_heap_init(bench_pools, BENCH_NR_OF_POOLS);
+}
+
+static size_t bench_pools_used(void)
+{
+    size_t used = 0;
+    size_t i;
+
+    for(i = 0; i < BENCH_NR_OF_POOLS; i++)
+    {
+        used += bench_pools[i].blocks_used;
+    }
+    return used;
+}
+
+static void bench_check(void)
+{
+    static uint8_t *    blocks[256];
+    px_mem_pool_t *     pool = &bench_pools[0];
+    px_sbuf_t           sbuf;
+    px_buf_strings_t    buf_strings;
+    px_link_list_t      list;
+    bench_list_item_t * item[3];
+    void *              ptr;
+    size_t              i;
+    size_t              j;
+
+    bench_pools_init();
+
+    // Allocate all blocks of one pool
+    for(i = 0; i < pool->nr_of_blocks; i++)
+    {
+        blocks[i] = px_mem_pool_block_alloc(pool);
+        PX_HOST_CHECK(blocks[i] != NULL);
+        PX_HOST_CHECK(px_mem_pool_has_ptr(pool, blocks[i]));
+        PX_HOST_CHECK(((uintptr_t)blocks[i] % sizeof(void *)) == 0);
+        memset(blocks[i], (int)i, pool->block_size);
+    }
+    PX_HOST_CHECK(px_mem_pool_get_blocks_free(pool) == 0);
+    PX_HOST_CHECK(px_mem_pool_block_alloc(pool) == NULL);
+    PX_HOST_CHECK(pool->fail_cnt == 1);
+    // Blocks must not overlap
+    for(i = 0; i < pool->nr_of_blocks; i++)
+    {
+        for(j = 0; j < pool->block_size; j++)
+        {
+            PX_HOST_CHECK(blocks[i][j] == (uint8_t)i);
+        }
+    }
+    // Free every second block and allocate again
+    for(i = 0; i < pool->nr_of_blocks; i += 2)
+    {
+        px_mem_pool_block_free(pool, blocks[i]);
+    }
+    PX_HOST_CHECK(pool->blocks_used == pool->nr_of_blocks / 2);
+    PX_HOST_CHECK(pool->blocks_used_max == pool->nr_of_blocks);
+    for(i = 0; i < pool->nr_of_blocks; i += 2)
+    {
+        blocks[i] = px_mem_pool_block_alloc(pool);
+        PX_HOST_CHECK(blocks[i] != NULL);
+    }
+    for(i = 0; i < pool->nr_of_blocks; i++)
+    {
+        px_mem_pool_block_free(pool, blocks[i]);
+    }
+    px_mem_pool_stats_reset(pool);
+    PX_HOST_CHECK((pool->blocks_used_max == 0) && (pool->fail_cnt == 0));
+
+    // Size classes: smallest that fits
+    ptr = px_mem_pool_malloc(17);
+    PX_HOST_CHECK(px_mem_pool_has_ptr(&bench_pools[1], ptr));
+    px_mem_pool_free(ptr);
+    PX_HOST_CHECK(bench_pools[1].blocks_used == 0);
+    PX_HOST_CHECK(px_mem_pool_malloc(257) == NULL);
+    // Size classes: next larger class if empty
+    for(i = 0; i < bench_pools[2].nr_of_blocks; i++)
+    {
+        blocks[i] = px_mem_pool_malloc(64);
+        PX_HOST_CHECK(px_mem_pool_has_ptr(&bench_pools[2], blocks[i]));
+    }
+    ptr = px_mem_pool_malloc(64);
+    PX_HOST_CHECK(px_mem_pool_has_ptr(&bench_pools[3], ptr));
+    px_mem_pool_free(ptr);
+    for(i = 0; i < bench_pools[2].nr_of_blocks; i++)
+    {
+        px_mem_pool_free(blocks[i]);
+    }
+    PX_HOST_CHECK(bench_pools_used() == 0);
+
+    // Adapters
+    PX_HOST_CHECK(px_sbuf_malloc(&sbuf, 40));
+    PX_HOST_CHECK(px_mem_pool_has_ptr(&bench_pools[2], sbuf.buf));
+    px_sbuf_printf(&sbuf, "%d-%s", 42, "pool");
+    PX_HOST_CHECK(strcmp(sbuf.buf, "42-pool") == 0);
+    px_sbuf_free(&sbuf);
+    PX_HOST_CHECK(px_buf_strings_malloc(&buf_strings, 200));
+    PX_HOST_CHECK(px_mem_pool_has_ptr(&bench_pools[3], buf_strings.buf));
+    px_buf_strings_free(&buf_strings);
+    px_link_list_init(&list, 0);
+    for(i = 0; i < 3; i++)
+    {
+        item[i] = (bench_list_item_t *)px_link_list_item_alloc(&list, sizeof(bench_list_item_t));
+        PX_HOST_CHECK(item[i] != NULL);
+        item[i]->val = i;
+    }
+    px_link_list_insert_item_end(&list, &item[0]->link);
+    px_link_list_insert_item_end(&list, &item[1]->link);
+    // Free item in middle of list, then item that is not in list
+    px_link_list_item_free(&list, &item[1]->link);
+    px_link_list_item_free(&list, &item[2]->link);
+    PX_HOST_CHECK(px_link_list_get_item_count(&list) == 1);
+    PX_HOST_CHECK(((bench_list_item_t *)px_link_list_get_item_first(&list))->val == 0);
+    px_link_list_item_free(&list, &item[0]->link);
+    PX_HOST_CHECK(px_link_list_is_empty(&list));
+    PX_HOST_CHECK(bench_pools_used() == 0);
+
+    printf("Pool, size class and adapter checks: OK\n");
+}
+
+#if PX_MEM_POOL_HOST_LOCK
+static void * bench_thread(void * arg)
+{
+    uint32_t  seed = (uint32_t)(uintptr_t)arg;
+    uint32_t  tag  = (uint32_t)(uintptr_t)arg;
+    uint32_t  live[32][2];
+    uint32_t *ptr[32];
+    size_t    errors = 0;
+    size_t    i;
+    size_t    slot;
+
+    memset(ptr, 0, sizeof(ptr));
+    for(i = 0; i < BENCH_THREAD_OPS; i++)
+    {
+        slot = bench_rand(&seed) % 32;
+        if(ptr[slot] == NULL)
+        {
+            // Allocate and tag block with thread and sequence number
+            ptr[slot] = px_mem_pool_malloc(1 + bench_rand(&seed) % 64);
+            if(ptr[slot] != NULL)
+            {
+                live[slot][0] = ptr[slot][0] = tag;
+                live[slot][1] = ptr[slot][1] = (uint32_t)i;
+            }
+        }
+        else
+        {
+            // Tag must be unchanged (block not handed out twice)
+            errors += (ptr[slot][0] != live[slot][0]) || (ptr[slot][1] != live[slot][1]);
+            px_mem_pool_free(ptr[slot]);
+            ptr[slot] = NULL;
+        }
+    }
+    for(slot = 0; slot < 32; slot++)
+    {
+        px_mem_pool_free(ptr[slot]);
+    }
+    return (void *)errors;
+}
+
+static void bench_threads(void)
+{
+    pthread_t thread[2];
+    void *    errors[2];
+
+    bench_pools_init();
+    PX_HOST_CHECK(pthread_create(&thread[0], NULL, bench_thread, (void *)0x1234) == 0);
+    PX_HOST_CHECK(pthread_create(&thread[1], NULL, bench_thread, (void *)0x5678) == 0);
+    pthread_join(thread[0], &errors[0]);
+    pthread_join(thread[1], &errors[1]);
+    PX_HOST_CHECK((errors[0] == NULL) && (errors[1] == NULL));
+    PX_HOST_CHECK(bench_pools_used() == 0);
+    printf("Thread check: OK\n");
+}
+#endif
+
+/// Random allocate/free workload
+static void bench_workload(bool use_pool)
+{
+    static void * slot_ptr[BENCH_SLOTS];
+    static size_t slot_size[BENCH_SLOTS];
+    uint32_t      seed          = 1;
+    size_t        fail_cnt      = 0;
+    size_t        bytes_live    = 0;
+    size_t        bytes_max     = 0;
+    uint64_t      cycles_max    = 0;
+    uint64_t      cycles_p999   = 0;
+    size_t        hist[64];
+    size_t        hist_sum      = 0;
+    size_t        nr_of_ops     = 0;
+    uint64_t      cycles;
+    uint64_t      start_us;
+    uint64_t      time_us;
+    uint32_t      r;
+    size_t        slot;
+    size_t        size;
+    size_t        i;
+
+    memset(slot_ptr, 0, sizeof(slot_ptr));
+    memset(hist, 0, sizeof(hist));
+    bench_pools_init();
+    start_us = px_host_bench_time_us();
+    for(i = 0; i < BENCH_OPS; i++)
+    {
+        r    = bench_rand(&seed);
+        // First quarter of slots hold long lived objects (rarely freed)
+        slot = r % BENCH_SLOTS;
+        if((slot < BENCH_SLOTS / 4) && (slot_ptr[slot] != NULL) && ((r >> 20) & 0x3f))
+        {
+            continue;
+        }
+        // Mostly small objects, sometimes large
+        size = ((r >> 16) & 0x07) ? (4 + (r >> 9) % 60) : (65 + (r >> 9) % 192);
+        cycles = px_host_bench_cycles();
+        if(slot_ptr[slot] == NULL)
+        {
+            slot_ptr[slot] = use_pool ? px_mem_pool_malloc(size) : malloc(size);
+            if(slot_ptr[slot] != NULL)
+            {
+                slot_size[slot] = size;
+                bytes_live     += size;
+            }
+            else
+            {
+                fail_cnt++;
+            }
+        }
+        else
+        {
+            if(use_pool)
+            {
+                px_mem_pool_free(slot_ptr[slot]);
+            }
+            else
+            {
+                free(slot_ptr[slot]);
+            }
+            slot_ptr[slot] = NULL;
+            bytes_live    -= slot_size[slot];
+        }
+        cycles = px_host_bench_cycles() - cycles;
+        if(cycles > cycles_max)
+        {
+            cycles_max = cycles;
+        }
+        // Histogram with power of two buckets
+        hist[(cycles == 0) ? 0 : 64 - __builtin_clzll(cycles)]++;
+        nr_of_ops++;
+        if(bytes_live > bytes_max)
+        {
+            bytes_max = bytes_live;
+        }
+    }
+    time_us = px_host_bench_time_us() - start_us;
+    // Upper bound of bucket that contains the 99.9th percentile
+    for(i = 0; i < 64; i++)
+    {
+        hist_sum += hist[i];
+        if(hist_sum >= nr_of_ops - nr_of_ops / 1000)
+        {
+            cycles_p999 = (1ull << i) - 1;
+            break;
+        }
+    }
+
+    printf("%-22s %8.1f", use_pool ? "px_mem_pool_malloc()" : "malloc()",
+           (double)time_us * 1000.0 / (double)nr_of_ops);
+    if(PX_HOST_BENCH_HAS_CYCLES)
+    {
+        printf(" %10lu %10lu", (unsigned long)cycles_p999, (unsigned long)cycles_max);
+    }
+    else
+    {
+        printf(" %10s %10s", "n/a", "n/a");
+    }
+    printf(" %10lu %10lu", (unsigned long)bytes_max, (unsigned long)fail_cnt);
+    if(use_pool)
+    {
+        size_t arena_size = 0;
+        size_t used_max   = 0;
+
+        for(i = 0; i < BENCH_NR_OF_POOLS; i++)
+        {
+            arena_size += bench_pools[i].block_size * bench_pools[i].nr_of_blocks;
+            used_max   += bench_pools[i].block_size * bench_pools[i].blocks_used_max;
+        }
+        printf("   arena %lu bytes, high-water %lu bytes\n",
+               (unsigned long)arena_size, (unsigned long)used_max);
+    }
+    else
+    {
+#ifdef __GLIBC__
+        struct mallinfo2 mi = mallinfo2();
+
+        printf("   heap %lu bytes, %lu bytes free in %lu chunks\n",
+               (unsigned long)mi.arena, (unsigned long)mi.fordblks, (unsigned long)mi.ordblks);
+#else
+        printf("\n");
+#endif
+    }
+
+    // Free remaining objects
+    for(slot = 0; slot < BENCH_SLOTS; slot++)
+    {
+        if(use_pool)
+        {
+            px_mem_pool_free(slot_ptr[slot]);
+        }
+        else
+        {
+            free(slot_ptr[slot]);
+        }
+    }
+    if(use_pool)
+    {
+        PX_HOST_CHECK(bench_pools_used() == 0);
+        for(i = 0; i < BENCH_NR_OF_POOLS; i++)
+        {
+            printf("    %3lu byte blocks: %3lu/%3lu used max, %lu failed\n",
+                   (unsigned long)bench_pools[i].block_size,
+                   (unsigned long)bench_pools[i].blocks_used_max,
+                   (unsigned long)bench_pools[i].nr_of_blocks,
+                   (unsigned long)bench_pools[i].fail_cnt);
+        }
+    }
+}
+
+int main(void)
+{
+    printf("px_mem_pool benchmark\n\n");
+    bench_check();
+#if PX_MEM_POOL_HOST_LOCK
+    bench_threads();
+#endif
+
+    printf("\nWorkload: %lu random allocate/free operations, %u slots, 4 to 256 bytes\n",
+           (unsigned long)BENCH_OPS, BENCH_SLOTS);
+    printf("%-22s %8s %10s %10s %10s %10s\n", "Allocator", "ns/op", "99.9% cyc", "Max cyc", "Max live", "Failed");
+    bench_workload(false);
+    bench_workload(true);
+
+    return 0;
+}
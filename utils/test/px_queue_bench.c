@@ -0,0 +1,370 @@
+/*
+ *  Host test and benchmark for px_queue. Build and run with:
+ *
+ *      make -C tools/px_host_test run
+ *
+ *  1. Random single threaded operations (single, batched and in place) are
+ *     checked against a simple model.
+ *  2. A producer thread (in place of an ISR) and a consumer thread share a
+ *     queue without locks for BENCH_STRESS_ITEMS items. The consumer verifies
+ *     the item sequence. A thread yields when the queue is full (or empty) so
+ *     that the test also runs on a single core.
+ *  3. Items/sec for single item access vs batched and in place access.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include "px_queue.h"
+#include "px_host_bench.h"
+
+/// Maximum number of items in queue (deliberately not a power of two)
+#define BENCH_ITEMS_MAX         100
+/// Number of items passed between threads
+#define BENCH_STRESS_ITEMS      (2ul * 1024 * 1024)
+/// Number of items passed for each throughput measurement
+#define BENCH_TPUT_ITEMS        (16ul * 1024 * 1024)
+/// Batch size used for throughput measurement
+#define BENCH_TPUT_BATCH        16
+
+/// Test item (e.g. sensor sample)
+typedef struct
+{
+    uint32_t seq;
+    uint16_t val[2];
+} bench_item_t;
+
+static px_queue_t   bench_queue;
+static bench_item_t bench_queue_buf[BENCH_ITEMS_MAX];
+
+/// Simple xorshift PRNG (one per thread)
+static uint32_t bench_rand(uint32_t * state)
+{
+    uint32_t x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+static void bench_item_set(bench_item_t * item, uint32_t seq)
+{
+    item->seq    = seq;
+    item->val[0] = (uint16_t)(seq * 3);
+    item->val[1] = (uint16_t)(seq >> 16);
+}
+
+static bool bench_item_is_valid(const bench_item_t * item, uint32_t seq)
+{
+    return    (item->seq    == seq)
+           && (item->val[0] == (uint16_t)(seq * 3))
+           && (item->val[1] == (uint16_t)(seq >> 16));
+}
+
+/// Random operations on one thread compared with a model (sequence numbers)
+static void bench_model(void)
+{
+    bench_item_t         buf[BENCH_ITEMS_MAX + 10];
+    const bench_item_t * item;
+    uint32_t             seq_wr = 0;
+    uint32_t             seq_rd = 0;
+    uint32_t             seed   = 1;
+    uint32_t             i;
+    px_queue_idx_t       n;
+    px_queue_idx_t       j;
+
+    px_queue_init(&bench_queue, bench_queue_buf, BENCH_ITEMS_MAX, sizeof(bench_item_t));
+    for(i = 0; i < 200000; i++)
+    {
+        uint32_t used = seq_wr - seq_rd;
+
+        PX_HOST_CHECK(px_queue_get_item_count(&bench_queue) == used);
+        PX_HOST_CHECK(px_queue_is_empty(&bench_queue) == (used == 0));
+        PX_HOST_CHECK(px_queue_is_full(&bench_queue) == (used == BENCH_ITEMS_MAX));
+        n = (px_queue_idx_t)(bench_rand(&seed) % (BENCH_ITEMS_MAX + 10));
+        switch(bench_rand(&seed) % 8)
+        {
+        case 0:
+        case 1:
+            // Batch write
+            for(j = 0; j < n; j++)
+            {
+                bench_item_set(&buf[j], seq_wr + j);
+            }
+            j = px_queue_wr_n(&bench_queue, buf, n);
+            PX_HOST_CHECK(j == ((n < BENCH_ITEMS_MAX - used) ? n : BENCH_ITEMS_MAX - used));
+            seq_wr += j;
+            break;
+        case 2:
+            // Single write
+            bench_item_set(&buf[0], seq_wr);
+            if(px_queue_wr(&bench_queue, &buf[0]))
+            {
+                seq_wr++;
+            }
+            else
+            {
+                PX_HOST_CHECK(used == BENCH_ITEMS_MAX);
+            }
+            break;
+        case 3:
+            // Batch read
+            j = px_queue_rd_n(&bench_queue, buf, n);
+            PX_HOST_CHECK(j == ((n < used) ? n : used));
+            for(n = 0; n < j; n++)
+            {
+                PX_HOST_CHECK(bench_item_is_valid(&buf[n], seq_rd + n));
+            }
+            seq_rd += j;
+            break;
+        case 4:
+            // Single read
+            if(px_queue_rd(&bench_queue, &buf[0]))
+            {
+                PX_HOST_CHECK(bench_item_is_valid(&buf[0], seq_rd++));
+            }
+            else
+            {
+                PX_HOST_CHECK(used == 0);
+            }
+            break;
+        case 5:
+            // In place read of part of contiguous items
+            item = px_queue_peek_ptr(&bench_queue, &j);
+            if(item == NULL)
+            {
+                PX_HOST_CHECK((used == 0) && (j == 0));
+                break;
+            }
+            PX_HOST_CHECK((j != 0) && (j <= used));
+            if(n > j)
+            {
+                n = j;
+            }
+            for(j = 0; j < n; j++)
+            {
+                PX_HOST_CHECK(bench_item_is_valid(&item[j], seq_rd + j));
+            }
+            PX_HOST_CHECK(px_queue_drop_n(&bench_queue, n) == n);
+            seq_rd += n;
+            break;
+        case 6:
+            // Drop items
+            j = px_queue_drop_n(&bench_queue, n);
+            PX_HOST_CHECK(j == ((n < used) ? n : used));
+            seq_rd += j;
+            break;
+        default:
+            // Discard oldest or flush everything
+            if((n & 0x0f) == 0)
+            {
+                px_queue_flush(&bench_queue);
+                seq_rd = seq_wr;
+            }
+            else if(px_queue_discard_oldest(&bench_queue))
+            {
+                seq_rd++;
+            }
+            else
+            {
+                PX_HOST_CHECK(used == 0);
+            }
+            break;
+        }
+    }
+    printf("Model check: OK\n");
+}
+
+static void * bench_producer(void * arg)
+{
+    uint32_t       seed = 12345;
+    uint32_t       seq  = 0;
+    bench_item_t   buf[BENCH_TPUT_BATCH];
+    px_queue_idx_t n;
+    px_queue_idx_t i;
+
+    (void)arg;
+    while(seq < BENCH_STRESS_ITEMS)
+    {
+        if(px_queue_is_full(&bench_queue))
+        {
+            sched_yield();
+        }
+        if(bench_rand(&seed) & 1)
+        {
+            bench_item_set(&buf[0], seq);
+            seq += px_queue_wr(&bench_queue, &buf[0]);
+        }
+        else
+        {
+            n = 1 + bench_rand(&seed) % BENCH_TPUT_BATCH;
+            if(n > BENCH_STRESS_ITEMS - seq)
+            {
+                n = BENCH_STRESS_ITEMS - seq;
+            }
+            for(i = 0; i < n; i++)
+            {
+                bench_item_set(&buf[i], seq + i);
+            }
+            seq += px_queue_wr_n(&bench_queue, buf, n);
+        }
+    }
+    return NULL;
+}
+
+static void * bench_consumer(void * arg)
+{
+    uint32_t             seed   = 67890;
+    uint32_t             seq    = 0;
+    size_t               errors = 0;
+    bench_item_t         buf[BENCH_TPUT_BATCH];
+    const bench_item_t * item;
+    px_queue_idx_t       n;
+    px_queue_idx_t       i;
+
+    while(seq < BENCH_STRESS_ITEMS)
+    {
+        if(px_queue_is_empty(&bench_queue))
+        {
+            sched_yield();
+        }
+        switch(bench_rand(&seed) % 3)
+        {
+        case 0:
+            if(px_queue_rd(&bench_queue, &buf[0]))
+            {
+                errors += !bench_item_is_valid(&buf[0], seq++);
+            }
+            break;
+        case 1:
+            n = px_queue_rd_n(&bench_queue, buf, 1 + bench_rand(&seed) % BENCH_TPUT_BATCH);
+            for(i = 0; i < n; i++)
+            {
+                errors += !bench_item_is_valid(&buf[i], seq++);
+            }
+            break;
+        default:
+            item = px_queue_peek_ptr(&bench_queue, &n);
+            for(i = 0; i < n; i++)
+            {
+                errors += !bench_item_is_valid(&item[i], seq++);
+            }
+            px_queue_drop_n(&bench_queue, n);
+            break;
+        }
+    }
+    *(size_t *)arg = errors;
+    return NULL;
+}
+
+/// Producer and consumer threads without locks
+static void bench_stress(void)
+{
+    pthread_t thread_wr;
+    pthread_t thread_rd;
+    size_t    errors = 1;
+    uint64_t  start_us;
+    uint64_t  time_us;
+
+    px_queue_init(&bench_queue, bench_queue_buf, BENCH_ITEMS_MAX, sizeof(bench_item_t));
+    start_us = px_host_bench_time_us();
+    PX_HOST_CHECK(pthread_create(&thread_rd, NULL, bench_consumer, &errors) == 0);
+    PX_HOST_CHECK(pthread_create(&thread_wr, NULL, bench_producer, NULL) == 0);
+    pthread_join(thread_wr, NULL);
+    pthread_join(thread_rd, NULL);
+    time_us = px_host_bench_time_us() - start_us;
+
+    PX_HOST_CHECK(errors == 0);
+    PX_HOST_CHECK(px_queue_is_empty(&bench_queue));
+    printf("Thread stress: %lu items passed, %lu errors, %.1f M items/s\n",
+           (unsigned long)BENCH_STRESS_ITEMS, (unsigned long)errors,
+           px_host_bench_per_sec(BENCH_STRESS_ITEMS, time_us) / 1e6);
+}
+
+/// Single threaded items/sec of single, batched and in place access
+static void bench_tput(void)
+{
+    bench_item_t            buf[BENCH_TPUT_BATCH];
+    const bench_item_t *    item;
+    volatile uint32_t       sink = 0;
+    px_queue_idx_t          n;
+    size_t                  i;
+    size_t                  j;
+    uint64_t                start_us;
+    uint64_t                time_us[3];
+
+    for(j = 0; j < BENCH_TPUT_BATCH; j++)
+    {
+        bench_item_set(&buf[j], j);
+    }
+    px_queue_init(&bench_queue, bench_queue_buf, BENCH_ITEMS_MAX, sizeof(bench_item_t));
+
+    // One item per call
+    start_us = px_host_bench_time_us();
+    for(i = 0; i < BENCH_TPUT_ITEMS; i += BENCH_TPUT_BATCH)
+    {
+        for(j = 0; j < BENCH_TPUT_BATCH; j++)
+        {
+            px_queue_wr(&bench_queue, &buf[j]);
+        }
+        for(j = 0; j < BENCH_TPUT_BATCH; j++)
+        {
+            px_queue_rd(&bench_queue, &buf[j]);
+            sink += buf[j].seq;
+        }
+    }
+    time_us[0] = px_host_bench_time_us() - start_us;
+
+    // Batched
+    start_us = px_host_bench_time_us();
+    for(i = 0; i < BENCH_TPUT_ITEMS; i += BENCH_TPUT_BATCH)
+    {
+        px_queue_wr_n(&bench_queue, buf, BENCH_TPUT_BATCH);
+        n = px_queue_rd_n(&bench_queue, buf, BENCH_TPUT_BATCH);
+        for(j = 0; j < n; j++)
+        {
+            sink += buf[j].seq;
+        }
+    }
+    time_us[1] = px_host_bench_time_us() - start_us;
+
+    // Batched write, in place read
+    start_us = px_host_bench_time_us();
+    for(i = 0; i < BENCH_TPUT_ITEMS; i += BENCH_TPUT_BATCH)
+    {
+        px_queue_wr_n(&bench_queue, buf, BENCH_TPUT_BATCH);
+        while((item = px_queue_peek_ptr(&bench_queue, &n)) != NULL)
+        {
+            for(j = 0; j < n; j++)
+            {
+                sink += item[j].seq;
+            }
+            px_queue_drop_n(&bench_queue, n);
+        }
+    }
+    time_us[2] = px_host_bench_time_us() - start_us;
+    PX_HOST_CHECK(px_queue_is_empty(&bench_queue));
+
+    printf("\nThroughput (write then read %u items of %u bytes):\n",
+           BENCH_TPUT_BATCH, (unsigned)sizeof(bench_item_t));
+    printf("%-30s %8.1f M items/s\n", "px_queue_wr/rd()",
+           px_host_bench_per_sec(BENCH_TPUT_ITEMS, time_us[0]) / 1e6);
+    printf("%-30s %8.1f M items/s\n", "px_queue_wr_n/rd_n()",
+           px_host_bench_per_sec(BENCH_TPUT_ITEMS, time_us[1]) / 1e6);
+    printf("%-30s %8.1f M items/s\n", "px_queue_wr_n/peek_ptr/drop_n()",
+           px_host_bench_per_sec(BENCH_TPUT_ITEMS, time_us[2]) / 1e6);
+}
+
+int main(void)
+{
+    printf("px_queue benchmark (%u items of %u bytes)\n\n",
+           BENCH_ITEMS_MAX, (unsigned)sizeof(bench_item_t));
+    bench_model();
+    bench_stress();
+    bench_tput();
+
+    return 0;
+}
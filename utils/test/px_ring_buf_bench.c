@@ -0,0 +1,437 @@
+/*
+ *  Host stress test and benchmark for px_ring_buf. Build and run with:
+ *
+ *      make -C tools/px_host_test run
+ *
+ *  1. Random single threaded operations are checked against a simple model.
+ *  2. A producer and consumer thread share a ring buffer without locks for
+ *     BENCH_STRESS_BYTES bytes, each randomly using the byte, bulk and
+ *     zero-copy chunk APIs. The consumer verifies the byte sequence. A thread
+ *     yields when the buffer is full (or empty) so that the test also runs on
+ *     a single core.
+ *  3. Single threaded throughput of the byte, bulk and chunk APIs.
+ *
+ *  The executable is built for each combination of PX_RING_BUF_CFG_POW2 and
+ *  PX_RING_BUF_CFG_IDX_SIZE to compare the implementations. With a 32-bit
+ *  index a buffer larger than 64 KB is also tested.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include "px_ring_buf.h"
+#include "px_host_bench.h"
+
+#if PX_RING_BUF_CFG_POW2
+/// Ring buffer size (must be a power of two)
+#define BENCH_BUF_SIZE          1024
+/// Maximum number of bytes that can be stored
+#define BENCH_BUF_CAPACITY      BENCH_BUF_SIZE
+#else
+/// Ring buffer size (deliberately not a power of two)
+#define BENCH_BUF_SIZE          1000
+/// Maximum number of bytes that can be stored
+#define BENCH_BUF_CAPACITY      (BENCH_BUF_SIZE - 1)
+#endif
+/// Large ring buffer size (only with 32-bit index)
+#define BENCH_LARGE_BUF_SIZE    (256ul * 1024)
+/// Number of bytes passed between threads
+#define BENCH_STRESS_BYTES      (16ul * 1024 * 1024)
+/// Number of bytes passed for each throughput measurement
+#define BENCH_TPUT_BYTES        (64ul * 1024 * 1024)
+/// Block size used for throughput measurement
+#define BENCH_TPUT_BLOCK_SIZE   64
+
+static px_ring_buf_t bench_ring_buf;
+static uint8_t       bench_ring_buf_data[BENCH_BUF_SIZE];
+
+/// Simple xorshift PRNG (one per thread)
+static uint32_t bench_rand(uint32_t * state)
+{
+    uint32_t x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+/// Random operations on one thread compared with a linear model
+static void bench_model(void)
+{
+    static uint8_t model[1u << 20];
+    size_t         model_rd = 0;
+    size_t         model_wr = 0;
+    uint8_t        seq_wr   = 0;
+    uint8_t        buf[BENCH_BUF_SIZE];
+    uint32_t       seed     = 1;
+    uint32_t       i;
+    size_t         n;
+    size_t         j;
+    uint8_t *      chunk_wr;
+    const uint8_t *chunk_rd;
+
+    px_ring_buf_init(&bench_ring_buf, bench_ring_buf_data, sizeof(bench_ring_buf_data));
+#if PX_RING_BUF_CFG_POW2
+    // Start with free-running indices just before they wrap
+    bench_ring_buf.idx_wr = (px_ring_buf_idx_t)(0 - BENCH_BUF_SIZE / 2);
+    bench_ring_buf.idx_rd = bench_ring_buf.idx_wr;
+#endif
+    for(i = 0; i < 100000; i++)
+    {
+        size_t used = model_wr - model_rd;
+
+        PX_HOST_CHECK(px_ring_buf_count_used(&bench_ring_buf) == used);
+        PX_HOST_CHECK(px_ring_buf_count_free(&bench_ring_buf) == BENCH_BUF_CAPACITY - used);
+        // Keep model from running past end
+        if(model_wr + BENCH_BUF_SIZE > sizeof(model))
+        {
+            memmove(model, &model[model_rd], used);
+            model_wr -= model_rd;
+            model_rd  = 0;
+        }
+        n = bench_rand(&seed) % 300;
+        switch(bench_rand(&seed) % 6)
+        {
+        case 0:
+            // Bulk write
+            for(j = 0; j < n; j++)
+            {
+                buf[j] = seq_wr++;
+            }
+            j = px_ring_buf_wr(&bench_ring_buf, buf, n);
+            PX_HOST_CHECK(j == ((n < BENCH_BUF_CAPACITY - used) ? n : BENCH_BUF_CAPACITY - used));
+            memcpy(&model[model_wr], buf, j);
+            model_wr += j;
+            seq_wr    = (uint8_t)(seq_wr - (n - j));
+            break;
+        case 1:
+            // Zero-copy write
+            chunk_wr = px_ring_buf_wr_chunk_reserve(&bench_ring_buf, &n);
+            if(chunk_wr == NULL)
+            {
+                PX_HOST_CHECK(used == BENCH_BUF_CAPACITY);
+                break;
+            }
+            for(j = 0; j < n; j++)
+            {
+                chunk_wr[j] = seq_wr;
+                model[model_wr++] = seq_wr++;
+            }
+            px_ring_buf_wr_chunk_commit(&bench_ring_buf, n);
+            break;
+        case 2:
+            // Byte write
+            if(px_ring_buf_wr_u8(&bench_ring_buf, seq_wr))
+            {
+                model[model_wr++] = seq_wr++;
+            }
+            else
+            {
+                PX_HOST_CHECK(used == BENCH_BUF_CAPACITY);
+            }
+            break;
+        case 3:
+            // Bulk read
+            j = px_ring_buf_rd(&bench_ring_buf, buf, n);
+            PX_HOST_CHECK(j == ((n < used) ? n : used));
+            PX_HOST_CHECK(memcmp(buf, &model[model_rd], j) == 0);
+            model_rd += j;
+            break;
+        case 4:
+            // Peek then zero-copy read
+            j = px_ring_buf_peek(&bench_ring_buf, buf, n);
+            PX_HOST_CHECK(j == ((n < used) ? n : used));
+            PX_HOST_CHECK(memcmp(buf, &model[model_rd], j) == 0);
+            chunk_rd = px_ring_buf_rd_chunk_get(&bench_ring_buf, &n);
+            if(chunk_rd == NULL)
+            {
+                PX_HOST_CHECK(used == 0);
+                break;
+            }
+            PX_HOST_CHECK(memcmp(chunk_rd, &model[model_rd], n) == 0);
+            px_ring_buf_rd_chunk_consume(&bench_ring_buf, n);
+            model_rd += n;
+            break;
+        default:
+            // Byte read
+            if(px_ring_buf_rd_u8(&bench_ring_buf, buf))
+            {
+                PX_HOST_CHECK(buf[0] == model[model_rd++]);
+            }
+            else
+            {
+                PX_HOST_CHECK(used == 0);
+            }
+            break;
+        }
+    }
+    printf("Model check: OK\n");
+}
+
+static void * bench_producer(void * arg)
+{
+    uint32_t  seed   = 12345;
+    uint8_t   seq    = 0;
+    size_t    total  = 0;
+    uint8_t   buf[256];
+    uint8_t * chunk;
+    size_t    n;
+    size_t    i;
+
+    (void)arg;
+    while(total < BENCH_STRESS_BYTES)
+    {
+        if(px_ring_buf_is_full(&bench_ring_buf))
+        {
+            sched_yield();
+        }
+        n = 1 + bench_rand(&seed) % sizeof(buf);
+        if(n > BENCH_STRESS_BYTES - total)
+        {
+            n = BENCH_STRESS_BYTES - total;
+        }
+        switch(bench_rand(&seed) % 3)
+        {
+        case 0:
+            if(px_ring_buf_wr_u8(&bench_ring_buf, seq))
+            {
+                seq++;
+                total++;
+            }
+            break;
+        case 1:
+            for(i = 0; i < n; i++)
+            {
+                buf[i] = (uint8_t)(seq + i);
+            }
+            n      = px_ring_buf_wr(&bench_ring_buf, buf, n);
+            seq   += (uint8_t)n;
+            total += n;
+            break;
+        default:
+            chunk = px_ring_buf_wr_chunk_reserve(&bench_ring_buf, &n);
+            if(chunk != NULL)
+            {
+                for(i = 0; i < n; i++)
+                {
+                    chunk[i] = seq++;
+                }
+                px_ring_buf_wr_chunk_commit(&bench_ring_buf, n);
+                total += n;
+            }
+            break;
+        }
+    }
+    return NULL;
+}
+
+static void * bench_consumer(void * arg)
+{
+    uint32_t        seed   = 67890;
+    uint8_t         seq    = 0;
+    size_t          total  = 0;
+    size_t          errors = 0;
+    uint8_t         buf[256];
+    const uint8_t * chunk;
+    size_t          n;
+    size_t          i;
+
+    while(total < BENCH_STRESS_BYTES)
+    {
+        if(px_ring_buf_is_empty(&bench_ring_buf))
+        {
+            sched_yield();
+        }
+        n = 1 + bench_rand(&seed) % sizeof(buf);
+        switch(bench_rand(&seed) % 3)
+        {
+        case 0:
+            if(px_ring_buf_rd_u8(&bench_ring_buf, buf))
+            {
+                errors += (buf[0] != seq++);
+                total++;
+            }
+            break;
+        case 1:
+            n = px_ring_buf_rd(&bench_ring_buf, buf, n);
+            for(i = 0; i < n; i++)
+            {
+                errors += (buf[i] != seq++);
+            }
+            total += n;
+            break;
+        default:
+            chunk = px_ring_buf_rd_chunk_get(&bench_ring_buf, &n);
+            if(chunk != NULL)
+            {
+                for(i = 0; i < n; i++)
+                {
+                    errors += (chunk[i] != seq++);
+                }
+                px_ring_buf_rd_chunk_consume(&bench_ring_buf, n);
+                total += n;
+            }
+            break;
+        }
+    }
+    *(size_t *)arg = errors;
+    return NULL;
+}
+
+/// Producer and consumer threads without locks
+static void bench_stress(void)
+{
+    pthread_t thread_wr;
+    pthread_t thread_rd;
+    size_t    errors = 1;
+    uint64_t  start_us;
+    uint64_t  time_us;
+
+    px_ring_buf_init(&bench_ring_buf, bench_ring_buf_data, sizeof(bench_ring_buf_data));
+    start_us = px_host_bench_time_us();
+    PX_HOST_CHECK(pthread_create(&thread_rd, NULL, bench_consumer, &errors) == 0);
+    PX_HOST_CHECK(pthread_create(&thread_wr, NULL, bench_producer, NULL) == 0);
+    pthread_join(thread_wr, NULL);
+    pthread_join(thread_rd, NULL);
+    time_us = px_host_bench_time_us() - start_us;
+
+    PX_HOST_CHECK(errors == 0);
+    PX_HOST_CHECK(px_ring_buf_is_empty(&bench_ring_buf));
+    printf("Thread stress: %lu MB passed, %lu errors, %.1f MB/s\n",
+           (unsigned long)(BENCH_STRESS_BYTES / (1024 * 1024)), (unsigned long)errors,
+           px_host_bench_per_sec(BENCH_STRESS_BYTES, time_us) / 1e6);
+}
+
+#if (PX_RING_BUF_CFG_IDX_SIZE == 32)
+/// Buffer larger than 64 KB with 32-bit index
+static void bench_large(void)
+{
+    static uint8_t data[BENCH_LARGE_BUF_SIZE];
+    static uint8_t buf[BENCH_LARGE_BUF_SIZE];
+    px_ring_buf_t  ring_buf;
+    size_t         capacity = BENCH_LARGE_BUF_SIZE - (PX_RING_BUF_CFG_POW2 ? 0 : 1);
+    uint8_t        seq_wr   = 0;
+    uint8_t        seq_rd   = 0;
+    size_t         n;
+    size_t         i;
+
+    px_ring_buf_init(&ring_buf, data, sizeof(data));
+    // Fill buffer completely
+    for(i = 0; i < sizeof(buf); i++)
+    {
+        buf[i] = seq_wr++;
+    }
+    PX_HOST_CHECK(px_ring_buf_wr(&ring_buf, buf, sizeof(buf)) == capacity);
+    PX_HOST_CHECK(px_ring_buf_count_used(&ring_buf) == capacity);
+    PX_HOST_CHECK(px_ring_buf_is_full(&ring_buf));
+    seq_wr = (uint8_t)capacity;
+    // Read 3/4 of data
+    n = capacity / 4 * 3;
+    PX_HOST_CHECK(px_ring_buf_rd(&ring_buf, buf, n) == n);
+    for(i = 0; i < n; i++)
+    {
+        PX_HOST_CHECK(buf[i] == seq_rd++);
+    }
+    // Write 1/2 of capacity so that write index wraps
+    n = capacity / 2;
+    for(i = 0; i < n; i++)
+    {
+        buf[i] = seq_wr++;
+    }
+    PX_HOST_CHECK(px_ring_buf_wr(&ring_buf, buf, n) == n);
+    // Read everything back
+    n = capacity - capacity / 4 * 3 + capacity / 2;
+    PX_HOST_CHECK(px_ring_buf_count_used(&ring_buf) == n);
+    PX_HOST_CHECK(px_ring_buf_rd(&ring_buf, buf, sizeof(buf)) == n);
+    for(i = 0; i < n; i++)
+    {
+        PX_HOST_CHECK(buf[i] == seq_rd++);
+    }
+    PX_HOST_CHECK(px_ring_buf_is_empty(&ring_buf));
+    printf("Large buffer (%lu bytes): OK\n", (unsigned long)BENCH_LARGE_BUF_SIZE);
+}
+#endif
+
+/// Single threaded throughput of byte, bulk and chunk APIs
+static void bench_tput(void)
+{
+    uint8_t         block[BENCH_TPUT_BLOCK_SIZE];
+    volatile uint8_t sink = 0;
+    uint8_t         data;
+    uint8_t *       chunk_wr;
+    const uint8_t * chunk_rd;
+    size_t          n;
+    size_t          i;
+    size_t          j;
+    uint64_t        start_us;
+    uint64_t        time_us[3];
+
+    memset(block, 0x55, sizeof(block));
+    px_ring_buf_init(&bench_ring_buf, bench_ring_buf_data, sizeof(bench_ring_buf_data));
+
+    // Byte API
+    start_us = px_host_bench_time_us();
+    for(i = 0; i < BENCH_TPUT_BYTES; i += BENCH_TPUT_BLOCK_SIZE)
+    {
+        for(j = 0; j < BENCH_TPUT_BLOCK_SIZE; j++)
+        {
+            px_ring_buf_wr_u8(&bench_ring_buf, block[j]);
+        }
+        for(j = 0; j < BENCH_TPUT_BLOCK_SIZE; j++)
+        {
+            px_ring_buf_rd_u8(&bench_ring_buf, &data);
+            sink += data;
+        }
+    }
+    time_us[0] = px_host_bench_time_us() - start_us;
+
+    // Bulk API
+    start_us = px_host_bench_time_us();
+    for(i = 0; i < BENCH_TPUT_BYTES; i += BENCH_TPUT_BLOCK_SIZE)
+    {
+        px_ring_buf_wr(&bench_ring_buf, block, BENCH_TPUT_BLOCK_SIZE);
+        px_ring_buf_rd(&bench_ring_buf, block, BENCH_TPUT_BLOCK_SIZE);
+    }
+    time_us[1] = px_host_bench_time_us() - start_us;
+
+    // Zero-copy chunk API (data produced and consumed in place)
+    start_us = px_host_bench_time_us();
+    for(i = 0; i < BENCH_TPUT_BYTES; i += n)
+    {
+        n        = BENCH_TPUT_BLOCK_SIZE;
+        chunk_wr = px_ring_buf_wr_chunk_reserve(&bench_ring_buf, &n);
+        memset(chunk_wr, (int)i, n);
+        px_ring_buf_wr_chunk_commit(&bench_ring_buf, n);
+        chunk_rd = px_ring_buf_rd_chunk_get(&bench_ring_buf, &n);
+        sink    += chunk_rd[n - 1];
+        px_ring_buf_rd_chunk_consume(&bench_ring_buf, n);
+    }
+    time_us[2] = px_host_bench_time_us() - start_us;
+    PX_HOST_CHECK(px_ring_buf_is_empty(&bench_ring_buf));
+
+    printf("\nThroughput (write then read %u byte blocks):\n", BENCH_TPUT_BLOCK_SIZE);
+    printf("%-24s %10.1f MB/s\n", "px_ring_buf_wr/rd_u8()",
+           px_host_bench_per_sec(BENCH_TPUT_BYTES, time_us[0]) / 1e6);
+    printf("%-24s %10.1f MB/s\n", "px_ring_buf_wr/rd()",
+           px_host_bench_per_sec(BENCH_TPUT_BYTES, time_us[1]) / 1e6);
+    printf("%-24s %10.1f MB/s\n", "chunk reserve/get",
+           px_host_bench_per_sec(BENCH_TPUT_BYTES, time_us[2]) / 1e6);
+}
+
+int main(void)
+{
+    printf("px_ring_buf benchmark (%s, %u-bit index, buffer size = %u)\n\n",
+           PX_RING_BUF_CFG_POW2 ? "power of two" : "any size",
+           PX_RING_BUF_CFG_IDX_SIZE, BENCH_BUF_SIZE);
+    bench_model();
+#if (PX_RING_BUF_CFG_IDX_SIZE == 32)
+    bench_large();
+#endif
+    bench_stress();
+    bench_tput();
+
+    return 0;
+}
@@ -0,0 +1,412 @@
+/*
+ *  Host simulation test and benchmark for px_sched. Build and run with:
+ *
+ *      make -C tools/px_host_test run
+ *
+ *  The simulated tick counter (tools/px_host_test/px_sysclk.c) starts just
+ *  before roll-over. PX_SCHED_CFG_SLEEP() and PX_SCHED_CFG_WAIT() are mapped
+ *  to px_sched_host_sleep() and px_sched_host_wait() (see
+ *  tools/px_host_test/cfg/px_sched_cfg.h) which advance the tick counter, as
+ *  the STM32 px_sysclk_sleep() compensates the tick counter on wake-up. The
+ *  simulated RTC is derived from the tick counter.
+ *
+ *  1. Periodic tasks, a one shot task with random delays, a task signalled by
+ *     a simulated interrupt at random times (which wakes the scheduler early),
+ *     an RTC alarm task and a registered application timer run for
+ *     BENCH_SIM_SEC simulated seconds. Each task checks that it runs on
+ *     exactly the expected tick (RTC alarm: within PX_SCHED_CFG_RTC_POLL_TICKS
+ *     of the alarm second). Each sleep request is checked against the next
+ *     deadline calculated by a model.
+ *  2. With all tasks removed, the scheduler must sleep for
+ *     PX_SCHED_CFG_IDLE_TICKS_MAX.
+ *  3. Wake-ups per second and idle ratio compared with a periodic tick, and
+ *     the time to calculate the next deadline.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "px_sysclk.h"
+#include "px_systmr.h"
+#include "px_sched.h"
+#include "px_host_bench.h"
+
+/// Number of simulated seconds
+#define BENCH_SIM_SEC           (6ul * 3600ul)
+/// Number of periodic tasks
+#define BENCH_NR_OF_PERIODIC    4
+/// Maximum one shot task and application timer delay
+#define BENCH_DELAY_MAX         5000ul
+/// Maximum time between simulated interrupts
+#define BENCH_IRQ_TICKS_MAX     20000ul
+/// Maximum RTC alarm time in seconds from now
+#define BENCH_ALARM_SEC_MAX     30ul
+/// RTC time at start of simulation
+#define BENCH_RTC_START_SEC     800000000ul
+/// Start tick (roll-over during simulation)
+#define BENCH_START_TICK        ((px_systmr_ticks_t)0xfff00000ul)
+/// Number of deadline calculations to time
+#define BENCH_DEADLINE_CALLS    1000000ul
+
+/// Task with model state
+typedef struct
+{
+    px_sched_task_t   task;             ///< Must be first
+    px_systmr_ticks_t expected_tick;    ///< Tick on which task must run
+    bool              running;          ///< Task timer must be running
+    unsigned long     nr_of_runs;       ///< Number of times task has run
+} bench_task_t;
+
+static const px_systmr_ticks_t bench_periods[BENCH_NR_OF_PERIODIC] = {7, 50, 333, 1000};
+
+static bench_task_t      bench_periodic[BENCH_NR_OF_PERIODIC];
+static bench_task_t      bench_oneshot;
+static bench_task_t      bench_irq;
+static bench_task_t      bench_alarm;
+static px_systmr_t       bench_app_tmr;
+static px_sched_systmr_t bench_app_sched_tmr;
+static px_systmr_ticks_t bench_app_expected_tick;
+static unsigned long     bench_app_nr_of_expiries;
+
+static uint32_t          bench_seed = 1;
+static px_systmr_ticks_t bench_irq_tick;
+static px_systmr_ticks_t bench_expected_sleep;
+static bool              bench_check_sleep;
+static unsigned long     bench_nr_of_sleeps;
+static unsigned long     bench_nr_of_waits;
+static unsigned long     bench_nr_of_irqs;
+static unsigned long     bench_ticks_slept;
+
+/// Simple xorshift PRNG
+static uint32_t bench_rand(uint32_t * state)
+{
+    uint32_t x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+static px_systmr_ticks_t bench_now(void)
+{
+    return px_sysclk_get_tick_count();
+}
+
+/// Tick on which the specified RTC second starts
+static px_systmr_ticks_t bench_rtc_sec_tick(uint32_t sec)
+{
+    return BENCH_START_TICK + (sec - BENCH_RTC_START_SEC) * PX_SYSTMR_TICKS_PER_SEC;
+}
+
+/// Simulated interrupt: signal task and schedule next interrupt
+static void bench_irq_check(void)
+{
+    if(bench_now() == bench_irq_tick)
+    {
+        px_sched_task_signal(&bench_irq.task);
+        bench_irq.expected_tick = bench_irq_tick;
+        bench_irq_tick         += 1 + bench_rand(&bench_seed) % BENCH_IRQ_TICKS_MAX;
+        bench_nr_of_irqs++;
+    }
+}
+
+void px_sched_host_sleep(px_sysclk_ticks_t ticks)
+{
+    px_systmr_ticks_t irq_ticks = bench_irq_tick - bench_now();
+
+    PX_HOST_CHECK(ticks >= PX_SCHED_CFG_IDLE_TICKS_MIN);
+    PX_HOST_CHECK(ticks <= PX_SCHED_CFG_IDLE_TICKS_MAX);
+    if(bench_check_sleep)
+    {
+        PX_HOST_CHECK(ticks == bench_expected_sleep);
+    }
+    // Interrupt before deadline wakes up early
+    if(irq_ticks < ticks)
+    {
+        ticks = irq_ticks;
+    }
+    // Compensate tick count
+    px_sysclk_host_advance(ticks);
+    bench_irq_check();
+    bench_nr_of_sleeps++;
+    bench_ticks_slept += ticks;
+}
+
+void px_sched_host_wait(void)
+{
+    // Next tick
+    px_sysclk_host_advance(1);
+    bench_irq_check();
+    bench_nr_of_waits++;
+}
+
+uint32_t px_sched_host_rtc_sec_rd(void)
+{
+    return BENCH_RTC_START_SEC
+           + (px_systmr_ticks_t)(bench_now() - BENCH_START_TICK) / PX_SYSTMR_TICKS_PER_SEC;
+}
+
+static void bench_deadline_min(px_systmr_ticks_t * ticks_min,
+                               px_systmr_ticks_t   expected_tick)
+{
+    px_systmr_ticks_t ticks = expected_tick - bench_now();
+
+    // Deadline passed?
+    if(ticks > PX_SCHED_CFG_IDLE_TICKS_MAX * 2)
+    {
+        ticks = 0;
+    }
+    if(ticks < *ticks_min)
+    {
+        *ticks_min = ticks;
+    }
+}
+
+/// Model: number of ticks until next deadline
+static px_systmr_ticks_t bench_model_ticks_to_next_deadline(void)
+{
+    px_systmr_ticks_t ticks_min = PX_SCHED_TICKS_INFINITE;
+    uint32_t          rtc_sec;
+    int               i;
+
+    for(i = 0; i < BENCH_NR_OF_PERIODIC; i++)
+    {
+        bench_deadline_min(&ticks_min, bench_periodic[i].expected_tick);
+    }
+    if(bench_oneshot.running)
+    {
+        bench_deadline_min(&ticks_min, bench_oneshot.expected_tick);
+    }
+    bench_deadline_min(&ticks_min, bench_app_expected_tick);
+    // RTC alarm: sleep until second before alarm, then poll
+    rtc_sec = px_sched_host_rtc_sec_rd();
+    if(bench_alarm.task.alarm_sec - rtc_sec == 1)
+    {
+        if(PX_SCHED_CFG_RTC_POLL_TICKS < ticks_min)
+        {
+            ticks_min = PX_SCHED_CFG_RTC_POLL_TICKS;
+        }
+    }
+    else
+    {
+        bench_deadline_min(&ticks_min, bench_now() + (bench_alarm.task.alarm_sec - rtc_sec - 1) * PX_SYSTMR_TICKS_PER_SEC);
+    }
+    if(ticks_min > PX_SCHED_CFG_IDLE_TICKS_MAX)
+    {
+        ticks_min = PX_SCHED_CFG_IDLE_TICKS_MAX;
+    }
+    return ticks_min;
+}
+
+static void bench_task_periodic(px_sched_task_t * task)
+{
+    bench_task_t *    bench_task = (bench_task_t *)task;
+    px_systmr_ticks_t period     = *(const px_systmr_ticks_t *)task->arg;
+
+    PX_HOST_CHECK(bench_now() == bench_task->expected_tick);
+    bench_task->expected_tick += period;
+    bench_task->nr_of_runs++;
+    // Restart timer from previous deadline (no drift)
+    px_systmr_reset(&task->tmr);
+}
+
+static void bench_task_oneshot(px_sched_task_t * task)
+{
+    bench_task_t *    bench_task = (bench_task_t *)task;
+    px_systmr_ticks_t delay;
+
+    PX_HOST_CHECK(bench_task->running);
+    PX_HOST_CHECK(bench_now() == bench_task->expected_tick);
+    bench_task->nr_of_runs++;
+    bench_task->running = false;
+    // Restart with random delay (75% probability)
+    if(bench_rand(&bench_seed) % 4 != 0)
+    {
+        delay = 1 + bench_rand(&bench_seed) % BENCH_DELAY_MAX;
+        px_sched_task_start(task, delay);
+        bench_task->expected_tick = bench_now() + delay;
+        bench_task->running       = true;
+    }
+}
+
+static void bench_task_irq(px_sched_task_t * task)
+{
+    bench_task_t *    bench_task = (bench_task_t *)task;
+    px_systmr_ticks_t delay;
+
+    // Must run on interrupt tick (early wake-up)
+    PX_HOST_CHECK(bench_now() == bench_task->expected_tick);
+    bench_task->nr_of_runs++;
+    // Restart one shot task if it is stopped
+    if(!bench_oneshot.running)
+    {
+        delay = 1 + bench_rand(&bench_seed) % BENCH_DELAY_MAX;
+        px_sched_task_start(&bench_oneshot.task, delay);
+        bench_oneshot.expected_tick = bench_now() + delay;
+        bench_oneshot.running       = true;
+    }
+}
+
+static void bench_task_alarm(px_sched_task_t * task)
+{
+    bench_task_t *    bench_task = (bench_task_t *)task;
+    px_systmr_ticks_t late;
+    uint32_t          rtc_sec    = px_sched_host_rtc_sec_rd();
+
+    // Must run within poll interval after start of alarm second
+    late = bench_now() - bench_rtc_sec_tick(task->alarm_sec);
+    PX_HOST_CHECK(late <= PX_SCHED_CFG_RTC_POLL_TICKS);
+    bench_task->nr_of_runs++;
+    px_sched_task_alarm_set(task, rtc_sec + 1 + bench_rand(&bench_seed) % BENCH_ALARM_SEC_MAX);
+}
+
+static void bench_app_tmr_start(void)
+{
+    px_systmr_ticks_t delay = 1 + bench_rand(&bench_seed) % BENCH_DELAY_MAX;
+
+    px_systmr_start(&bench_app_tmr, delay);
+    bench_app_expected_tick = bench_now() + delay;
+}
+
+static void bench_start(void)
+{
+    int i;
+
+    px_sysclk_host_set_tick_count(BENCH_START_TICK);
+    px_sched_init();
+    for(i = 0; i < BENCH_NR_OF_PERIODIC; i++)
+    {
+        px_sched_task_add(&bench_periodic[i].task, bench_task_periodic, (void *)&bench_periods[i]);
+        px_sched_task_start(&bench_periodic[i].task, bench_periods[i]);
+        bench_periodic[i].expected_tick = bench_now() + bench_periods[i];
+    }
+    px_sched_task_add(&bench_oneshot.task, bench_task_oneshot, NULL);
+    px_sched_task_start(&bench_oneshot.task, 10);
+    bench_oneshot.expected_tick = bench_now() + 10;
+    bench_oneshot.running       = true;
+    px_sched_task_add(&bench_irq.task, bench_task_irq, NULL);
+    bench_irq_tick = bench_now() + 1 + bench_rand(&bench_seed) % BENCH_IRQ_TICKS_MAX;
+    px_sched_task_add(&bench_alarm.task, bench_task_alarm, NULL);
+    px_sched_task_alarm_set(&bench_alarm.task, px_sched_host_rtc_sec_rd() + 5);
+    px_sched_systmr_register(&bench_app_sched_tmr, &bench_app_tmr);
+    bench_app_tmr_start();
+}
+
+/// Main loop iteration
+static bool bench_main_loop(void)
+{
+    // Application timer polled in main loop
+    if(px_systmr_has_expired(&bench_app_tmr))
+    {
+        PX_HOST_CHECK(bench_now() == bench_app_expected_tick);
+        bench_app_nr_of_expiries++;
+        bench_app_tmr_start();
+    }
+    return px_sched_run();
+}
+
+static void bench_sim(void)
+{
+    px_systmr_ticks_t elapsed;
+    int               i;
+
+    bench_start();
+    bench_check_sleep = true;
+    while((px_systmr_ticks_t)(bench_now() - BENCH_START_TICK) < BENCH_SIM_SEC * PX_SYSTMR_TICKS_PER_SEC)
+    {
+        if(!bench_main_loop())
+        {
+            bench_expected_sleep = bench_model_ticks_to_next_deadline();
+            px_sched_idle();
+        }
+    }
+    // Run tasks that are ready on last tick
+    bench_main_loop();
+    elapsed = bench_now() - BENCH_START_TICK;
+    for(i = 0; i < BENCH_NR_OF_PERIODIC; i++)
+    {
+        PX_HOST_CHECK(bench_periodic[i].nr_of_runs == elapsed / bench_periods[i]);
+    }
+    PX_HOST_CHECK(bench_irq.nr_of_runs == bench_nr_of_irqs);
+    PX_HOST_CHECK(bench_alarm.nr_of_runs > BENCH_SIM_SEC / BENCH_ALARM_SEC_MAX);
+    PX_HOST_CHECK(bench_oneshot.nr_of_runs > 0);
+    PX_HOST_CHECK(bench_app_nr_of_expiries > 0);
+
+    printf("Simulated %lu s: periodic task runs = %lu, one shot = %lu, irq = %lu, "
+           "RTC alarm = %lu, application timer = %lu\n",
+           BENCH_SIM_SEC,
+           bench_periodic[0].nr_of_runs + bench_periodic[1].nr_of_runs
+           + bench_periodic[2].nr_of_runs + bench_periodic[3].nr_of_runs,
+           bench_oneshot.nr_of_runs, bench_irq.nr_of_runs,
+           bench_alarm.nr_of_runs, bench_app_nr_of_expiries);
+}
+
+static void bench_idle_max(void)
+{
+    int i;
+
+    for(i = 0; i < BENCH_NR_OF_PERIODIC; i++)
+    {
+        px_sched_task_remove(&bench_periodic[i].task);
+    }
+    px_sched_task_remove(&bench_oneshot.task);
+    px_sched_task_remove(&bench_irq.task);
+    px_sched_task_remove(&bench_alarm.task);
+    // Application timer wakes scheduler once, but not while it stays expired
+    px_systmr_start(&bench_app_tmr, 1);
+    px_sysclk_host_advance(1);
+    PX_HOST_CHECK(px_sched_ticks_to_next_deadline() == 0);
+    PX_HOST_CHECK(px_systmr_has_expired(&bench_app_tmr));
+    PX_HOST_CHECK(px_sched_ticks_to_next_deadline() == PX_SCHED_TICKS_INFINITE);
+    px_sched_systmr_unregister(&bench_app_sched_tmr);
+    PX_HOST_CHECK(px_sched_ticks_to_next_deadline() == PX_SCHED_TICKS_INFINITE);
+    // Interrupt after maximum sleep
+    bench_irq_tick       = bench_now() + PX_SCHED_CFG_IDLE_TICKS_MAX + 1;
+    bench_expected_sleep = PX_SCHED_CFG_IDLE_TICKS_MAX;
+    px_sched_idle();
+    PX_HOST_CHECK(px_sched_run() == false);
+}
+
+int main(void)
+{
+    unsigned long     nr_of_wakeups;
+    double            sim_ticks = (double)BENCH_SIM_SEC * PX_SYSTMR_TICKS_PER_SEC;
+    uint64_t          start_us;
+    uint64_t          time_us;
+    px_systmr_ticks_t sum = 0;
+    unsigned long     i;
+
+    printf("px_sched host test: %d periodic tasks, one shot, irq, RTC alarm and application timer\n\n",
+           BENCH_NR_OF_PERIODIC);
+
+    bench_sim();
+    nr_of_wakeups = bench_nr_of_sleeps + bench_nr_of_waits;
+    printf("Model check: OK (%lu sleeps, %lu waits, %lu early wake-ups by irq)\n\n",
+           bench_nr_of_sleeps, bench_nr_of_waits, bench_nr_of_irqs);
+
+    printf("%-28s %14s %14s\n", "", "Periodic tick", "Tickless");
+    printf("%-28s %14.1f %14.1f\n", "Wake-ups per second",
+           (double)PX_SYSTMR_TICKS_PER_SEC, (double)nr_of_wakeups / BENCH_SIM_SEC);
+    printf("%-28s %14.1f %14.1f\n", "Average ticks per wake-up",
+           1.0, sim_ticks / nr_of_wakeups);
+    printf("%-28s %13.1f%% %13.1f%%\n", "Ticks spent in sleep",
+           0.0, 100.0 * bench_ticks_slept / sim_ticks);
+
+    // Time deadline calculation (tasks still running)
+    bench_check_sleep = false;
+    start_us = px_host_bench_time_us();
+    for(i = 0; i < BENCH_DEADLINE_CALLS; i++)
+    {
+        sum += px_sched_ticks_to_next_deadline();
+    }
+    time_us = px_host_bench_time_us() - start_us;
+    printf("\npx_sched_ticks_to_next_deadline(): %.3f us per call (%d tasks, 1 timer) [%u]\n",
+           (double)time_us / BENCH_DEADLINE_CALLS, BENCH_NR_OF_PERIODIC + 3, (unsigned)(sum & 1));
+
+    bench_check_sleep = true;
+    bench_idle_max();
+    printf("Idle with no deadlines: OK (sleeps for %lu ticks)\n", (unsigned long)PX_SCHED_CFG_IDLE_TICKS_MAX);
+
+    return 0;
+}
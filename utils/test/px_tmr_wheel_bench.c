@@ -0,0 +1,371 @@
+/*
+ *  Host simulation test and benchmark for px_tmr_wheel. Build and run with:
+ *
+ *      make -C tools/px_host_test run
+ *
+ *  The simulated tick counter (tools/px_host_test/px_sysclk.c) starts just
+ *  before roll-over and is advanced by the test.
+ *
+ *  1. BENCH_NR_OF_TMRS one shot and periodic timers with random delays are
+ *     started. The tick counter is advanced one tick at a time and the wheel
+ *     is serviced after each tick. Each expiry function checks that the timer
+ *     expired on exactly the expected tick and randomly restarts or stops
+ *     timers. A model records which timers must be running.
+ *  2. Same, but the main loop "sleeps": the tick counter is advanced by
+ *     px_tmr_wheel_ticks_to_next_expiry(), which is checked against the model.
+ *  3. Time per tick to service the wheel vs polling each px_systmr_t timer
+ *     with px_systmr_has_expired().
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "px_sysclk.h"
+#include "px_systmr.h"
+#include "px_tmr_wheel.h"
+#include "px_host_bench.h"
+
+/// Number of timers
+#define BENCH_NR_OF_TMRS        10000
+/// Number of ticks simulated one tick at a time
+#define BENCH_SIM_TICKS         (1ul << 21)
+/// Number of wake-ups simulated in sleep mode
+#define BENCH_SIM_WAKEUPS       200000ul
+/// Number of ticks for polling benchmark
+#define BENCH_POLL_TICKS        2000ul
+/// Start tick (roll-over during simulation)
+#define BENCH_START_TICK        ((px_systmr_ticks_t)(0 - BENCH_SIM_TICKS / 2))
+
+/// Timer with model state
+typedef struct
+{
+    px_tmr_wheel_tmr_t tmr;             ///< Must be first
+    px_systmr_ticks_t  expiry_tick;     ///< Expected expiry tick
+    bool               running;         ///< Timer must be running
+    bool               late;            ///< Deadline has passed when started
+} bench_tmr_t;
+
+static px_tmr_wheel_t bench_wheel;
+static bench_tmr_t    bench_tmrs[BENCH_NR_OF_TMRS];
+static px_systmr_t    bench_systmrs[BENCH_NR_OF_TMRS];
+static uint32_t       bench_seed = 1;
+static uint32_t       bench_max_delay;
+static unsigned long  bench_nr_of_expiries;
+
+/// Simple xorshift PRNG
+static uint32_t bench_rand(uint32_t * state)
+{
+    uint32_t x = *state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+/// Random delay: mostly short, some long (beyond the levels of the wheel)
+static px_systmr_ticks_t bench_delay(void)
+{
+    uint32_t r = bench_rand(&bench_seed) % 100;
+    uint32_t delay;
+
+    if(r < 70)      delay = 1 + bench_rand(&bench_seed) % 1000;
+    else if(r < 95) delay = 1 + bench_rand(&bench_seed) % 65536;
+    else            delay = 1 + bench_rand(&bench_seed) % bench_max_delay;
+    if(delay > bench_max_delay)
+    {
+        delay = bench_max_delay;
+    }
+    return (px_systmr_ticks_t)delay;
+}
+
+static void bench_on_expire(px_tmr_wheel_tmr_t * tmr);
+
+/// Start a random timer (one shot or periodic, or deadline in the past)
+static void bench_tmr_start(bench_tmr_t * t)
+{
+    px_systmr_ticks_t now = px_sysclk_get_tick_count();
+    px_systmr_ticks_t delay;
+    uint32_t          r = bench_rand(&bench_seed) % 16;
+
+    if(r == 0)
+    {
+        delay = 1 + bench_rand(&bench_seed) % 5000;
+        px_tmr_wheel_start_periodic(&bench_wheel, &t->tmr, delay);
+        t->expiry_tick = now + delay;
+    }
+    else if(r == 1)
+    {
+        // Deadline has already passed: expires on next tick that is serviced
+        px_tmr_wheel_start_at(&bench_wheel, &t->tmr, now - 10);
+        t->expiry_tick = bench_wheel.tick;
+        t->late        = true;
+    }
+    else
+    {
+        delay = bench_delay();
+        px_tmr_wheel_start(&bench_wheel, &t->tmr, delay);
+        t->expiry_tick = now + delay;
+    }
+    if(r != 1)
+    {
+        t->late = false;
+    }
+    t->running = true;
+}
+
+static void bench_tmr_stop(bench_tmr_t * t)
+{
+    px_tmr_wheel_stop(&bench_wheel, &t->tmr);
+    t->running = false;
+}
+
+static void bench_on_expire(px_tmr_wheel_tmr_t * tmr)
+{
+    bench_tmr_t *     t   = (bench_tmr_t *)tmr;
+    px_systmr_ticks_t now = px_sysclk_get_tick_count();
+    bench_tmr_t *     t_other;
+
+    // Must expire on exactly the expected tick (or later if deadline had passed)
+    PX_HOST_CHECK(t->running);
+    if(t->late)
+    {
+        PX_HOST_CHECK((px_systmr_ticks_t)(now - t->expiry_tick) <= 1);
+        t->expiry_tick = now;
+        t->late        = false;
+    }
+    PX_HOST_CHECK(t->expiry_tick == now);
+    PX_HOST_CHECK(px_tmr_wheel_is_running(tmr) == (tmr->period != 0));
+    bench_nr_of_expiries++;
+    if(tmr->period != 0)
+    {
+        t->expiry_tick += tmr->period;
+    }
+    else
+    {
+        t->running = false;
+    }
+    // Random action
+    t_other = &bench_tmrs[bench_rand(&bench_seed) % BENCH_NR_OF_TMRS];
+    switch(bench_rand(&bench_seed) % 8)
+    {
+    case 0:
+    case 1:
+    case 2:
+        // Restart this timer
+        bench_tmr_start(t);
+        break;
+    case 3:
+        // Stop this (periodic) timer
+        bench_tmr_stop(t);
+        break;
+    case 4:
+        // Stop other timer (may be in the expired list of this tick)
+        bench_tmr_stop(t_other);
+        break;
+    case 5:
+        // (Re)start other timer
+        bench_tmr_start(t_other);
+        break;
+    default:
+        break;
+    }
+}
+
+/// Return number of ticks until first timer must expire according to model
+static px_systmr_ticks_t bench_model_ticks_to_next_expiry(void)
+{
+    px_systmr_ticks_t now       = px_sysclk_get_tick_count();
+    px_systmr_ticks_t ticks_min = PX_TMR_WHEEL_TICKS_INFINITE;
+    px_systmr_ticks_t ticks;
+    size_t            i;
+
+    for(i = 0; i < BENCH_NR_OF_TMRS; i++)
+    {
+        if(!bench_tmrs[i].running)
+        {
+            continue;
+        }
+        ticks = bench_tmrs[i].expiry_tick - now;
+        if(ticks >= ((px_systmr_ticks_t)~0) / 2)
+        {
+            // Already expired
+            ticks = 0;
+        }
+        if(ticks < ticks_min)
+        {
+            ticks_min = ticks;
+        }
+    }
+    return ticks_min;
+}
+
+static void bench_start_all(void)
+{
+    size_t i;
+
+    px_tmr_wheel_init(&bench_wheel);
+    for(i = 0; i < BENCH_NR_OF_TMRS; i++)
+    {
+        px_tmr_wheel_tmr_init(&bench_tmrs[i].tmr, bench_on_expire, NULL);
+        bench_tmrs[i].running = false;
+        bench_tmr_start(&bench_tmrs[i]);
+    }
+}
+
+/// Stop periodic timers and run until all one shot timers have expired
+static void bench_finish(void)
+{
+    px_systmr_ticks_t ticks;
+    size_t            i;
+
+    for(i = 0; i < BENCH_NR_OF_TMRS; i++)
+    {
+        if(bench_tmrs[i].tmr.period != 0)
+        {
+            bench_tmr_stop(&bench_tmrs[i]);
+        }
+    }
+    while(true)
+    {
+        ticks = px_tmr_wheel_ticks_to_next_expiry(&bench_wheel);
+        PX_HOST_CHECK(ticks == bench_model_ticks_to_next_expiry());
+        if(ticks == PX_TMR_WHEEL_TICKS_INFINITE)
+        {
+            break;
+        }
+        px_sysclk_host_advance(ticks);
+        px_tmr_wheel_service(&bench_wheel);
+        // Stop anything (re)started by expiry functions
+        for(i = 0; i < BENCH_NR_OF_TMRS; i++)
+        {
+            if(bench_tmrs[i].running && (bench_tmrs[i].tmr.period != 0))
+            {
+                bench_tmr_stop(&bench_tmrs[i]);
+            }
+        }
+    }
+    for(i = 0; i < BENCH_NR_OF_TMRS; i++)
+    {
+        PX_HOST_CHECK(!bench_tmrs[i].running);
+        PX_HOST_CHECK(!px_tmr_wheel_is_running(&bench_tmrs[i].tmr));
+    }
+}
+
+/// Service wheel after each tick
+static void bench_sim_tick(void)
+{
+    unsigned long i;
+    uint64_t      t;
+
+    bench_max_delay = (uint32_t)BENCH_SIM_TICKS / 2;
+    px_sysclk_host_set_tick_count(BENCH_START_TICK);
+    bench_start_all();
+    bench_nr_of_expiries = 0;
+    t = px_host_bench_time_us();
+    for(i = 0; i < BENCH_SIM_TICKS; i++)
+    {
+        px_sysclk_host_advance(1);
+        px_tmr_wheel_service(&bench_wheel);
+    }
+    t = px_host_bench_time_us() - t;
+    printf("Tick by tick: %lu ticks, %lu expiries, %.1f ns per tick\n",
+           BENCH_SIM_TICKS, bench_nr_of_expiries,
+           (double)t * 1000.0 / (double)BENCH_SIM_TICKS);
+    bench_finish();
+}
+
+/// Sleep until next timer expires
+static void bench_sim_sleep(void)
+{
+    px_systmr_ticks_t ticks;
+    px_systmr_ticks_t start;
+    bench_tmr_t *     t_start;
+    unsigned long     i;
+    uint64_t          t;
+
+    bench_max_delay = 1ul << 28;
+    px_sysclk_host_set_tick_count(BENCH_START_TICK);
+    start = px_sysclk_get_tick_count();
+    bench_start_all();
+    bench_nr_of_expiries = 0;
+    t = px_host_bench_time_us();
+    for(i = 0; i < BENCH_SIM_WAKEUPS; i++)
+    {
+        ticks = px_tmr_wheel_ticks_to_next_expiry(&bench_wheel);
+        if((i % 64) == 0)
+        {
+            PX_HOST_CHECK(ticks == bench_model_ticks_to_next_expiry());
+        }
+        PX_HOST_CHECK(ticks != PX_TMR_WHEEL_TICKS_INFINITE);
+        px_sysclk_host_advance(ticks);
+        px_tmr_wheel_service(&bench_wheel);
+        // Start a stopped timer to keep the number of running timers up
+        t_start = &bench_tmrs[bench_rand(&bench_seed) % BENCH_NR_OF_TMRS];
+        if(!t_start->running)
+        {
+            bench_tmr_start(t_start);
+        }
+    }
+    t = px_host_bench_time_us() - t;
+    printf("Sleep mode:   %lu wake-ups over %lu ticks, %lu expiries, %.1f ns per wake-up\n",
+           BENCH_SIM_WAKEUPS, (unsigned long)(px_systmr_ticks_t)(px_sysclk_get_tick_count() - start),
+           bench_nr_of_expiries, (double)t * 1000.0 / (double)BENCH_SIM_WAKEUPS);
+    bench_finish();
+}
+
+/// Compare servicing the wheel with polling each timer
+static void bench_poll(void)
+{
+    volatile unsigned long expired = 0;
+    unsigned long          i;
+    size_t                 j;
+    uint64_t               t_wheel;
+    uint64_t               t_poll;
+
+    bench_max_delay = 1ul << 20;
+    px_sysclk_host_set_tick_count(BENCH_START_TICK);
+    bench_start_all();
+    t_wheel = px_host_bench_time_us();
+    for(i = 0; i < BENCH_POLL_TICKS; i++)
+    {
+        px_sysclk_host_advance(1);
+        px_tmr_wheel_service(&bench_wheel);
+    }
+    t_wheel = px_host_bench_time_us() - t_wheel;
+
+    px_sysclk_host_set_tick_count(BENCH_START_TICK);
+    for(j = 0; j < BENCH_NR_OF_TMRS; j++)
+    {
+        px_systmr_start(&bench_systmrs[j], bench_delay());
+    }
+    t_poll = px_host_bench_time_us();
+    for(i = 0; i < BENCH_POLL_TICKS; i++)
+    {
+        px_sysclk_host_advance(1);
+        for(j = 0; j < BENCH_NR_OF_TMRS; j++)
+        {
+            if(px_systmr_has_expired(&bench_systmrs[j]))
+            {
+                px_systmr_start(&bench_systmrs[j], bench_delay());
+                expired++;
+            }
+        }
+    }
+    t_poll = px_host_bench_time_us() - t_poll;
+    printf("%d timers, ns per tick: px_tmr_wheel_service() %.1f, px_systmr_has_expired() poll %.1f\n",
+           BENCH_NR_OF_TMRS,
+           (double)t_wheel * 1000.0 / (double)BENCH_POLL_TICKS,
+           (double)t_poll  * 1000.0 / (double)BENCH_POLL_TICKS);
+    bench_finish();
+}
+
+int main(void)
+{
+    printf("Wheel: %d levels of %u slots\n", PX_TMR_WHEEL_CFG_LEVELS, PX_TMR_WHEEL_SLOTS);
+    bench_sim_tick();
+    bench_sim_sleep();
+    bench_poll();
+
+    return 0;
+}